@@ -89,12 +89,27 @@
 
 
 #include <algorithm>
+#include <cstddef>
 
 namespace sfad
 {
 	namespace detail
 	{
 		extern std::size_t globalGradSize;
+
+		/**
+		 * @brief Returns the number of directions processed by an AD type of the given width
+		 * @details A width of @c 0 denotes a dynamic number of directions determined by
+		 *          the global gradient size. Otherwise, the width is a compile-time constant
+		 *          which allows the compiler to unroll and vectorize the gradient loops.
+		 * @tparam N Compile-time width or @c 0
+		 * @return Number of directions
+		 */
+		template <std::size_t N>
+		inline std::size_t gradSize() SFAD_NOEXCEPT
+		{
+			return (N > 0) ? N : globalGradSize;
+		}
 	}
 
 	inline void setGradientSize(const std::size_t n) SFAD_NOEXCEPT
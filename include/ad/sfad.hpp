@@ -23,7 +23,16 @@
 
 namespace sfad
 {
-	template <typename real_t>
+	/**
+	 * @brief Forward AD type with directional derivatives stored in a fixed-size array
+	 * @details If @p N is @c 0, the number of directions is determined at runtime by the
+	 *          global gradient size (see setGradientSize()), which must not exceed
+	 *          @c SFAD_DEFAULT_DIR. Otherwise, exactly @p N directions are stored and
+	 *          processed, independent of the global gradient size.
+	 * @tparam real_t Underlying floating point type
+	 * @tparam N Number of directions or @c 0 for a runtime number of directions
+	 */
+	template <typename real_t, std::size_t N = 0>
 	class Fwd
 	{
 	public:
@@ -39,19 +48,19 @@ namespace sfad
 		}
 		Fwd(const real_t val, real_t const* const grad) SFAD_NOEXCEPT : _val(val)
 		{
-			std::copy_n(grad, detail::globalGradSize, _grad);
+			std::copy_n(grad, detail::gradSize<N>(), _grad);
 		}
-		Fwd(const Fwd<real_t>& cpy) SFAD_NOEXCEPT = default;
-		Fwd(Fwd<real_t>&& other) SFAD_NOEXCEPT = default;
+		Fwd(const Fwd<real_t, N>& cpy) SFAD_NOEXCEPT = default;
+		Fwd(Fwd<real_t, N>&& other) SFAD_NOEXCEPT = default;
 
 		~Fwd() = default;
 
-		Fwd<real_t>& operator=(Fwd<real_t>&& other) SFAD_NOEXCEPT = default;
-		Fwd<real_t>& operator=(const Fwd<real_t>& other) = default;
+		Fwd<real_t, N>& operator=(Fwd<real_t, N>&& other) SFAD_NOEXCEPT = default;
+		Fwd<real_t, N>& operator=(const Fwd<real_t, N>& other) = default;
 
-		const idx_t gradientSize() const SFAD_NOEXCEPT { return detail::globalGradSize; }
+		const idx_t gradientSize() const SFAD_NOEXCEPT { return detail::gradSize<N>(); }
 
-		template<typename T> friend void swap (Fwd<T>& x, Fwd<T>& y) SFAD_NOEXCEPT;
+		template<typename T, std::size_t M> friend void swap (Fwd<T, M>& x, Fwd<T, M>& y) SFAD_NOEXCEPT;
 
 		// ADOL-C compatibility
 
@@ -69,11 +78,11 @@ namespace sfad
 
 		inline void fillADValue(const real_t v)
 		{
-			fillADValue(0, detail::globalGradSize, v);
+			fillADValue(0, detail::gradSize<N>(), v);
 		}
 		inline void fillADValue(const idx_t start, const real_t v)
 		{
-			fillADValue(start, detail::globalGradSize, v);
+			fillADValue(start, detail::gradSize<N>(), v);
 		}
 		inline void fillADValue(const idx_t start, const idx_t end, const real_t v)
 		{
@@ -90,7 +99,7 @@ namespace sfad
 		// Operators with non-temporary results
 		
 		// Assignment
-		inline Fwd<real_t>& operator=(const real_t v)
+		inline Fwd<real_t, N>& operator=(const real_t v)
 		{
 			_val = v;
 			setADValue(real_t(0));
@@ -99,49 +108,49 @@ namespace sfad
 		}
 
 		// Addition
-		inline Fwd<real_t>& operator+=(const real_t v)
+		inline Fwd<real_t, N>& operator+=(const real_t v)
 		{
 			_val += v;
 			return *this;
 		}
 
-		inline Fwd<real_t>& operator+=(const Fwd<real_t>& a)
+		inline Fwd<real_t, N>& operator+=(const Fwd<real_t, N>& a)
 		{
 			_val += a._val;
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				_grad[i] += a._grad[i];
 
 			return *this;
 		}
 
 		// Substraction
-		inline Fwd<real_t>& operator-=(const real_t v)
+		inline Fwd<real_t, N>& operator-=(const real_t v)
 		{
 			_val -= v;
 			return *this;
 		}
 
-		inline Fwd<real_t>& operator-=(const Fwd<real_t>& a)
+		inline Fwd<real_t, N>& operator-=(const Fwd<real_t, N>& a)
 		{
 			_val -= a._val;
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				_grad[i] -= a._grad[i];
 
 			return *this;
 		}
 
 		// Multiplication
-		inline Fwd<real_t>& operator*=(const real_t v)
+		inline Fwd<real_t, N>& operator*=(const real_t v)
 		{
 			_val *= v;
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				_grad[i] *= v;
 			return *this;
 		}
 
-		inline Fwd<real_t>& operator*=(const Fwd<real_t>& a)
+		inline Fwd<real_t, N>& operator*=(const Fwd<real_t, N>& a)
 		{
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				_grad[i] = a._val * _grad[i] + _val * a._grad[i];
 
 			_val *= a._val;
@@ -149,17 +158,17 @@ namespace sfad
 		}
 		
 		// Division
-		inline Fwd<real_t>& operator/=(const real_t v)
+		inline Fwd<real_t, N>& operator/=(const real_t v)
 		{
 			_val /= v;
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				_grad[i] /= v;
 			return *this;
 		}
 
-		inline Fwd<real_t>& operator/=(const Fwd<real_t>& a)
+		inline Fwd<real_t, N>& operator/=(const Fwd<real_t, N>& a)
 		{
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 //				_grad[i] = (_grad[i] - _val / a._val * a._grad[i]) / a._val;
 				_grad[i] = (_grad[i] * a._val - _val * a._grad[i]) / (a._val * a._val);
 
@@ -168,428 +177,433 @@ namespace sfad
 		}
 
 		// Comparisons
-		inline bool operator!=(const Fwd<real_t>& v) const SFAD_NOEXCEPT { return v != _val; }
+		inline bool operator!=(const Fwd<real_t, N>& v) const SFAD_NOEXCEPT { return v != _val; }
 		inline bool operator!=(const real_t v) const SFAD_NOEXCEPT { return v != _val; }
-		inline friend bool operator!=(const real_t v, const Fwd<real_t>& a) SFAD_NOEXCEPT { return v != a._val; }
+		inline friend bool operator!=(const real_t v, const Fwd<real_t, N>& a) SFAD_NOEXCEPT { return v != a._val; }
 
-		inline bool operator==(const Fwd<real_t>& v) const SFAD_NOEXCEPT { return v == _val; }
+		inline bool operator==(const Fwd<real_t, N>& v) const SFAD_NOEXCEPT { return v == _val; }
 		inline bool operator==(const real_t v) const SFAD_NOEXCEPT { return v == _val; }
-		inline friend bool operator==(const real_t v, const Fwd<real_t>& a) SFAD_NOEXCEPT { return v == a._val; }
+		inline friend bool operator==(const real_t v, const Fwd<real_t, N>& a) SFAD_NOEXCEPT { return v == a._val; }
 
-		inline bool operator<=(const Fwd<real_t>& v) const SFAD_NOEXCEPT { return _val <= v._val; }
+		inline bool operator<=(const Fwd<real_t, N>& v) const SFAD_NOEXCEPT { return _val <= v._val; }
 		inline bool operator<=(const real_t v) const SFAD_NOEXCEPT { return _val <= v; }
-		inline friend bool operator<=(const real_t v, const Fwd<real_t>& a) SFAD_NOEXCEPT { return v <= a._val; }
+		inline friend bool operator<=(const real_t v, const Fwd<real_t, N>& a) SFAD_NOEXCEPT { return v <= a._val; }
 
-		inline bool operator>=(const Fwd<real_t>& v) const SFAD_NOEXCEPT { return _val >= v._val; }
+		inline bool operator>=(const Fwd<real_t, N>& v) const SFAD_NOEXCEPT { return _val >= v._val; }
 		inline bool operator>=(const real_t v) const SFAD_NOEXCEPT { return _val >= v; }
-		inline friend bool operator>= (const real_t v, const Fwd<real_t>& a) SFAD_NOEXCEPT { return v >= a._val; }
+		inline friend bool operator>= (const real_t v, const Fwd<real_t, N>& a) SFAD_NOEXCEPT { return v >= a._val; }
 
-		inline bool operator>(const Fwd<real_t>& v) const SFAD_NOEXCEPT { return _val > v._val; }
+		inline bool operator>(const Fwd<real_t, N>& v) const SFAD_NOEXCEPT { return _val > v._val; }
 		inline bool operator>(const real_t v) const SFAD_NOEXCEPT { return _val > v; }
-		inline friend bool operator>(const real_t v, const Fwd<real_t>& a) SFAD_NOEXCEPT { return v > a._val; }
+		inline friend bool operator>(const real_t v, const Fwd<real_t, N>& a) SFAD_NOEXCEPT { return v > a._val; }
 
-		inline bool operator<(const Fwd<real_t>& v) const SFAD_NOEXCEPT { return _val < v._val; }
+		inline bool operator<(const Fwd<real_t, N>& v) const SFAD_NOEXCEPT { return _val < v._val; }
 		inline bool operator<(const real_t v) const SFAD_NOEXCEPT { return _val < v; }
-		inline friend bool operator<(const real_t v, const Fwd<real_t>& a) SFAD_NOEXCEPT { return v < a._val; }
+		inline friend bool operator<(const real_t v, const Fwd<real_t, N>& a) SFAD_NOEXCEPT { return v < a._val; }
 
 		// Operators with temporary results
 		
 		// Unary sign
-		inline Fwd<real_t> operator-() const
+		inline Fwd<real_t, N> operator-() const
 		{
-			Fwd<real_t> cpy(-_val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> cpy(-_val, false);
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				cpy._grad[i] = -_grad[i];
 
 			return cpy;
 		}
 
-		inline Fwd<real_t> operator+() const { return *this; }
+		inline Fwd<real_t, N> operator+() const { return *this; }
 
 		// Addition
-		inline Fwd<real_t> operator+(const real_t v) const
+		inline Fwd<real_t, N> operator+(const real_t v) const
 		{
-			return Fwd<real_t>(_val + v, _grad);
+			return Fwd<real_t, N>(_val + v, _grad);
 		}
 
-		inline Fwd<real_t> operator+(const Fwd<real_t>& a) const
+		inline Fwd<real_t, N> operator+(const Fwd<real_t, N>& a) const
 		{
-			Fwd<real_t> cpy(_val + a._val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> cpy(_val + a._val, false);
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				cpy._grad[i] = _grad[i] + a._grad[i];
 			return cpy;
 		}
 
-		inline friend Fwd<real_t> operator+(const real_t v, const Fwd<real_t>& a)
+		inline friend Fwd<real_t, N> operator+(const real_t v, const Fwd<real_t, N>& a)
 		{
-			return Fwd<real_t>(v + a._val, a._grad);
+			return Fwd<real_t, N>(v + a._val, a._grad);
 		}
 		
 		// Substraction
-		inline Fwd<real_t> operator-(const real_t v) const
+		inline Fwd<real_t, N> operator-(const real_t v) const
 		{
-			return Fwd<real_t>(_val - v, _grad);
+			return Fwd<real_t, N>(_val - v, _grad);
 		}
 
-		inline Fwd<real_t> operator-(const Fwd<real_t>& a) const
+		inline Fwd<real_t, N> operator-(const Fwd<real_t, N>& a) const
 		{
-			Fwd<real_t> cpy(_val - a._val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> cpy(_val - a._val, false);
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				cpy._grad[i] = _grad[i] - a._grad[i];
 			return cpy;
 		}
 
-		inline friend Fwd<real_t> operator-(const real_t v, const Fwd<real_t>& a)
+		inline friend Fwd<real_t, N> operator-(const real_t v, const Fwd<real_t, N>& a)
 		{
-			Fwd<real_t> res(v - a._val, false);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> res(v - a._val, false);
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = -a._grad[i];
 			return res;
 		}
 		
 		// Multiplication
-		inline Fwd<real_t> operator*(const real_t v) const
+		inline Fwd<real_t, N> operator*(const real_t v) const
 		{
-			Fwd<real_t> res(_val * v);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> res(_val * v);
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = v * _grad[i];
 			return res;
 		}
 
-		inline Fwd<real_t> operator*(const Fwd<real_t>& a) const
+		inline Fwd<real_t, N> operator*(const Fwd<real_t, N>& a) const
 		{
-			Fwd<real_t> cpy(_val * a._val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> cpy(_val * a._val, false);
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				cpy._grad[i] = a._val * _grad[i] + _val * a._grad[i];
 			return cpy;
 		}
 
-		inline friend Fwd<real_t> operator*(const real_t v, const Fwd<real_t>& a)
+		inline friend Fwd<real_t, N> operator*(const real_t v, const Fwd<real_t, N>& a)
 		{
-			Fwd<real_t> res(v * a._val, false);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> res(v * a._val, false);
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = v * a._grad[i];
 			return res;
 		}
 	
 		// Division
-		inline Fwd<real_t> operator/(const real_t v) const
+		inline Fwd<real_t, N> operator/(const real_t v) const
 		{
-			Fwd<real_t> res(_val / v, false);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> res(_val / v, false);
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = _grad[i] / v;
 			return res;
 		}
 
-		inline Fwd<real_t> operator/(const Fwd<real_t>& a) const
+		inline Fwd<real_t, N> operator/(const Fwd<real_t, N>& a) const
 		{
-			Fwd<real_t> res(_val / a._val, false);
-			for (idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> res(_val / a._val, false);
+			for (idx_t i = 0; i < detail::gradSize<N>(); ++i)
 //				res._grad[i] = (_grad[i] - _val / a._val * a._grad[i]) / a._val;
 				res._grad[i] = (_grad[i] * a._val - _val * a._grad[i]) / (a._val * a._val);
 			return res;
 		}
 
-		inline friend Fwd<real_t> operator/(const real_t v, const Fwd<real_t>& a)
+		inline friend Fwd<real_t, N> operator/(const real_t v, const Fwd<real_t, N>& a)
 		{
-			Fwd<real_t> res(v / a._val, false);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			Fwd<real_t, N> res(v / a._val, false);
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 //				res._grad[i] = -(v / (a._val * a._val) * a._grad[i]);
 				res._grad[i] = -v * a._grad[i] / (a._val * a._val);
 			return res;
 		}
 
 		// Math functions
-		template<typename T> inline friend Fwd<T> exp(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> log(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> log10(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> sqrt(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> sqr(const Fwd<T> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> exp(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> log(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> log10(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> sqrt(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> sqr(const Fwd<T, M> &a);
 
-		template<typename T> inline friend Fwd<T> sin(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> cos(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> tan(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> asin(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> acos(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> atan(const Fwd<T> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> sin(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> cos(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> tan(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> asin(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> acos(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> atan(const Fwd<T, M> &a);
 
-		template<typename T> inline friend Fwd<T> pow(const Fwd<T> &a, T v);
-		template<typename T> inline friend Fwd<T> pow(T v, const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> pow(const Fwd<T> &a, const Fwd<T> &b);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> pow(const Fwd<T, M> &a, T v);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> pow(T v, const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> pow(const Fwd<T, M> &a, const Fwd<T, M> &b);
 
-		template<typename T> inline friend Fwd<T> sinh(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> cosh(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> tanh(const Fwd<T> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> sinh(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> cosh(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> tanh(const Fwd<T, M> &a);
 
-		template<typename T> inline friend Fwd<T> fabs(const Fwd<T> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> fabs(const Fwd<T, M> &a);
 
-		template<typename T> inline friend Fwd<T> ceil(const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> floor(const Fwd<T> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> ceil(const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> floor(const Fwd<T, M> &a);
 
-		template<typename T> inline friend Fwd<T> fmax(const Fwd<T> &a, const Fwd<T> &b);
-		template<typename T> inline friend Fwd<T> fmax(T v, const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> fmax(const Fwd<T> &a, T v);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> fmax(const Fwd<T, M> &a, const Fwd<T, M> &b);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> fmax(T v, const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> fmax(const Fwd<T, M> &a, T v);
 
-		template<typename T> inline friend Fwd<T> fmin(const Fwd<T> &a, const Fwd<T> &b);
-		template<typename T> inline friend Fwd<T> fmin(T v, const Fwd<T> &a);
-		template<typename T> inline friend Fwd<T> fmin(const Fwd<T> &a, T v);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> fmin(const Fwd<T, M> &a, const Fwd<T, M> &b);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> fmin(T v, const Fwd<T, M> &a);
+		template<typename T, std::size_t M> inline friend Fwd<T, M> fmin(const Fwd<T, M> &a, T v);
 
 	protected:
 		Fwd(const real_t val, bool dummy) : _val(val) { }
 
+		inline void copyGradient(real_t const* const grad) SFAD_NOEXCEPT
+		{
+			std::copy_n(grad, detail::gradSize<N>(), _grad);
+		}
+
 		real_t _val;
-		real_t _grad[SFAD_DEFAULT_DIR];
+		real_t _grad[(N > 0) ? N : SFAD_DEFAULT_DIR];
 	};
 
-	template <typename real_t>
-	inline Fwd<real_t> exp(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> exp(const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::exp(a._val), false);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		Fwd<real_t, N> res(std::exp(a._val), false);
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * res._val;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> log(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> log(const Fwd<real_t, N> &a)
 	{
 //		using std::copysign;
 
-		Fwd<real_t> res(std::log(a._val), false);
+		Fwd<real_t, N> res(std::log(a._val), false);
 		if (sfad_likely(a._val > real_t(0)))
 		{
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = a._grad[i] / a._val;
 		}
 		else if (a._val == real_t(0))
 		{
 			const real_t inf = std::numeric_limits<real_t>::infinity();
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = copysign(inf, -a._grad[i]);
 		}
 		else
 		{
 			const real_t nAn = std::numeric_limits<real_t>::quiet_NaN();
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = nAn;
 		}
 
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> log10(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> log10(const Fwd<real_t, N> &a)
 	{
 //		using std::copysign;
 
-		Fwd<real_t> res(std::log10(a._val), false);
+		Fwd<real_t, N> res(std::log10(a._val), false);
 		if (sfad_likely(a._val > real_t(0)))
 		{
 			const real_t tmp = std::log(real_t(10)) * a._val;
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = a._grad[i] / tmp;
 		}
 		else if (a._val == real_t(0))
 		{
 			const real_t inf = std::numeric_limits<real_t>::infinity();
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = copysign(inf, -a._grad[i]);
 		}
 		else
 		{
 			const real_t nAn = std::numeric_limits<real_t>::quiet_NaN();
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = nAn;
 		}
 
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> sqrt(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> sqrt(const Fwd<real_t, N> &a)
 	{
 //		using std::copysign;
 
-		Fwd<real_t> res(std::sqrt(a._val), false);
+		Fwd<real_t, N> res(std::sqrt(a._val), false);
 		if (sfad_likely(a._val > real_t(0)))
 		{
 			const real_t tmp = real_t(2) * res._val;
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = a._grad[i] / tmp;
 		}
 		else if (a._val == real_t(0))
 		{
 			const real_t inf = std::numeric_limits<real_t>::infinity();
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = copysign(inf, a._grad[i]);
 		}
 		else
 		{
 			const real_t nAn = std::numeric_limits<real_t>::quiet_NaN();
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = nAn;
 		}
 
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> sqr(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> sqr(const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(a._val * a._val, false);
+		Fwd<real_t, N> res(a._val * a._val, false);
 		const real_t tmp = real_t(2) * a._val;
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = tmp * a._grad[i];
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> sin(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> sin(const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::sin(a._val), false);
+		Fwd<real_t, N> res(std::sin(a._val), false);
 		const real_t tmp = std::cos(a._val);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> cos(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> cos(const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::cos(a._val), false);
+		Fwd<real_t, N> res(std::cos(a._val), false);
 		const real_t tmp = -std::sin(a._val);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> tan(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> tan(const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::tan(a._val), false);
+		Fwd<real_t, N> res(std::tan(a._val), false);
 
 		const real_t tmpCos = std::cos(a._val);
 		const real_t tmp = tmpCos * tmpCos;
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] / tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> asin(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> asin(const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::asin(a._val), false);
+		Fwd<real_t, N> res(std::asin(a._val), false);
 		const real_t tmp = std::sqrt(real_t(1) - a._val * a._val);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] / tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> acos(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> acos(const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::acos(a._val), false);
+		Fwd<real_t, N> res(std::acos(a._val), false);
 		const real_t tmp = std::sqrt(real_t(1) - a._val * a._val);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = -a._grad[i] / tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> atan(const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> atan(const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::atan(a._val), false);
+		Fwd<real_t, N> res(std::atan(a._val), false);
 		const real_t tmp = real_t(1) + a._val * a._val;
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] / tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> pow(const Fwd<real_t> &a, real_t v)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> pow(const Fwd<real_t, N> &a, real_t v)
 	{
-		Fwd<real_t> res(std::pow(a._val, v), false);
+		Fwd<real_t, N> res(std::pow(a._val, v), false);
 		const real_t tmp = v * std::pow(a._val, v - real_t(1));
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> pow(real_t v, const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> pow(real_t v, const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::pow(v, a._val), false);
+		Fwd<real_t, N> res(std::pow(v, a._val), false);
 		const real_t tmp = res._val * std::log(v);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> pow(const Fwd<real_t> &a, const Fwd<real_t> &b)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> pow(const Fwd<real_t, N> &a, const Fwd<real_t, N> &b)
 	{
-		Fwd<real_t> res(std::pow(a._val, b._val), false);
+		Fwd<real_t, N> res(std::pow(a._val, b._val), false);
 		const real_t tmp1 = b._val * std::pow(a._val, b._val - real_t(1));
 		const real_t tmp2 = res._val * std::log(a._val);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * tmp1 + b._grad[i] * tmp2;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> sinh (const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> sinh (const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::sinh(a._val), false);
+		Fwd<real_t, N> res(std::sinh(a._val), false);
 		const real_t tmp = std::cosh(a._val);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> cosh (const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> cosh (const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::cosh(a._val), false);
+		Fwd<real_t, N> res(std::cosh(a._val), false);
 		const real_t tmp = std::sinh(a._val);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> tanh (const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> tanh (const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::tanh(a._val), false);
+		Fwd<real_t, N> res(std::tanh(a._val), false);
 /*
 		const real_t tmp = real_t(1) - res._val * res._val;
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] * tmp;
 */
 		const real_t tmp = std::cosh(a._val);
 		const real_t tmp2 = tmp * tmp;
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = a._grad[i] / tmp2;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> fabs (const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> fabs (const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::abs(a._val), false);
+		Fwd<real_t, N> res(std::abs(a._val), false);
 		
 		if (a._val > real_t(0))
 		{
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = a._grad[i];
 		}
 		else if (a._val < real_t(0))
 		{
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = -a._grad[i];
 		}
 		else
 		{
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			{
 				if (a._grad[i] > real_t(0))
 					res._grad[i] = a._grad[i];
@@ -604,30 +618,30 @@ namespace sfad
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> ceil (const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> ceil (const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::ceil(a._val), false);
+		Fwd<real_t, N> res(std::ceil(a._val), false);
 		const real_t tmp(0);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> floor (const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> floor (const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(std::floor(a._val), false);
+		Fwd<real_t, N> res(std::floor(a._val), false);
 		const real_t tmp(0);
-		for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+		for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 			res._grad[i] = tmp;
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> fmax (const Fwd<real_t> &a, const Fwd<real_t> &b)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> fmax (const Fwd<real_t, N> &a, const Fwd<real_t, N> &b)
 	{
-		Fwd<real_t> res(real_t(0), false);
+		Fwd<real_t, N> res(real_t(0), false);
 		const real_t diff = a._val - b._val;
 		if (diff > real_t(0))
 		{
@@ -642,21 +656,21 @@ namespace sfad
 		else
 		{
 			res._val = b._val;
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = std::max(a._grad[i], b._grad[i]);
 		}
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> fmax (real_t v, const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> fmax (real_t v, const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(real_t(0), false);
+		Fwd<real_t, N> res(real_t(0), false);
 		const real_t diff = v - a._val;
 		if (diff > real_t(0))
 		{
 			res._val = v;
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = real_t(0);
 		}
 		else if (diff < real_t(0))
@@ -668,16 +682,16 @@ namespace sfad
 		{
 			res._val = a._val;
 			const real_t tmp(0);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = std::max(tmp, a._grad[i]);
 		}
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> fmax (const Fwd<real_t> &a, real_t v)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> fmax (const Fwd<real_t, N> &a, real_t v)
 	{
-		Fwd<real_t> res(real_t(0), false);
+		Fwd<real_t, N> res(real_t(0), false);
 		const real_t diff = a._val - v;
 		if (diff > real_t(0))
 		{
@@ -687,23 +701,23 @@ namespace sfad
 		else if (diff < real_t(0))
 		{
 			res._val = v;
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = real_t(0);
 		}
 		else
 		{
 			res._val = a._val;
 			const real_t tmp(0);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = std::max(tmp, a._grad[i]);
 		}
 		return res;
 	}
 	
-	template <typename real_t>
-	inline Fwd<real_t> fmin (const Fwd<real_t> &a, const Fwd<real_t> &b)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> fmin (const Fwd<real_t, N> &a, const Fwd<real_t, N> &b)
 	{
-		Fwd<real_t> res(real_t(0), false);
+		Fwd<real_t, N> res(real_t(0), false);
 		const real_t diff = a._val - b._val;
 		if (diff < real_t(0))
 		{
@@ -718,21 +732,21 @@ namespace sfad
 		else
 		{
 			res._val = b._val;
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = std::min(a._grad[i], b._grad[i]);
 		}
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> fmin (real_t v, const Fwd<real_t> &a)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> fmin (real_t v, const Fwd<real_t, N> &a)
 	{
-		Fwd<real_t> res(real_t(0), false);
+		Fwd<real_t, N> res(real_t(0), false);
 		const real_t diff = v - a._val;
 		if (diff < real_t(0))
 		{
 			res._val = v;
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = real_t(0);
 		}
 		else if (diff > real_t(0))
@@ -744,16 +758,16 @@ namespace sfad
 		{
 			res._val = a._val;
 			const real_t tmp(0);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = std::min(tmp, a._grad[i]);
 		}
 		return res;
 	}
 
-	template <typename real_t>
-	inline Fwd<real_t> fmin (const Fwd<real_t> &a, real_t v)
+	template <typename real_t, std::size_t N>
+	inline Fwd<real_t, N> fmin (const Fwd<real_t, N> &a, real_t v)
 	{
-		Fwd<real_t> res(real_t(0), false);
+		Fwd<real_t, N> res(real_t(0), false);
 		const real_t diff = a._val - v;
 		if (diff < real_t(0))
 		{
@@ -763,30 +777,30 @@ namespace sfad
 		else if (diff > real_t(0))
 		{
 			res._val = v;
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = real_t(0);
 		}
 		else
 		{
 			res._val = a._val;
 			const real_t tmp(0);
-			for (typename Fwd<real_t>::idx_t i = 0; i < detail::globalGradSize; ++i)
+			for (typename Fwd<real_t, N>::idx_t i = 0; i < detail::gradSize<N>(); ++i)
 				res._grad[i] = std::min(tmp, a._grad[i]);
 		}
 		return res;
 	}
 
-	template <typename real_t> inline Fwd<real_t> max (const Fwd<real_t> &a, const Fwd<real_t> &b) { return fmax(a, b); }
-	template <typename real_t> inline Fwd<real_t> max (real_t v, const Fwd<real_t> &a) { return fmax(v, a); }
-	template <typename real_t> inline Fwd<real_t> max (const Fwd<real_t> &a, real_t v) { return fmax(a, v); }
-	template <typename real_t> inline Fwd<real_t> min (const Fwd<real_t> &a, const Fwd<real_t> &b) { return fmin(a, b); }
-	template <typename real_t> inline Fwd<real_t> min (real_t v, const Fwd<real_t> &a) { return fmin(v, a); }
-	template <typename real_t> inline Fwd<real_t> min (const Fwd<real_t> &a, real_t v) { return fmin(a, v); }
+	template <typename real_t, std::size_t N> inline Fwd<real_t, N> max (const Fwd<real_t, N> &a, const Fwd<real_t, N> &b) { return fmax(a, b); }
+	template <typename real_t, std::size_t N> inline Fwd<real_t, N> max (real_t v, const Fwd<real_t, N> &a) { return fmax(v, a); }
+	template <typename real_t, std::size_t N> inline Fwd<real_t, N> max (const Fwd<real_t, N> &a, real_t v) { return fmax(a, v); }
+	template <typename real_t, std::size_t N> inline Fwd<real_t, N> min (const Fwd<real_t, N> &a, const Fwd<real_t, N> &b) { return fmin(a, b); }
+	template <typename real_t, std::size_t N> inline Fwd<real_t, N> min (real_t v, const Fwd<real_t, N> &a) { return fmin(v, a); }
+	template <typename real_t, std::size_t N> inline Fwd<real_t, N> min (const Fwd<real_t, N> &a, real_t v) { return fmin(a, v); }
 
-	template <typename real_t> inline Fwd<real_t> abs (const Fwd<real_t> &a) { return fabs(a); }
+	template <typename real_t, std::size_t N> inline Fwd<real_t, N> abs (const Fwd<real_t, N> &a) { return fabs(a); }
 
-	template <typename real_t>
-	void swap(Fwd<real_t>& x, Fwd<real_t>& y) SFAD_NOEXCEPT
+	template <typename real_t, std::size_t N>
+	void swap(Fwd<real_t, N>& x, Fwd<real_t, N>& y) SFAD_NOEXCEPT
 	{
 		using std::swap;
 		swap(x._val, y._val);
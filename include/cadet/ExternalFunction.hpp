@@ -73,6 +73,45 @@ public:
 	 */
 	virtual double timeDerivative(double t, double z, double rho, double r, unsigned int sec) = 0;
 
+	/**
+	 * @brief Returns the function values at a given time and multiple spatial positions
+	 * @details Evaluates externalProfile() at @p n positions for the same time @p t. Implementations
+	 *          can override this function to share work (e.g., locating @p t in a time grid) between
+	 *          the positions. The default implementation calls externalProfile() for each position.
+	 *
+	 * @param [in]  t       Absolute simulation time
+	 * @param [in]  z       Array with normalized axial positions in the column in [0,1]
+	 * @param [in]  rho     Array with normalized radial positions in the column in [0,1]
+	 * @param [in]  r       Array with normalized radial positions in the particle in [0,1]
+	 * @param [in]  n       Number of positions
+	 * @param [in]  sec     Index of the current time section
+	 * @param [out] out     Array with function values of length @p n
+	 */
+	virtual void externalProfileBatch(double t, double const* z, double const* rho, double const* r, unsigned int n, unsigned int sec, double* out)
+	{
+		for (unsigned int i = 0; i < n; ++i)
+			out[i] = externalProfile(t, z[i], rho[i], r[i], sec);
+	}
+
+	/**
+	 * @brief Returns the time derivatives of the function at a given time and multiple spatial positions
+	 * @details Evaluates timeDerivative() at @p n positions for the same time @p t.
+	 *          The default implementation calls timeDerivative() for each position.
+	 *
+	 * @param [in]  t       Absolute simulation time
+	 * @param [in]  z       Array with normalized axial positions in the column in [0,1]
+	 * @param [in]  rho     Array with normalized radial positions in the column in [0,1]
+	 * @param [in]  r       Array with normalized radial positions in the particle in [0,1]
+	 * @param [in]  n       Number of positions
+	 * @param [in]  sec     Index of the current time section
+	 * @param [out] out     Array with time derivatives of length @p n
+	 */
+	virtual void timeDerivativeBatch(double t, double const* z, double const* rho, double const* r, unsigned int n, unsigned int sec, double* out)
+	{
+		for (unsigned int i = 0; i < n; ++i)
+			out[i] = timeDerivative(t, z[i], rho[i], r[i], sec);
+	}
+
 	/**
 	 * @brief Sets the section time vector
 	 * @details The integration time is partitioned into sections. All parameters and
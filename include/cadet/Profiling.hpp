@@ -0,0 +1,99 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides runtime profiling functionality.
+ */
+
+#ifndef LIBCADET_PROFILING_HPP_
+#define LIBCADET_PROFILING_HPP_
+
+#include "cadet/LibExportImport.hpp"
+#include "cadet/cadetCompilerInfo.hpp"
+#include "cadet/ParameterId.hpp"
+
+namespace cadet
+{
+	/**
+	 * @brief Enables or disables the profiler
+	 * @details If enabled, nested scopes (e.g., residual, Jacobian, linear solve, consistent initialization)
+	 *          are recorded per thread and unit operation. Recorded data is kept when the profiler is
+	 *          disabled and can be discarded by resetProfile(). If disabled, the overhead of a scope
+	 *          is a single atomic load.
+	 * @param [in] enable Determines whether the profiler is enabled (@c true) or disabled (@c false)
+	 */
+	CADET_API void setProfilingEnabled(bool enable);
+
+	/**
+	 * @brief Returns whether the profiler is enabled
+	 * @return @c true if the profiler is enabled, otherwise @c false
+	 */
+	CADET_API bool isProfilingEnabled();
+
+	/**
+	 * @brief Discards all recorded profiling data and restarts the clock
+	 * @details Must not be called while other threads are inside a profiled scope.
+	 */
+	CADET_API void resetProfile();
+
+	/**
+	 * @brief Writes the recorded profiling data to a JSON file
+	 * @details The file uses the Chrome trace event format (JSON object format) and can be opened in
+	 *          @c chrome://tracing or Perfetto. Each recorded scope is a complete (@c X) event on the
+	 *          thread it was executed on, the unit operation is stored in its arguments. In addition, the
+	 *          @c summary field contains the call tree of each thread with number of calls, total and self
+	 *          time of each scope.
+	 * @param [in] fileName Name of the output file
+	 * @return @c true if the file has been written successfully, otherwise @c false
+	 */
+	CADET_API bool writeProfile(const char* fileName);
+
+	/**
+	 * @brief Opens a profiled scope on the current thread
+	 * @details Scopes have to be closed by endProfileScope() on the same thread in reverse order.
+	 *          Prefer ProfileScope to calling this function directly.
+	 * @param [in] name Name of the scope, has to stay valid until the profile is written or reset
+	 * @param [in] unitOpIdx Index of the unit operation the scope belongs to or @c UnitOpIndep
+	 * @return @c true if the scope has been opened (i.e., profiling is enabled), otherwise @c false
+	 */
+	CADET_API bool beginProfileScope(const char* name, UnitOpIdx unitOpIdx);
+
+	/**
+	 * @brief Closes the innermost profiled scope on the current thread
+	 */
+	CADET_API void endProfileScope();
+
+	/**
+	 * @brief Profiles the lifetime of the object as a scope
+	 */
+	class ProfileScope
+	{
+	public:
+		ProfileScope(const char* name) : _open(beginProfileScope(name, UnitOpIndep)) { }
+		ProfileScope(const char* name, UnitOpIdx unitOpIdx) : _open(beginProfileScope(name, unitOpIdx)) { }
+		~ProfileScope() CADET_NOEXCEPT
+		{
+			if (_open)
+				endProfileScope();
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		bool _open;
+	};
+
+} // namespace cadet
+
+#endif  // LIBCADET_PROFILING_HPP_
@@ -167,6 +167,23 @@ inline bool isValidConsistentInitialization(int ci) CADET_NOEXCEPT
 		&& (ci <= static_cast<typename std::underlying_type<ConsistentInitialization>::type>(ConsistentInitialization::NoneOnceThenLean));
 }
 
+/**
+ * @brief Snapshot of the time integration state of a simulator
+ * @details A snapshot holds the state vectors at a given time point and allows to resume
+ *          a time integration from that time point (see ISimulator::resume()). Since the
+ *          snapshot is plain data, it can be copied to many simulators that have been
+ *          configured with the same model (e.g., worker copies for parallel runs).
+ */
+struct SimulatorSnapshot
+{
+	double time; //!< Time point of the snapshot
+	unsigned int section; //!< Index of the section the snapshot has been taken in
+	std::vector<double> state; //!< State vector
+	std::vector<double> stateDot; //!< Time derivative of the state vector
+	std::vector<std::vector<double>> sensitivities; //!< Forward sensitivity state vectors (one per sensitive parameter)
+	std::vector<std::vector<double>> sensitivityDots; //!< Time derivatives of the forward sensitivity state vectors
+};
+
 /**
  * @brief Provides functionality to simulate a model using a time integrator
  */
@@ -498,6 +515,36 @@ public:
 	 */
 	virtual std::vector<double const*> getLastSensitivityDerivatives(unsigned int& len) const = 0;
 
+	/**
+	 * @brief Takes a snapshot of the current time integration state
+	 * @details The snapshot contains the last time point and the corresponding state vectors,
+	 *          including forward sensitivities. It can be taken after integrate() returned (e.g.,
+	 *          after a user abort in a INotificationCallback or at the end of a shortened simulation).
+	 * @return Snapshot of the time integration state
+	 */
+	virtual SimulatorSnapshot snapshot() const = 0;
+
+	/**
+	 * @brief Resumes time integration from a snapshot on the next call to integrate()
+	 * @details The next call to integrate() starts at the time point of the snapshot with its
+	 *          state vectors instead of the initial conditions. All section transitions up to the
+	 *          time point are replayed in the model (e.g., valve switches). If the time point lies
+	 *          inside a section, consistent initialization is skipped. This also applies to snapshots
+	 *          taken at the beginning of a section (i.e., in INotificationCallback::timeIntegrationSection()),
+	 *          whose state has already been initialized consistently. The time integrator is restarted
+	 *          at the time point just like at a section transition. Hence, resuming from a snapshot taken
+	 *          at the beginning of a section yields the same results as an uninterrupted simulation.
+	 *
+	 *          Only solutions after the time point of the snapshot are recorded. Sensitivities are
+	 *          only restored if the snapshot contains all sensitive parameters of this simulator,
+	 *          otherwise they are initialized consistently.
+	 *
+	 *          Since the snapshot is not tied to a particular simulator, it can be applied to any
+	 *          simulator with the same model and compatible section times.
+	 * @param [in] snap Snapshot to resume from
+	 */
+	virtual void resume(const SimulatorSnapshot& snap) = 0;
+
 	/**
 	 * @brief Returns the simulated model
 	 * @return Simulated model or @c NULL
@@ -570,7 +617,8 @@ public:
 
 	/**
 	 * @brief Sets the number of threads for the simulation
-	 * @details If the number of threads @p nThreads is @c 0, the maximum number of threads is used.
+	 * @details If the number of threads @p nThreads is @c 0, all threads of the calling task arena are used
+	 *          (by default, the maximum number of threads).
 	 * @param [in] nThreads Number of threads
 	 */
 	virtual void setNumThreads(unsigned int nThreads) CADET_NOEXCEPT = 0;
@@ -709,6 +757,35 @@ public:
 	 */
 	virtual void setMaxSensNewtonIteration(unsigned int nIter) = 0;
 
+	/**
+	 * @brief Selects the nonlinear corrector used for the forward sensitivity systems
+	 * @details By default, the staggered corrector is used, which solves the forward
+	 *          sensitivity systems one after another after the original system has
+	 *          converged. The simultaneous corrector solves the original system and
+	 *          all sensitivity systems in one combined Newton iteration. This reduces
+	 *          the number of corrector iterations and residual evaluations for many
+	 *          sensitive parameters.
+	 * 
+	 * @param [in] simultaneous Determines whether the simultaneous (@c true) or staggered (@c false) corrector is used
+	 */
+	virtual void setSimultaneousSensitivityCorrector(bool simultaneous) = 0;
+
+	/**
+	 * @brief Configures the cyclic steady state mode
+	 * @details In cyclic steady state mode, the configured sections form one cycle of a periodic
+	 *          process. The cycle is simulated repeatedly, starting each cycle from the state at the
+	 *          end of the previous one, until the state at the end of a cycle differs from the state
+	 *          at its beginning by less than the given tolerances in every degree of freedom. The
+	 *          fixed-point iteration on the cycle map can be accelerated by Anderson mixing. Only the
+	 *          final cycle is recorded, which is simulated from the converged state.
+	 *
+	 * @param [in] maxCycles Maximum number of simulated cycles including the recorded one (@c 0 or @c 1 disables the mode)
+	 * @param [in] relTol Relative tolerance of the cycle-to-cycle state difference
+	 * @param [in] absTol Absolute tolerance of the cycle-to-cycle state difference
+	 * @param [in] andersonDepth Number of previous cycles used by Anderson acceleration (@c 0 disables acceleration)
+	 */
+	virtual void configureCyclicSteadyState(unsigned int maxCycles, double relTol, double absTol, unsigned int andersonDepth) = 0;
+
 	/**
 	 * @brief Returns the elapsed time of the last simulation run in seconds
 	 * @return Elapsed time the last call of integrate() took in seconds
@@ -721,6 +798,23 @@ public:
 	 */
 	virtual double totalSimulationDuration() const CADET_NOEXCEPT = 0;
 
+	/**
+	 * @brief Returns the number of cycles simulated in the last simulation run
+	 * @details Is always @c 1 if the cyclic steady state mode is disabled.
+	 * @return Number of cycles simulated in the last call of integrate()
+	 */
+	virtual unsigned int lastNumCycles() const CADET_NOEXCEPT = 0;
+
+#ifdef CADET_BENCHMARK_MODE
+	/**
+	 * @brief Returns the number of heap allocations during steady-state time integration of the last simulation run
+	 * @details Counts all allocations via @c operator @c new that occur inside the time integrator,
+	 *          except for the first step of each section, which may set up internal memory.
+	 * @return Number of heap allocations in the last call of integrate()
+	 */
+	virtual std::size_t numHeapAllocationsTimeIntegration() const CADET_NOEXCEPT = 0;
+#endif
+
 	/**
 	 * @brief Sets the receiver for notifications
 	 * @param[in] nc Object to receive notifications or @c nullptr to disable notifications
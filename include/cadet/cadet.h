@@ -365,6 +365,48 @@ extern "C"
 	 */
 	typedef struct cdtDriver cdtDriver;
 
+	/**
+	 * @brief Identifies a parameter of the model system
+	 * @details Indices that do not apply to the parameter are set to @c -1.
+	 */
+	typedef struct
+	{
+		/**
+		 * @brief Name of the parameter
+		 */
+		const char* name;
+
+		/**
+		 * @brief Unit operation index
+		 */
+		int unitOperation;
+
+		/**
+		 * @brief Component index
+		 */
+		int component;
+
+		/**
+		 * @brief Particle type index
+		 */
+		int particleType;
+
+		/**
+		 * @brief Bound state index
+		 */
+		int boundState;
+
+		/**
+		 * @brief Reaction index
+		 */
+		int reaction;
+
+		/**
+		 * @brief Section index
+		 */
+		int section;
+	} cdtParameterId;
+
 	/**
 	 * Holds function pointers to API version 1
 	 */
@@ -1006,6 +1048,48 @@ extern "C"
 		 */
 		cdtResult (*getTimeSim)(cdtDriver* drv, double* timeSim);
 
+		/**
+		 * @brief Runs a batch of simulations that differ in the values of some parameters
+		 * @details The model system is configured once per worker from the parameter provider.
+		 *          Each variant is simulated by setting the given parameters to the values
+		 *          in the corresponding row of @p values, resetting the initial conditions,
+		 *          and running the time integration. The variants are distributed to a pool
+		 *          of workers, each of which owns a separate simulator. If the library is
+		 *          built without parallelization, a single worker runs all variants in order.
+		 *
+		 *          Only the outlet of unit operation @p unitOpId is recorded. The results are
+		 *          obtained by getBatchOutlet(). The solver should write the solution at fixed
+		 *          time points (@c USER_SOLUTION_TIMES) for the results to be comparable.
+		 * @param [in] drv Driver handle
+		 * @param [in] paramProvider Callback parameter provider
+		 * @param [in] params Array with @p nParams parameters that are varied
+		 * @param [in] nParams Number of parameters
+		 * @param [in] values Row-major matrix of size @p nVariants x @p nParams with parameter values
+		 * @param [in] nVariants Number of variants
+		 * @param [in] unitOpId ID of the unit operation whose outlet is recorded
+		 * @param [in] nWorkers Maximum number of workers (@c 0 to use all available threads)
+		 * @return @c cdtOK if all variants succeeded, @c cdtError if at least one failed,
+		 *         a negative value indicating the error otherwise
+		 */
+		cdtResult (*runSimulationBatch)(cdtDriver* drv, cdtParameterProvider const* paramProvider, cdtParameterId const* params, int nParams,
+			double const* values, int nVariants, int unitOpId, int nWorkers);
+
+		/**
+		 * @brief Returns the outlet of all variants of the last batch simulation
+		 * @details Before this function is called, runSimulationBatch() has to be called.
+		 *          The data array is laid out as @p nVariants x @p nTime x @p nPort x @p nComp
+		 *          (row-major). The array pointers are only valid until a new simulation is started.
+		 * @param [in] drv Driver handle
+		 * @param [out] time Time array pointer
+		 * @param [out] data Data array pointer
+		 * @param [out] status Array with the result code of each variant
+		 * @param [out] nVariants Number of variants
+		 * @param [out] nTime Number of time points
+		 * @param [out] nPort Number of ports
+		 * @param [out] nComp Number of components
+		 */
+		cdtResult (*getBatchOutlet)(cdtDriver* drv, double const** time, double const** data, cdtResult const** status, int* nVariants, int* nTime, int* nPort, int* nComp);
+
 	} cdtAPIv010000;
 
 	/**
@@ -34,6 +34,7 @@
 #include "cadet/StringUtil.hpp"
 #include "cadet/HashUtil.hpp"
 #include "cadet/Logging.hpp"
+#include "cadet/Profiling.hpp"
 #include "cadet/ParameterProvider.hpp"
 #include "cadet/ParameterId.hpp"
 #include "cadet/ExternalFunction.hpp"
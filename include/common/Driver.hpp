@@ -22,6 +22,7 @@
 #include <vector>
 #include <iomanip>
 #include <sstream>
+#include <chrono>
 
 #include "cadet/cadet.hpp"
 
@@ -169,6 +170,109 @@ void readSensitivityInitialState(ParamProvider_t& pp, const char* prefix, std::v
 	}
 }
 
+/**
+ * @brief Writes checkpoints of a running simulation at the beginning of time sections
+ * @details Forwards all notifications to another INotificationCallback. When a new time section is
+ *          entered and the given wall-clock interval has elapsed since the last checkpoint (or the
+ *          forwarded callback requests to stop the simulation), the streaming recorder is flushed
+ *          and a snapshot of the simulator is written to the checkpoint group of the writer along
+ *          with the number of time points in the output group. Snapshots taken at the beginning
+ *          of a section allow to resume the simulation without changing its results.
+ * @tparam Writer_t Type of the writer
+ */
+template <typename Writer_t>
+class CheckpointNotifier : public cadet::INotificationCallback
+{
+public:
+	CheckpointNotifier(cadet::ISimulator& sim, StreamingSystemRecorder<Writer_t>& streamRec, Writer_t& writer, cadet::INotificationCallback* forward, double interval) :
+		_sim(sim), _streamRec(streamRec), _writer(writer), _forward(forward), _interval(interval), _lastCheckpoint(std::chrono::steady_clock::now())
+	{
+	}
+
+	virtual ~CheckpointNotifier() CADET_NOEXCEPT { }
+
+	virtual void timeIntegrationStart()
+	{
+		_lastCheckpoint = std::chrono::steady_clock::now();
+		if (_forward)
+			_forward->timeIntegrationStart();
+	}
+
+	virtual void timeIntegrationEnd()
+	{
+		if (_forward)
+			_forward->timeIntegrationEnd();
+	}
+
+	virtual void timeIntegrationError(char const* message, unsigned int section, double time, double progress)
+	{
+		if (_forward)
+			_forward->timeIntegrationError(message, section, time, progress);
+	}
+
+	virtual bool timeIntegrationSection(unsigned int section, double time, double const* state, double const* stateDot, double progress)
+	{
+		const bool cont = !_forward || _forward->timeIntegrationSection(section, time, state, stateDot, progress);
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - _lastCheckpoint;
+		if (!cont || (elapsed.count() >= _interval))
+		{
+			writeCheckpoint();
+			_lastCheckpoint = std::chrono::steady_clock::now();
+		}
+		return cont;
+	}
+
+	virtual bool timeIntegrationStep(unsigned int section, double time, double const* state, double const* stateDot, double progress)
+	{
+		return !_forward || _forward->timeIntegrationStep(section, time, state, stateDot, progress);
+	}
+
+protected:
+
+	void writeCheckpoint()
+	{
+		// Make sure that all time points up to the checkpoint are on disk
+		_streamRec.flush();
+
+		const cadet::SimulatorSnapshot snap = _sim.snapshot();
+		LOG(Debug) << "Writing checkpoint at t = " << snap.time << " (section " << snap.section << ", " << _streamRec.numDataPointsWritten() << " data points)";
+
+		// The checkpoint replaces the previous one instead of being appended to it
+		_writer.appendFields(false);
+		_writer.unlinkGroup("checkpoint");
+		_writer.pushGroup("checkpoint");
+
+		_writer.template scalar<double>("TIME", snap.time);
+		_writer.template scalar<int>("SECTION", static_cast<int>(snap.section));
+		_writer.template scalar<int>("NUM_DATA_POINTS", static_cast<int>(_streamRec.numDataPointsWritten()));
+		_writer.template vector<double>("STATE_Y", snap.state);
+		_writer.template vector<double>("STATE_YDOT", snap.stateDot);
+
+		std::ostringstream oss;
+		for (std::size_t i = 0; i < snap.sensitivities.size(); ++i)
+		{
+			oss.str("");
+			oss << "SENS_Y_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << i;
+			_writer.template vector<double>(oss.str(), snap.sensitivities[i]);
+
+			oss.str("");
+			oss << "SENS_YDOT_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << i;
+			_writer.template vector<double>(oss.str(), snap.sensitivityDots[i]);
+		}
+
+		_writer.popGroup();
+		_writer.appendFields(true);
+		_writer.flush();
+	}
+
+	cadet::ISimulator& _sim;
+	StreamingSystemRecorder<Writer_t>& _streamRec;
+	Writer_t& _writer;
+	cadet::INotificationCallback* _forward;
+	double _interval;
+	std::chrono::steady_clock::time_point _lastCheckpoint;
+};
+
 } // namespace detail
 
 /**
@@ -179,7 +283,9 @@ void readSensitivityInitialState(ParamProvider_t& pp, const char* prefix, std::v
 class Driver
 {
 public:
-	Driver() : _sim(nullptr), _builder(nullptr), _storage(nullptr), _writeLastState(false), _writeLastStateSens(false)
+	Driver() : _sim(nullptr), _builder(nullptr), _storage(nullptr), _writeLastState(false), _writeLastStateSens(false),
+		_streamSolution(false), _streamBufferSize(detail::numDefaultRecorderTimesteps), _solutionStreamed(false),
+		_checkpointInterval(0.0), _resumeDataPoints(0), _resumed(false), _notification(nullptr)
 	{
 		_builder = cadetCreateModelBuilder();
 	}
@@ -260,26 +366,28 @@ public:
 		_sim->setSectionTimes(secTimes, secCont);
 
 		// Specify initial values
+		_initStateY.clear();
+		_initStateYdot.clear();
 		if (pp.exists("INIT_STATE_Y"))
 		{
-			const std::vector<double> initY = pp.getDoubleArray("INIT_STATE_Y");
-			if (initY.size() != _sim->numDofs())
+			_initStateY = pp.getDoubleArray("INIT_STATE_Y");
+			if (_initStateY.size() != _sim->numDofs())
 			{
 				throw InvalidParameterException("Length of INIT_STATE_Y should be equal to NDOF");
 			}
 
 			if (pp.exists("INIT_STATE_YDOT"))
 			{
-				const std::vector<double> initYdot = pp.getDoubleArray("INIT_STATE_YDOT");
-				if (initYdot.size() != _sim->numDofs())
+				_initStateYdot = pp.getDoubleArray("INIT_STATE_YDOT");
+				if (_initStateYdot.size() != _sim->numDofs())
 				{
 					throw InvalidParameterException("Length of INIT_STATE_YDOT should be equal to NDOF");
 				}
-				_sim->applyInitialCondition(initY.data(), initYdot.data());
+				_sim->applyInitialCondition(_initStateY.data(), _initStateYdot.data());
 			}
 			else
 			{
-				_sim->applyInitialCondition(initY.data());
+				_sim->applyInitialCondition(_initStateY.data());
 			}
 		}
 		else
@@ -364,6 +472,8 @@ public:
 
 		// Set storage for solution
 		_sim->setSolutionRecorder(_storage);
+		_sim->setNotificationCallback(_notification);
+		_resumed = false;
 	}
 
 	/**
@@ -412,6 +522,29 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Applies the initial conditions of the last configuration again
+	 * @details Restores the state vectors given by @c INIT_STATE_Y and @c INIT_STATE_YDOT, if
+	 *          they were present. Otherwise, the initial conditions of the model are applied
+	 *          using the current parameter values. Sensitivities are reset to their default
+	 *          initial values. Assumes that the simulator is already configured.
+	 */
+	void resetInitialCondition()
+	{
+		if (!_initStateY.empty())
+		{
+			if (!_initStateYdot.empty())
+				_sim->applyInitialCondition(_initStateY.data(), _initStateYdot.data());
+			else
+				_sim->applyInitialCondition(_initStateY.data());
+		}
+		else
+			_sim->applyInitialCondition();
+
+		if (_sim->numSensParams() > 0)
+			_sim->initializeFwdSensitivities();
+	}
+
 	/**
 	 * @brief Sets section times and section continuity from the given parameter provider
 	 * @details Assumes that the simulator is already configured
@@ -455,6 +588,25 @@ public:
 		else
 			_writeLastState = false;
 
+		if (pp.exists("STREAM_SOLUTION"))
+			_streamSolution = pp.getBool("STREAM_SOLUTION");
+		else
+			_streamSolution = false;
+
+		if (pp.exists("STREAM_BUFFER_SIZE"))
+			_streamBufferSize = std::max(pp.getInt("STREAM_BUFFER_SIZE"), 1);
+		else
+			_streamBufferSize = detail::numDefaultRecorderTimesteps;
+
+		// Checkpoints are only consistent with the output if the solution is streamed
+		if (pp.exists("CHECKPOINT_INTERVAL"))
+			_checkpointInterval = std::max(pp.getDouble("CHECKPOINT_INTERVAL"), 0.0);
+		else
+			_checkpointInterval = 0.0;
+
+		if (_checkpointInterval > 0.0)
+			_streamSolution = true;
+
 		std::ostringstream oss;
 		for (int i = 0; i <= _sim->model()->maxUnitOperationId(); ++i)
 		{
@@ -511,10 +663,114 @@ public:
 	 */
 	void run()
 	{
+		_solutionStreamed = false;
+
 		// Run simulation
 		_sim->integrate();
 	}
 
+	/**
+	 * @brief Performs time integration and streams solution and sensitivities to the given writer
+	 * @details The simulator has to be setup and configured for time integration. The writer
+	 *          has to support appending to fields (see StreamingSystemRecorder) and must stay
+	 *          open until write() has been called. Results are appended to the output group
+	 *          every streamBufferSize() time steps. Data recorded before an error or an abort
+	 *          is written before leaving this function.
+	 * @param [in] writer Writer to stream the results to
+	 * @tparam Writer_t Type of the writer
+	 */
+	template <typename Writer_t>
+	void run(Writer_t& writer)
+	{
+		if (_resumed)
+		{
+			// Discard time points that have been written after the checkpoint
+			writer.truncateFields("output", _resumeDataPoints);
+		}
+		else
+			writer.unlinkGroup("output");
+
+		writer.compressFields(true);
+		writer.appendFields(true);
+
+		StreamingSystemRecorder<Writer_t> streamRec(*_storage, writer, _streamBufferSize);
+		_sim->setSolutionRecorder(&streamRec);
+		_solutionStreamed = true;
+
+		detail::CheckpointNotifier<Writer_t> checkpointer(*_sim, streamRec, writer, _notification, _checkpointInterval);
+		if (_checkpointInterval > 0.0)
+			_sim->setNotificationCallback(&checkpointer);
+
+		try
+		{
+			// Run simulation
+			_sim->integrate();
+		}
+		catch (...)
+		{
+			streamRec.flush();
+			writer.appendFields(false);
+			_sim->setSolutionRecorder(_storage);
+			_sim->setNotificationCallback(_notification);
+			throw;
+		}
+
+		streamRec.flush();
+		writer.appendFields(false);
+		_sim->setSolutionRecorder(_storage);
+		_sim->setNotificationCallback(_notification);
+		_resumed = false;
+	}
+
+	/**
+	 * @brief Resumes the next simulation from the checkpoint stored by a previous run
+	 * @details Reads the checkpoint group written by run() with checkpoints enabled (see
+	 *          CHECKPOINT_INTERVAL) and applies it to the simulator. The next call to
+	 *          run() with a writer continues the time integration at the checkpoint and
+	 *          appends to the output group of the file, which is truncated to the time points
+	 *          recorded before the checkpoint. The simulator has to be configured with the same
+	 *          setup as the checkpointed run.
+	 * @param [in] reader Reader of the file that contains the checkpoint
+	 * @tparam Reader_t Type of the reader
+	 */
+	template <typename Reader_t>
+	void resume(Reader_t& reader)
+	{
+		if (!reader.exists("checkpoint"))
+			throw InvalidParameterException("File does not contain a checkpoint");
+
+		reader.pushGroup("checkpoint");
+
+		cadet::SimulatorSnapshot snap;
+		snap.time = reader.template scalar<double>("TIME");
+		snap.section = reader.template scalar<int>("SECTION");
+		snap.state = reader.template vector<double>("STATE_Y");
+		snap.stateDot = reader.template vector<double>("STATE_YDOT");
+
+		std::ostringstream oss;
+		for (unsigned int i = 0; ; ++i)
+		{
+			oss.str("");
+			oss << "SENS_Y_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << i;
+			if (!reader.exists(oss.str()))
+				break;
+
+			snap.sensitivities.push_back(reader.template vector<double>(oss.str()));
+
+			oss.str("");
+			oss << "SENS_YDOT_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << i;
+			snap.sensitivityDots.push_back(reader.template vector<double>(oss.str()));
+		}
+
+		_resumeDataPoints = reader.template scalar<int>("NUM_DATA_POINTS");
+		reader.popGroup();
+
+		_sim->resume(snap);
+		_resumed = true;
+
+		LOG(Debug) << "Resuming from checkpoint at t = " << snap.time << " (section " << snap.section << ", " << _resumeDataPoints << " data points)";
+	}
+
 	/**
 	 * @brief Writes the current results to the given writer
 	 * @param [in] writer Writer to write to
@@ -526,10 +782,13 @@ public:
 		if (!_sim || !_storage)
 			return;
 
-		LOG(Debug) << "Writing " << _storage->numDataPoints() << " data points to file";
+		// Solution and sensitivities have already been written if they were streamed
+		if (!_solutionStreamed)
+		{
+			LOG(Debug) << "Writing " << _storage->numDataPoints() << " data points to file";
+			writer.unlinkGroup("output");
+		}
 
-		writer.unlinkGroup("output");
-		
 		writer.extendibleFields(false);
 		writer.compressFields(true);
 
@@ -542,15 +801,18 @@ public:
 			writer.popGroup();
 		}
 
-		writer.pushGroup("solution");
-		_storage->writeSolution(writer);
-		writer.popGroup();
-
-		if (_sim->numSensParams() > 0)
+		if (!_solutionStreamed)
 		{
-			writer.pushGroup("sensitivity");
-			_storage->writeSensitivity(writer);
+			writer.pushGroup("solution");
+			_storage->writeSolution(writer);
 			writer.popGroup();
+
+			if (_sim->numSensParams() > 0)
+			{
+				writer.pushGroup("sensitivity");
+				_storage->writeSensitivity(writer);
+				writer.popGroup();
+			}
 		}
 
 		if (_writeLastState)
@@ -724,7 +986,25 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Sets the receiver for notifications of the simulator
+	 * @details The receiver is kept when the simulator is configured again.
+	 * @param [in] nc Object to receive notifications or @c nullptr to disable notifications
+	 */
+	inline void setNotificationCallback(cadet::INotificationCallback* nc) CADET_NOEXCEPT
+	{
+		_notification = nc;
+		if (_sim)
+			_sim->setNotificationCallback(nc);
+	}
+
 	inline void setWriteLastState(bool writeLastState) CADET_NOEXCEPT { _writeLastState = writeLastState; }
+	inline void setStreamSolution(bool streamSolution) CADET_NOEXCEPT { _streamSolution = streamSolution; }
+	inline bool streamSolution() const CADET_NOEXCEPT { return _streamSolution; }
+	inline void setStreamBufferSize(unsigned int bufferSize) CADET_NOEXCEPT { _streamBufferSize = std::max(bufferSize, 1u); }
+	inline unsigned int streamBufferSize() const CADET_NOEXCEPT { return _streamBufferSize; }
+	inline void setCheckpointInterval(double interval) CADET_NOEXCEPT { _checkpointInterval = std::max(interval, 0.0); }
+	inline double checkpointInterval() const CADET_NOEXCEPT { return _checkpointInterval; }
 	inline void setWriteLastStateSens(bool writeLastState) CADET_NOEXCEPT { _writeLastStateSens = writeLastState; }
 	inline void setWriteSolutionTimes(bool solTimes) CADET_NOEXCEPT
 	{
@@ -745,6 +1025,17 @@ protected:
 	bool _writeLastStateSens;
 	std::vector<UnitOpIdx> _writeLastStateSensUnitId;
 
+	std::vector<double> _initStateY; //!< Initial state vector from the last configuration (empty if not given)
+	std::vector<double> _initStateYdot; //!< Initial time derivative of the state vector from the last configuration (empty if not given)
+
+	bool _streamSolution; //!< Determines whether solution and sensitivities are written during time integration
+	unsigned int _streamBufferSize; //!< Number of time steps buffered before they are streamed to the writer
+	bool _solutionStreamed; //!< Determines whether the results of the last run have already been written
+	double _checkpointInterval; //!< Minimum wall-clock time in seconds between two checkpoints (@c 0 disables checkpoints)
+	unsigned int _resumeDataPoints; //!< Number of time points in the output before the checkpoint to resume from
+	bool _resumed; //!< Determines whether the next run resumes from a checkpoint
+	cadet::INotificationCallback* _notification; //!< Receiver of notifications (not owned by this driver)
+
 	/**
 	 * @brief Sets section times and section continuity from the given parameter provider
 	 * @details Assumes that the simulator is already configured
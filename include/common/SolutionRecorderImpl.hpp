@@ -24,6 +24,7 @@
 #include <numeric>
 
 #include "cadet/SolutionRecorder.hpp"
+#include "cadet/Profiling.hpp"
 
 namespace cadet
 {
@@ -82,6 +83,16 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Removes all stored data points but keeps structure, configuration, and allocated memory
+	 * @details Used for writing the solution in chunks while the time integration is running.
+	 */
+	inline void discardDataPoints()
+	{
+		clear();
+		_numTimesteps = 0;
+	}
+
 	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
 	{
 		_numTimesteps = numTimesteps;
@@ -990,6 +1001,18 @@ public:
 			rec->clear();
 	}
 
+	/**
+	 * @brief Removes all stored data points but keeps structure, configuration, and allocated memory
+	 */
+	inline void discardDataPoints()
+	{
+		_time.clear();
+		_numTimesteps = 0;
+
+		for (InternalStorageUnitOpRecorder* rec : _recorders)
+			rec->discardDataPoints();
+	}
+
 	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
 	{
 		_numSens = numSens;
@@ -1233,6 +1256,122 @@ protected:
 };
 
 
+/**
+ * @brief Writes the solution of the whole model system to a file while the time integration is running
+ * @details Wraps an InternalStorageSystemRecorder that buffers a fixed number of time steps. Once the
+ *          buffer is full, its contents are appended to the output group of the writer and discarded.
+ *          Hence, memory consumption is bounded and a terminated simulation leaves partial results
+ *          on disk. The writer is expected to be in append mode (i.e., to extend existing fields along
+ *          their first dimension). The wrapped recorder is not owned by this object.
+ * @tparam Writer_t Type of the writer
+ */
+template <typename Writer_t>
+class StreamingSystemRecorder : public ISolutionRecorder
+{
+public:
+
+	StreamingSystemRecorder(InternalStorageSystemRecorder& storage, Writer_t& writer, unsigned int bufferSize) : _storage(storage), _writer(writer),
+		_bufferSize(std::max(bufferSize, 1u)), _numWritten(0)
+	{
+	}
+
+	virtual ~StreamingSystemRecorder() CADET_NOEXCEPT
+	{
+	}
+
+	virtual void clear()
+	{
+		_storage.clear();
+	}
+
+	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
+	{
+		_storage.prepare(numDofs, numSens, _bufferSize);
+	}
+
+	virtual void notifyIntegrationStart(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
+	{
+		_numWritten = 0;
+		_storage.notifyIntegrationStart(numDofs, numSens, _bufferSize);
+	}
+
+	virtual void unitOperationStructure(UnitOpIdx idx, const IModel& model, const ISolutionExporter& exporter)
+	{
+		_storage.unitOperationStructure(idx, model, exporter);
+	}
+
+	virtual void beginTimestep(double t)
+	{
+		_storage.beginTimestep(t);
+	}
+
+	virtual void beginUnitOperation(cadet::UnitOpIdx idx, const cadet::IModel& model, const cadet::ISolutionExporter& exporter)
+	{
+		_storage.beginUnitOperation(idx, model, exporter);
+	}
+
+	virtual void endUnitOperation()
+	{
+		_storage.endUnitOperation();
+	}
+
+	virtual void endTimestep()
+	{
+		_storage.endTimestep();
+
+		if (_storage.numDataPoints() >= _bufferSize)
+			flush();
+	}
+
+	virtual void beginSolution() { _storage.beginSolution(); }
+	virtual void endSolution() { _storage.endSolution(); }
+	virtual void beginSolutionDerivative() { _storage.beginSolutionDerivative(); }
+	virtual void endSolutionDerivative() { _storage.endSolutionDerivative(); }
+	virtual void beginSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx) { _storage.beginSensitivity(pId, sensIdx); }
+	virtual void endSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx) { _storage.endSensitivity(pId, sensIdx); }
+	virtual void beginSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx) { _storage.beginSensitivityDerivative(pId, sensIdx); }
+	virtual void endSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx) { _storage.endSensitivityDerivative(pId, sensIdx); }
+
+	/**
+	 * @brief Appends all buffered time steps to the output group of the writer and empties the buffer
+	 */
+	void flush()
+	{
+		if (_storage.numDataPoints() == 0)
+			return;
+
+		ProfileScope ps("flush solution");
+		_writer.pushGroup("output");
+
+		_writer.pushGroup("solution");
+		_storage.writeSolution(_writer);
+		_writer.popGroup();
+
+		if (_storage.numSensitivites() > 0)
+		{
+			_writer.pushGroup("sensitivity");
+			_storage.writeSensitivity(_writer);
+			_writer.popGroup();
+		}
+
+		_writer.popGroup();
+		_writer.flush();
+
+		_numWritten += _storage.numDataPoints();
+		_storage.discardDataPoints();
+	}
+
+	inline unsigned int bufferSize() const CADET_NOEXCEPT { return _bufferSize; }
+	inline unsigned int numDataPointsWritten() const CADET_NOEXCEPT { return _numWritten; }
+
+protected:
+
+	InternalStorageSystemRecorder& _storage;
+	Writer_t& _writer;
+	unsigned int _bufferSize;
+	unsigned int _numWritten;
+};
+
 } // namespace cadet
 
 #endif  // LIBCADET_SOLUTIONRECORDER_IMPL_HPP_
@@ -0,0 +1,608 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#ifndef HDF5CACHEDREADER_HPP_
+#define HDF5CACHEDREADER_HPP_
+
+#include <vector>
+#include <string>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <limits>
+#include <utility>
+#include <cmath>
+
+#include "cadet/cadetCompilerInfo.hpp"
+
+#include "HDF5Base.hpp"
+
+namespace cadet
+{
+
+namespace io
+{
+
+/**
+ * @brief HDF5 reader that serves all requests from an in-memory copy of the file
+ * @details When the file is opened, only the links of the root group are listed. The first access to
+ *          a top-level group (e.g., @c /input) reads the complete subtree of that group in a single
+ *          traversal. Each dataset is opened and read exactly once, all subsequent queries
+ *          (existence, type, dimensions, values) are answered from the cache without touching
+ *          the file. Top-level groups that are never accessed (e.g., a large @c /output group)
+ *          are not read at all.
+ *
+ *          Numeric values are stored in the type class of the dataset (64 bit signed or unsigned
+ *          integer, or double) and converted on request, saturating values that are out of range.
+ */
+class HDF5CachedReader : public HDF5Base
+{
+public:
+	/// \brief Constructor
+	inline HDF5CachedReader();
+
+	/// \brief Destructor
+	inline ~HDF5CachedReader() CADET_NOEXCEPT;
+
+	/// \brief Open an HDF5 file and index its root group
+	inline void openFile(const std::string& fileName, const std::string& mode = "r");
+	inline void openFile(const char* fileName, const std::string& mode = "r") { openFile(std::string(fileName), mode); }
+
+	/// \brief Close the currently opened file and discard the cache
+	inline void closeFile();
+
+	/// \brief Checks if the given dataset or group exists in the file
+	inline bool exists(const std::string& elementName);
+
+	/// \brief Checks if the given dataset is a vector (i.e., has more than one value)
+	inline bool isVector(const std::string& elementName);
+
+	/// \brief Checks if the given dataset is a string
+	inline bool isString(const std::string& elementName) { return dataset(elementName).type == DataType::String; }
+
+	/// \brief Checks if the given dataset is a signed int
+	inline bool isInt(const std::string& elementName) { return dataset(elementName).nativeInt; }
+
+	/// \brief Checks if the given dataset is a double
+	inline bool isDouble(const std::string& elementName) { return dataset(elementName).nativeDouble; }
+
+	/// \brief Checks whether the given element is a group
+	inline bool isGroup(const std::string& elementName);
+
+	/// \brief Returns the dimensions of the tensor identified by name
+	inline std::vector<std::size_t> tensorDimensions(const std::string& elementName) { return dataset(elementName).dims; }
+
+	/// \brief Returns the number of elements in the array identified by name
+	inline std::size_t arraySize(const std::string& elementName) { return dataset(elementName).size(); }
+
+	/// \brief Returns the number of items in the group
+	inline int numItems() { return static_cast<int>(currentGroup().items.size()); }
+
+	/// \brief Returns the name of the n-th item in the group
+	inline std::string itemName(int n) { return currentGroup().items.at(n); }
+
+	/// \brief Returns the names of all items in the group
+	inline std::vector<std::string> itemNames() { return currentGroup().items; }
+
+	/// \brief Convenience wrapper for reading vectors
+	template <typename T>
+	std::vector<T> vector(const std::string& dataSetName);
+
+	/// \brief Convenience wrapper for reading scalars
+	template <typename T>
+	T scalar(const std::string& dataSetName, std::size_t position = 0);
+
+private:
+
+	enum class DataType : int
+	{
+		Integer,
+		UnsignedInteger,
+		Double,
+		String,
+		Unsupported
+	};
+
+	struct Node
+	{
+		bool group; //!< Determines whether the node is a group or a dataset
+		bool loaded; //!< Determines whether the children of a group have been read
+
+		std::map<std::string, std::unique_ptr<Node>> children; //!< Items of a group
+		std::vector<std::string> items; //!< Item names of a group in HDF5 iteration order
+
+		DataType type; //!< Type of the dataset
+		bool nativeInt; //!< Determines whether the dataset has native type @c int
+		bool nativeDouble; //!< Determines whether the dataset has native type @c double
+		std::vector<std::size_t> dims; //!< Dimensions of the dataset
+
+		std::vector<int64_t> intData;
+		std::vector<uint64_t> uintData;
+		std::vector<double> doubleData;
+		std::vector<std::string> stringData;
+
+		Node(bool isGroup) : group(isGroup), loaded(false), type(DataType::Unsupported), nativeInt(false), nativeDouble(false) { }
+
+		inline std::size_t size() const
+		{
+			switch (type)
+			{
+				case DataType::Integer: return intData.size();
+				case DataType::UnsignedInteger: return uintData.size();
+				case DataType::Double: return doubleData.size();
+				case DataType::String: return stringData.size();
+				default: break;
+			}
+
+			std::size_t n = 1;
+			for (std::size_t d : dims)
+				n *= d;
+			return n;
+		}
+	};
+
+	struct TraversalState
+	{
+		HDF5CachedReader* reader;
+		Node* node;
+		bool recursive;
+		std::string path;
+		std::string error;
+	};
+
+	std::unique_ptr<Node> _root;
+
+	inline void loadGroup(hid_t grp, Node& node, const std::string& path, bool recursive);
+	inline void readDataset(hid_t dataSet, Node& node, const std::string& path);
+	static inline herr_t visitLink(hid_t grp, const char* name, const H5L_info_t* info, void* opData);
+
+	inline void ensureLoaded(Node& node, const std::string& path);
+	inline Node* findNode(const std::string& elementName, std::string* nodePath = nullptr);
+	inline Node& currentGroup();
+	inline const Node& dataset(const std::string& elementName);
+
+	template <typename T, typename S>
+	static T convertNumeric(S val);
+
+	template <typename T>
+	T value(const Node& node, std::size_t position, const std::string& dataSetName);
+};
+
+
+HDF5CachedReader::HDF5CachedReader() { }
+
+HDF5CachedReader::~HDF5CachedReader() CADET_NOEXCEPT { }
+
+
+void HDF5CachedReader::openFile(const std::string& fileName, const std::string& mode)
+{
+	if (mode != "r")
+		throw IOException("Cached HDF5 reader only supports read mode");
+
+	HDF5Base::openFile(fileName, mode);
+
+	// Index the root group, but defer reading its subgroups until they are accessed
+	_root = std::make_unique<Node>(true);
+	const hid_t grp = H5Gopen2(_file, "/", H5P_DEFAULT);
+	try
+	{
+		loadGroup(grp, *_root, "", false);
+	}
+	catch (...)
+	{
+		H5Gclose(grp);
+		HDF5Base::closeFile();
+		_root.reset();
+		throw;
+	}
+	H5Gclose(grp);
+}
+
+
+void HDF5CachedReader::closeFile()
+{
+	_root.reset();
+	HDF5Base::closeFile();
+}
+
+
+bool HDF5CachedReader::exists(const std::string& elementName)
+{
+	return findNode(elementName) != nullptr;
+}
+
+
+bool HDF5CachedReader::isVector(const std::string& elementName)
+{
+	const Node* const node = findNode(elementName);
+	if (!node || node->group)
+		return false;
+
+	return node->size() > 1;
+}
+
+
+bool HDF5CachedReader::isGroup(const std::string& elementName)
+{
+	const Node* const node = findNode(elementName);
+	if (!node)
+		throw IOException("Field \"" + elementName + "\" does not exist in group " + getFullGroupName());
+
+	return node->group;
+}
+
+
+template <typename T>
+std::vector<T> HDF5CachedReader::vector(const std::string& dataSetName)
+{
+	const Node& node = dataset(dataSetName);
+	const std::size_t n = node.size();
+
+	std::vector<T> data;
+	data.reserve(n);
+	for (std::size_t i = 0; i < n; ++i)
+		data.push_back(value<T>(node, i, dataSetName));
+
+	return data;
+}
+
+
+template <typename T>
+T HDF5CachedReader::scalar(const std::string& dataSetName, std::size_t position)
+{
+	const Node& node = dataset(dataSetName);
+	if (position >= node.size())
+		throw std::out_of_range("Position " + std::to_string(position) + " exceeds size of field \"" + dataSetName + "\"");
+
+	return value<T>(node, position, dataSetName);
+}
+
+
+template <typename T, typename S>
+T HDF5CachedReader::convertNumeric(S val)
+{
+	if constexpr (std::is_integral_v<T>)
+	{
+		// Saturate out-of-range values like the conversion routines of the HDF5 library
+		if constexpr (std::is_floating_point_v<S>)
+		{
+			if (std::isnan(val))
+				return 0;
+			if (val <= static_cast<S>(std::numeric_limits<T>::min()))
+				return std::numeric_limits<T>::min();
+			if (val >= static_cast<S>(std::numeric_limits<T>::max()))
+				return std::numeric_limits<T>::max();
+		}
+		else
+		{
+			if (std::cmp_less(val, std::numeric_limits<T>::min()))
+				return std::numeric_limits<T>::min();
+			if (std::cmp_greater(val, std::numeric_limits<T>::max()))
+				return std::numeric_limits<T>::max();
+		}
+	}
+
+	return static_cast<T>(val);
+}
+
+
+template <typename T>
+T HDF5CachedReader::value(const Node& node, std::size_t position, const std::string& dataSetName)
+{
+	if constexpr (std::is_same_v<T, std::string>)
+	{
+		if (node.type != DataType::String)
+			throw IOException("Field \"" + dataSetName + "\" in group " + getFullGroupName() + " is not a string");
+
+		return node.stringData[position];
+	}
+	else if constexpr (std::is_same_v<T, double> || std::is_same_v<T, int> || std::is_same_v<T, uint64_t>)
+	{
+		switch (node.type)
+		{
+			case DataType::Integer: return convertNumeric<T>(node.intData[position]);
+			case DataType::UnsignedInteger: return convertNumeric<T>(node.uintData[position]);
+			case DataType::Double: return convertNumeric<T>(node.doubleData[position]);
+			case DataType::String:
+				throw IOException("Field \"" + dataSetName + "\" in group " + getFullGroupName() + " is not numeric");
+			default:
+				throw IOException("Field \"" + dataSetName + "\" in group " + getFullGroupName() + " has an unsupported data type");
+		}
+	}
+	else
+		throw IOException("You may not try to read an unsupported type");
+}
+
+
+void HDF5CachedReader::loadGroup(hid_t grp, Node& node, const std::string& path, bool recursive)
+{
+	TraversalState state{this, &node, recursive, path, ""};
+	const herr_t status = H5Literate(grp, H5_INDEX_NAME, H5_ITER_INC, nullptr, &HDF5CachedReader::visitLink, &state);
+
+	if (!state.error.empty())
+		throw IOException(state.error);
+	if (status < 0)
+		throw IOException("Failed to iterate over group \"" + (path.empty() ? std::string("/") : path) + "\"");
+
+	node.loaded = recursive;
+}
+
+
+herr_t HDF5CachedReader::visitLink(hid_t grp, const char* name, const H5L_info_t* info, void* opData)
+{
+	TraversalState& state = *static_cast<TraversalState*>(opData);
+	const std::string path = state.path + "/" + name;
+
+	// Exceptions must not propagate through the HDF5 library
+	try
+	{
+		const hid_t obj = H5Oopen(grp, name, H5P_DEFAULT);
+
+		// Skip dangling links
+		if (obj < 0)
+			return 0;
+
+		const H5I_type_t oType = H5Iget_type(obj);
+		std::unique_ptr<Node> child;
+
+		if (oType == H5I_GROUP)
+		{
+			child = std::make_unique<Node>(true);
+			try
+			{
+				if (state.recursive)
+					state.reader->loadGroup(obj, *child, path, true);
+			}
+			catch (...)
+			{
+				H5Oclose(obj);
+				throw;
+			}
+		}
+		else if (oType == H5I_DATASET)
+		{
+			child = std::make_unique<Node>(false);
+			try
+			{
+				state.reader->readDataset(obj, *child, path);
+			}
+			catch (...)
+			{
+				H5Oclose(obj);
+				throw;
+			}
+		}
+
+		H5Oclose(obj);
+
+		// Named datatypes are not items of interest
+		if (!child)
+			return 0;
+
+		state.node->items.push_back(name);
+		state.node->children[name] = std::move(child);
+	}
+	catch (const std::exception& e)
+	{
+		state.error = e.what();
+		return -1;
+	}
+
+	return 0;
+}
+
+
+void HDF5CachedReader::readDataset(hid_t dataSet, Node& node, const std::string& path)
+{
+	const hid_t dataType = H5Dget_type(dataSet);
+	const hid_t dataSpace = H5Dget_space(dataSet);
+
+	const int rank = H5Sget_simple_extent_ndims(dataSpace);
+	if (rank > 0)
+	{
+		std::vector<hsize_t> buffer(rank);
+		H5Sget_simple_extent_dims(dataSpace, buffer.data(), nullptr);
+		node.dims.assign(buffer.begin(), buffer.end());
+	}
+
+	const hssize_t nPoints = H5Sget_simple_extent_npoints(dataSpace);
+	const std::size_t bufSize = (nPoints > 0) ? static_cast<std::size_t>(nPoints) : 0;
+
+	const H5T_class_t typeClass = H5Tget_class(dataType);
+	const hid_t nativeType = H5Tget_native_type(dataType, H5T_DIR_ASCEND);
+	node.nativeInt = H5Tequal(nativeType, H5T_NATIVE_INT) > 0;
+	node.nativeDouble = H5Tequal(nativeType, H5T_NATIVE_DOUBLE) > 0;
+	H5Tclose(nativeType);
+
+	herr_t status = 0;
+	if ((H5Tis_variable_str(dataType) > 0) || (typeClass == H5T_STRING))
+	{
+		node.type = DataType::String;
+		node.stringData.reserve(bufSize);
+
+		if ((bufSize > 0) && (H5Tis_variable_str(dataType) > 0))
+		{
+			std::vector<char*> buffer(bufSize, nullptr);
+
+			const hid_t memType = H5Tcopy(H5T_C_S1);
+			H5Tset_size(memType, H5T_VARIABLE);
+
+			status = H5Dread(dataSet, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data());
+			if (status >= 0)
+			{
+				for (std::size_t i = 0; i < bufSize; ++i)
+					node.stringData.push_back(buffer[i] ? std::string(buffer[i]) : std::string());
+
+				// Free memory alloc'd by the variable length read mechanism
+				H5Dvlen_reclaim(memType, dataSpace, H5P_DEFAULT, buffer.data());
+			}
+
+			H5Tclose(memType);
+		}
+		else if (bufSize > 0)
+		{
+			const std::size_t strLen = H5Tget_size(dataType) + 1;
+			std::vector<char> buffer(strLen * bufSize, 0);
+
+			const hid_t memType = H5Tcopy(H5T_C_S1);
+			H5Tset_size(memType, strLen);
+
+			status = H5Dread(dataSet, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data());
+			for (std::size_t i = 0; (status >= 0) && (i < bufSize); ++i)
+				node.stringData.push_back(std::string(buffer.data() + i * strLen));
+
+			H5Tclose(memType);
+		}
+	}
+	else if ((typeClass == H5T_INTEGER) && (H5Tget_sign(dataType) == H5T_SGN_NONE))
+	{
+		node.type = DataType::UnsignedInteger;
+		node.uintData.resize(bufSize);
+		if (bufSize > 0)
+			status = H5Dread(dataSet, H5T_NATIVE_UINT64, H5S_ALL, H5S_ALL, H5P_DEFAULT, node.uintData.data());
+	}
+	else if (typeClass == H5T_INTEGER)
+	{
+		node.type = DataType::Integer;
+		node.intData.resize(bufSize);
+		if (bufSize > 0)
+			status = H5Dread(dataSet, H5T_NATIVE_INT64, H5S_ALL, H5S_ALL, H5P_DEFAULT, node.intData.data());
+	}
+	else if (typeClass == H5T_FLOAT)
+	{
+		node.type = DataType::Double;
+		node.doubleData.resize(bufSize);
+		if (bufSize > 0)
+			status = H5Dread(dataSet, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, node.doubleData.data());
+	}
+	else if (bufSize > 0)
+	{
+		// Other types (e.g., boolean enums written by h5py) are kept if the library can convert them
+		node.intData.resize(bufSize);
+		if (H5Dread(dataSet, H5T_NATIVE_INT64, H5S_ALL, H5S_ALL, H5P_DEFAULT, node.intData.data()) >= 0)
+			node.type = DataType::Integer;
+		else
+		{
+			node.intData.clear();
+			node.doubleData.resize(bufSize);
+			if (H5Dread(dataSet, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, node.doubleData.data()) >= 0)
+				node.type = DataType::Double;
+			else
+				node.doubleData.clear();
+		}
+	}
+
+	H5Tclose(dataType);
+	H5Sclose(dataSpace);
+
+	if (status < 0)
+		throw IOException("Failed to read field \"" + path + "\"");
+}
+
+
+void HDF5CachedReader::ensureLoaded(Node& node, const std::string& path)
+{
+	// The root group is only indexed in order to avoid reading unused top-level groups
+	if (node.loaded || (&node == _root.get()))
+		return;
+
+	// Read the complete subtree the first time a group is entered
+	const hid_t grp = H5Gopen2(_file, path.c_str(), H5P_DEFAULT);
+	if (grp < 0)
+		throw IOException("Group '" + path + "' doesn't exist in file");
+
+	node.items.clear();
+	node.children.clear();
+
+	try
+	{
+		loadGroup(grp, node, path, true);
+	}
+	catch (...)
+	{
+		H5Gclose(grp);
+		throw;
+	}
+	H5Gclose(grp);
+}
+
+
+HDF5CachedReader::Node* HDF5CachedReader::findNode(const std::string& elementName, std::string* nodePath)
+{
+	if (!_root)
+		throw IOException("No file opened");
+
+	const std::string fullName = getFullGroupName() + "/" + elementName;
+
+	Node* node = _root.get();
+	std::string path;
+	std::size_t start = 0;
+	while (start < fullName.size())
+	{
+		const std::size_t end = std::min(fullName.find('/', start), fullName.size());
+		if (end > start)
+		{
+			if (!node->group)
+				return nullptr;
+
+			ensureLoaded(*node, path);
+
+			const std::string name = fullName.substr(start, end - start);
+			const std::map<std::string, std::unique_ptr<Node>>::iterator it = node->children.find(name);
+			if (it == node->children.end())
+				return nullptr;
+
+			node = it->second.get();
+			path += "/" + name;
+		}
+		start = end + 1;
+	}
+
+	if (nodePath)
+		*nodePath = path;
+
+	return node;
+}
+
+
+HDF5CachedReader::Node& HDF5CachedReader::currentGroup()
+{
+	std::string path;
+	Node* const node = findNode("", &path);
+	if (!node || !node->group)
+		throw IOException("Group '" + getFullGroupName() + "' doesn't exist in file");
+
+	ensureLoaded(*node, path);
+	return *node;
+}
+
+
+const HDF5CachedReader::Node& HDF5CachedReader::dataset(const std::string& elementName)
+{
+	const Node* const node = findNode(elementName);
+	if (!node)
+		throw IOException("Field \"" + elementName + "\" does not exist in group " + getFullGroupName());
+	if (node->group)
+		throw IOException("Field \"" + elementName + "\" in group " + getFullGroupName() + " is not a dataset");
+
+	return *node;
+}
+
+}  // namespace io
+
+}  // namespace cadet
+
+
+#endif /* HDF5CACHEDREADER_HPP_ */
@@ -85,12 +85,26 @@ public:
 	///        (maxsize = unlimited, chunked layout), when set to true.
 	inline void extendibleFields(bool setExtendible) {_writeExtendible = setExtendible;}
 
+	/// \brief Data is appended along the first dimension of existing fields, when set to true.
+	///        Non-existent fields are created with unlimited first dimension and chunked layout.
+	inline void appendFields(bool setAppend) {_writeAppend = setAppend;}
+
+	/// \brief Flushes all buffers associated with the file to disk
+	inline void flush();
+
+	/// \brief Shrinks all appended fields (unlimited first dimension) in the given group and its subgroups
+	///        to at most the given length along the first dimension and removes all other fields
+	inline void truncateFields(const std::string& groupName, std::size_t length);
+
 private:
 
 	void writeWork(const std::string& dataSetName, hid_t memType, hid_t fileType, const std::size_t rank, const std::size_t* dims, const void* buffer, const std::size_t stride, const std::size_t blockSize);
+	void appendWork(hid_t dataSet, const std::string& dataSetName, hid_t memType, const std::size_t rank, const std::size_t* dims, const void* buffer, const std::size_t stride, const std::size_t blockSize);
+	hid_t createMemorySpace(hsize_t numElem, const std::size_t stride, const std::size_t blockSize);
 
 	bool                    _writeScalar;
 	bool                    _writeExtendible;
+	bool                    _writeAppend;
 	bool                    _writeCompressed;
 	hsize_t*                _maxDims;
 	hsize_t*                _chunks;
@@ -101,6 +115,7 @@ private:
 HDF5Writer::HDF5Writer() :
 		_writeScalar(false),
 		_writeExtendible(true),
+		_writeAppend(false),
 		_writeCompressed(false),
 		_maxDims(NULL),
 		_chunks(NULL),
@@ -255,13 +270,107 @@ void HDF5Writer::unlinkDataset(const std::string& dsName)
 }
 
 
+void HDF5Writer::flush()
+{
+	H5Fflush(_file, H5F_SCOPE_GLOBAL);
+}
+
+
+namespace detail
+{
+	struct TruncateFieldsData
+	{
+		hsize_t length;
+		std::vector<std::string> fixedFields;
+	};
+
+	inline herr_t truncateAppendedField(hid_t group, const char* name, const H5L_info_t* info, void* opData)
+	{
+		const hid_t obj = H5Oopen(group, name, H5P_DEFAULT);
+		if (obj < 0)
+			return 0;
+
+		if (H5Iget_type(obj) == H5I_DATASET)
+		{
+			TruncateFieldsData* const data = static_cast<TruncateFieldsData*>(opData);
+			const hid_t dataSpace = H5Dget_space(obj);
+			const int rank = H5Sget_simple_extent_ndims(dataSpace);
+
+			std::vector<hsize_t> dims(std::max(rank, 1), 0);
+			std::vector<hsize_t> maxDims(std::max(rank, 1), 0);
+			if (rank > 0)
+				H5Sget_simple_extent_dims(dataSpace, dims.data(), maxDims.data());
+
+			if ((rank > 0) && (maxDims[0] == H5S_UNLIMITED))
+			{
+				if (dims[0] > data->length)
+				{
+					dims[0] = data->length;
+					H5Dset_extent(obj, dims.data());
+				}
+			}
+			else
+			{
+				// Links must not be removed while they are visited
+				data->fixedFields.push_back(name);
+			}
+
+			H5Sclose(dataSpace);
+		}
+
+		H5Oclose(obj);
+		return 0;
+	}
+}
+
+
+void HDF5Writer::truncateFields(const std::string& groupName, std::size_t length)
+{
+	const hid_t group = H5Gopen2(_file, groupName.c_str(), H5P_DEFAULT);
+	if (group < 0)
+		return;
+
+	detail::TruncateFieldsData data;
+	data.length = length;
+	H5Lvisit(group, H5_INDEX_NAME, H5_ITER_NATIVE, &detail::truncateAppendedField, &data);
+
+	for (const std::string& name : data.fixedFields)
+		H5Ldelete(group, name.c_str(), H5P_DEFAULT);
+
+	H5Gclose(group);
+}
+
+
 void HDF5Writer::writeWork(const std::string& dataSetName, hid_t memType, hid_t fileType, const std::size_t rank, const std::size_t* dims, const void* buffer, const std::size_t stride, const std::size_t blockSize)
 {
+	if (_writeAppend && !_writeScalar)
+	{
+		// Append to the field if it already exists
+		openGroup(true);
+		const hid_t existing = H5Dopen2(_groupsOpened.top(), dataSetName.c_str(), H5P_DEFAULT);
+		closeGroup();
+
+		if (existing >= 0)
+		{
+			appendWork(existing, dataSetName, memType, rank, dims, buffer, stride, blockSize);
+			return;
+		}
+	}
+
 	hid_t propList = H5Pcreate(H5P_DATASET_CREATE);
 	hid_t dataSpace;
 	if (!_writeScalar)
 	{
-		if (_writeExtendible || _writeCompressed) // we need chunking
+		if (_writeAppend) // chunks hold one block of appended data
+		{
+			_chunks  = new hsize_t[rank];
+			for (std::size_t i = 0; i < rank; ++i)
+				_chunks[i] = std::max<hsize_t>(dims[i], 1);
+
+			H5Pset_chunk(propList, rank, _chunks);
+			delete[] _chunks;
+		}
+		else if (_writeExtendible || _writeCompressed) // we need chunking
 		{
 			_chunks  = new hsize_t[rank];
 			for (std::size_t i = 0; i < rank; ++i)
@@ -272,7 +381,13 @@ void HDF5Writer::writeWork(const std::string& dataSetName, hid_t memType, hid_t
 		}
 
 		_maxDims = new hsize_t[rank];
-		if (_writeExtendible) // we set maxdims unlimited
+		if (_writeAppend) // first dimension is unlimited, others are fixed
+		{
+			_maxDims[0] = H5S_UNLIMITED;
+			for (std::size_t i = 1; i < rank; ++i)
+				_maxDims[i] = dims[i];
+		}
+		else if (_writeExtendible) // we set maxdims unlimited
 		{
 			for (std::size_t i = 0; i < rank; ++i)
 				_maxDims[i] = H5S_UNLIMITED;
@@ -316,18 +431,7 @@ void HDF5Writer::writeWork(const std::string& dataSetName, hid_t memType, hid_t
 		H5Dwrite(dataSet, memType, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer);
 	else
 	{
-		// Create strided memory data space
-		const hsize_t clampedStride = (stride < 1) ? 1 : stride;
-		const hsize_t numElem = H5Sget_simple_extent_npoints(dataSpace) / blockSize;
-
-		// We need the actual array size (not just the number of elements to be written)
-		const hsize_t spaceExtent = numElem * (clampedStride + blockSize);
-		const hid_t memSpace = H5Screate_simple(1, &spaceExtent, nullptr);
-
-		const hsize_t start = 0;
-		const hsize_t block = blockSize;
-		H5Sselect_hyperslab(memSpace, H5S_SELECT_SET, &start, &clampedStride, &numElem, &block);
-
+		const hid_t memSpace = createMemorySpace(H5Sget_simple_extent_npoints(dataSpace), stride, blockSize);
 		H5Dwrite(dataSet, memType, memSpace, H5S_ALL, H5P_DEFAULT, buffer);
 		H5Sclose(memSpace);
 	}
@@ -337,6 +441,75 @@ void HDF5Writer::writeWork(const std::string& dataSetName, hid_t memType, hid_t
 	H5Pclose(propList);
 }
 
+
+void HDF5Writer::appendWork(hid_t dataSet, const std::string& dataSetName, hid_t memType, const std::size_t rank, const std::size_t* dims, const void* buffer, const std::size_t stride, const std::size_t blockSize)
+{
+	// Check whether the block matches the existing field
+	hid_t fileSpace = H5Dget_space(dataSet);
+	if (H5Sget_simple_extent_ndims(fileSpace) != static_cast<int>(rank))
+	{
+		H5Sclose(fileSpace);
+		H5Dclose(dataSet);
+		throw IOException("Cannot append to field \"" + dataSetName + "\" in group " + getFullGroupName() + " due to rank mismatch");
+	}
+
+	std::vector<hsize_t> newDims(rank);
+	H5Sget_simple_extent_dims(fileSpace, newDims.data(), nullptr);
+	H5Sclose(fileSpace);
+
+	for (std::size_t i = 1; i < rank; ++i)
+	{
+		if (newDims[i] != dims[i])
+		{
+			H5Dclose(dataSet);
+			throw IOException("Cannot append to field \"" + dataSetName + "\" in group " + getFullGroupName() + " due to dimension mismatch");
+		}
+	}
+
+	// Extend field along first dimension
+	std::vector<hsize_t> offset(rank, 0);
+	offset[0] = newDims[0];
+	newDims[0] += dims[0];
+
+	if (H5Dset_extent(dataSet, newDims.data()) < 0)
+	{
+		H5Dclose(dataSet);
+		throw IOException("Cannot extend field \"" + dataSetName + "\" in group " + getFullGroupName());
+	}
+
+	// Select appended block in file
+	std::vector<hsize_t> count(dims, dims + rank);
+	fileSpace = H5Dget_space(dataSet);
+	H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, offset.data(), nullptr, count.data(), nullptr);
+
+	const hsize_t numElem = H5Sget_select_npoints(fileSpace);
+	const hid_t memSpace = (stride <= 1) ? H5Screate_simple(rank, count.data(), nullptr) : createMemorySpace(numElem, stride, blockSize);
+
+	H5Dwrite(dataSet, memType, memSpace, fileSpace, H5P_DEFAULT, buffer);
+
+	H5Sclose(memSpace);
+	H5Sclose(fileSpace);
+	H5Dclose(dataSet);
+}
+
+
+hid_t HDF5Writer::createMemorySpace(hsize_t numElem, const std::size_t stride, const std::size_t blockSize)
+{
+	// Create strided memory data space
+	const hsize_t clampedStride = (stride < 1) ? 1 : stride;
+	const hsize_t numBlocks = numElem / blockSize;
+
+	// We need the actual array size (not just the number of elements to be written)
+	const hsize_t spaceExtent = numBlocks * (clampedStride + blockSize);
+	const hid_t memSpace = H5Screate_simple(1, &spaceExtent, nullptr);
+
+	const hsize_t start = 0;
+	const hsize_t block = blockSize;
+	H5Sselect_hyperslab(memSpace, H5S_SELECT_SET, &start, &clampedStride, &numBlocks, &block);
+
+	return memSpace;
+}
+
 }  // namespace io
 }  // namespace cadet
 
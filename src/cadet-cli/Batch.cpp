@@ -0,0 +1,299 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "Batch.hpp"
+#include "SignalHandler.hpp"
+
+#include "cadet/StringUtil.hpp"
+
+#include <json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <sstream>
+#include <thread>
+
+#ifdef CADET_PARALLELIZE
+	#include <tbb/task_arena.h>
+
+	#ifdef CADET_TBB_GLOBALCTRL
+		#define TBB_PREVIEW_GLOBAL_CONTROL 1
+		#include <tbb/global_control.h>
+		#include <memory>
+	#endif
+#endif
+
+namespace fs = std::filesystem;
+
+namespace
+{
+	/**
+	 * @brief Checks whether a file name matches a pattern with wildcards @c * and @c ?
+	 * @param [in] pattern Pattern
+	 * @param [in] name File name
+	 * @return @c true if the name matches the pattern, otherwise @c false
+	 */
+	bool matchesWildcard(const std::string& pattern, const std::string& name)
+	{
+		std::size_t p = 0;
+		std::size_t n = 0;
+		std::size_t starPos = std::string::npos;
+		std::size_t starMatch = 0;
+
+		while (n < name.size())
+		{
+			if ((p < pattern.size()) && ((pattern[p] == '?') || (pattern[p] == name[n])))
+			{
+				++p;
+				++n;
+			}
+			else if ((p < pattern.size()) && (pattern[p] == '*'))
+			{
+				// Remember position of star and try to match empty sequence first
+				starPos = p++;
+				starMatch = n;
+			}
+			else if (starPos != std::string::npos)
+			{
+				// Let last star consume one more character
+				p = starPos + 1;
+				n = ++starMatch;
+			}
+			else
+				return false;
+		}
+
+		while ((p < pattern.size()) && (pattern[p] == '*'))
+			++p;
+
+		return p == pattern.size();
+	}
+
+	inline bool hasWildcard(const std::string& str)
+	{
+		return str.find_first_of("*?") != std::string::npos;
+	}
+
+	inline bool isSupportedInputFile(const fs::path& p)
+	{
+		const std::string ext = p.extension().string();
+		return cadet::util::caseInsensitiveEquals(ext, ".h5") || cadet::util::caseInsensitiveEquals(ext, ".xml")
+			|| cadet::util::caseInsensitiveEquals(ext, ".json");
+	}
+
+	const char* jobStatus(const cadet::BatchJob& job)
+	{
+		if (!job.started)
+			return "SKIPPED";
+
+		switch (job.returnCode)
+		{
+			case 0: return "SUCCESS";
+			case 2: return "IO_ERROR";
+			case 3: return "SOLVER_ERROR";
+			default: return "ERROR";
+		}
+	}
+}
+
+namespace cadet
+{
+
+std::vector<std::string> collectBatchInputFiles(const std::vector<std::string>& args, std::ostream& err)
+{
+	std::vector<std::string> files;
+	for (const std::string& arg : args)
+	{
+		std::error_code ec;
+		const fs::path argPath(arg);
+
+		if (fs::is_directory(argPath, ec))
+		{
+			std::vector<std::string> dirFiles;
+			for (const fs::directory_entry& entry : fs::directory_iterator(argPath, ec))
+			{
+				if (entry.is_regular_file(ec) && isSupportedInputFile(entry.path()))
+					dirFiles.push_back(entry.path().string());
+			}
+
+			if (dirFiles.empty())
+				err << "WARNING: Directory " << arg << " does not contain input files" << std::endl;
+
+			std::sort(dirFiles.begin(), dirFiles.end());
+			files.insert(files.end(), dirFiles.begin(), dirFiles.end());
+		}
+		else if (hasWildcard(argPath.filename().string()))
+		{
+			const fs::path dir = argPath.has_parent_path() ? argPath.parent_path() : fs::path(".");
+			const std::string pattern = argPath.filename().string();
+
+			std::vector<std::string> matches;
+			for (const fs::directory_entry& entry : fs::directory_iterator(dir, ec))
+			{
+				if (entry.is_regular_file(ec) && matchesWildcard(pattern, entry.path().filename().string()))
+					matches.push_back((argPath.has_parent_path() ? entry.path() : entry.path().filename()).string());
+			}
+
+			if (matches.empty())
+				err << "WARNING: Pattern " << arg << " does not match any file" << std::endl;
+
+			std::sort(matches.begin(), matches.end());
+			files.insert(files.end(), matches.begin(), matches.end());
+		}
+		else
+			files.push_back(arg);
+	}
+
+	return files;
+}
+
+std::vector<BatchJob> createBatchJobs(const std::vector<std::string>& inputFiles, const std::string& outputDir)
+{
+	std::vector<BatchJob> jobs;
+	jobs.reserve(inputFiles.size());
+
+	for (const std::string& inFile : inputFiles)
+	{
+		BatchJob job{inFile, inFile, 0, false, 0.0, ""};
+		if (!outputDir.empty())
+			job.outputFile = (fs::path(outputDir) / fs::path(inFile).filename()).string();
+
+		jobs.push_back(std::move(job));
+	}
+
+	return jobs;
+}
+
+double runBatch(std::vector<BatchJob>& jobs, unsigned int nWorkers, unsigned int nThreadsPerJob, const BatchJobFun& fun)
+{
+	typedef std::chrono::steady_clock Clock;
+	const Clock::time_point batchStart = Clock::now();
+
+	nWorkers = std::max(1u, std::min(nWorkers, static_cast<unsigned int>(jobs.size())));
+
+#if defined(CADET_PARALLELIZE) && defined(CADET_TBB_GLOBALCTRL)
+	// All task arenas share one pool of threads, which is sized to serve every worker
+	std::unique_ptr<tbb::global_control> tbbGlobalControl;
+	if (nThreadsPerJob > 0)
+		tbbGlobalControl = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, nWorkers * nThreadsPerJob);
+#endif
+
+	std::atomic<std::size_t> nextJob(0);
+	const auto worker = [&]()
+	{
+#ifdef CADET_PARALLELIZE
+		tbb::task_arena arena((nThreadsPerJob > 0) ? static_cast<int>(nThreadsPerJob) : tbb::task_arena::automatic);
+#endif
+
+		for (std::size_t idx = nextJob++; idx < jobs.size(); idx = nextJob++)
+		{
+			if (cadet::stopExecutionRequested())
+				break;
+
+			BatchJob& job = jobs[idx];
+			job.started = true;
+
+			std::ostringstream err;
+			const Clock::time_point jobStart = Clock::now();
+
+			const auto runJob = [&]()
+			{
+				try
+				{
+					job.returnCode = fun(job.inputFile, job.outputFile, err);
+				}
+				catch (const std::exception& e)
+				{
+					err << "ERROR: " << e.what() << std::endl;
+					job.returnCode = 1;
+				}
+			};
+
+#ifdef CADET_PARALLELIZE
+			arena.execute(runJob);
+#else
+			runJob();
+#endif
+
+			job.duration = std::chrono::duration<double>(Clock::now() - jobStart).count();
+			job.message = err.str();
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(nWorkers - 1);
+	for (unsigned int i = 1; i < nWorkers; ++i)
+		workers.emplace_back(worker);
+
+	// Calling thread acts as worker, too
+	worker();
+
+	for (std::thread& t : workers)
+		t.join();
+
+	// Jobs skipped due to user abort count as failed
+	for (BatchJob& job : jobs)
+	{
+		if (!job.started)
+		{
+			job.returnCode = 1;
+			job.message = "Skipped due to user abort";
+		}
+	}
+
+	return std::chrono::duration<double>(Clock::now() - batchStart).count();
+}
+
+void writeBatchSummary(std::ostream& os, const std::vector<BatchJob>& jobs, unsigned int nWorkers, unsigned int nThreadsPerJob, double duration)
+{
+	nlohmann::json summary;
+	summary["workers"] = nWorkers;
+	summary["threadsPerJob"] = nThreadsPerJob;
+	summary["totalTime"] = duration;
+	summary["returnCode"] = batchReturnCode(jobs);
+
+	unsigned int nFailed = 0;
+	nlohmann::json jobList = nlohmann::json::array();
+	for (const BatchJob& job : jobs)
+	{
+		nlohmann::json j;
+		j["input"] = job.inputFile;
+		j["output"] = job.outputFile;
+		j["status"] = jobStatus(job);
+		j["returnCode"] = job.returnCode;
+		j["time"] = job.duration;
+		j["message"] = job.message;
+		jobList.push_back(std::move(j));
+
+		if (job.returnCode != 0)
+			++nFailed;
+	}
+
+	summary["numJobs"] = jobs.size();
+	summary["numFailed"] = nFailed;
+	summary["jobs"] = std::move(jobList);
+
+	os << summary.dump(4) << std::endl;
+}
+
+int batchReturnCode(const std::vector<BatchJob>& jobs)
+{
+	int code = 0;
+	for (const BatchJob& job : jobs)
+		code = std::max(code, job.returnCode);
+
+	return code;
+}
+
+} // namespace cadet
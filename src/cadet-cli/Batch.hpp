@@ -0,0 +1,103 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Batch mode of cadet-cli that simulates multiple files in the same process.
+ */
+
+#ifndef CADETCLI_BATCH_HPP_
+#define CADETCLI_BATCH_HPP_
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <functional>
+
+namespace cadet
+{
+	/**
+	 * @brief Single simulation of a batch run
+	 */
+	struct BatchJob
+	{
+		std::string inputFile; //!< Input file
+		std::string outputFile; //!< Output file
+		int returnCode; //!< Return code of the simulation (see cadet-cli return codes)
+		bool started; //!< Determines whether the simulation has been started
+		double duration; //!< Wall clock time of the simulation in seconds
+		std::string message; //!< Error messages of the simulation
+	};
+
+	/**
+	 * @brief Simulates a single file of a batch run
+	 * @details The function is called concurrently from multiple workers.
+	 * @param [in] inFile Input file
+	 * @param [in] outFile Output file
+	 * @param [out] err Stream that receives error messages
+	 * @return Return code of the simulation (see cadet-cli return codes)
+	 */
+	typedef std::function<int(const std::string& inFile, const std::string& outFile, std::ostream& err)> BatchJobFun;
+
+	/**
+	 * @brief Expands the given files, directories, and glob patterns into a list of input files
+	 * @details Directories contribute all files with supported extension (h5, xml, json), but are
+	 *          not searched recursively. Glob patterns may contain wildcards @c * and @c ? in
+	 *          the file name, but not in the directory part. Other arguments are taken as file
+	 *          names regardless of their existence.
+	 * @param [in] args Files, directories, or glob patterns
+	 * @param [out] err Stream that receives warnings
+	 * @return List of input files
+	 */
+	std::vector<std::string> collectBatchInputFiles(const std::vector<std::string>& args, std::ostream& err);
+
+	/**
+	 * @brief Creates the jobs of a batch run
+	 * @param [in] inputFiles List of input files
+	 * @param [in] outputDir Directory of the output files, input files also serve as output if empty
+	 * @return List of jobs
+	 */
+	std::vector<BatchJob> createBatchJobs(const std::vector<std::string>& inputFiles, const std::string& outputDir);
+
+	/**
+	 * @brief Runs the jobs of a batch on a given number of concurrent workers
+	 * @details Each job runs in its own task arena with @p nThreadsPerJob threads. All arenas
+	 *          share the same thread pool. Remaining jobs are skipped if the user requests to
+	 *          stop the execution.
+	 * @param [in,out] jobs Jobs that are updated with status and timing
+	 * @param [in] nWorkers Number of concurrently running jobs
+	 * @param [in] nThreadsPerJob Number of threads of each job
+	 * @param [in] fun Function that runs a single job
+	 * @return Total wall clock time of the batch in seconds
+	 */
+	double runBatch(std::vector<BatchJob>& jobs, unsigned int nWorkers, unsigned int nThreadsPerJob, const BatchJobFun& fun);
+
+	/**
+	 * @brief Writes a summary of the batch run in JSON format
+	 * @param [in,out] os Output stream
+	 * @param [in] jobs Completed jobs
+	 * @param [in] nWorkers Number of concurrently running jobs
+	 * @param [in] nThreadsPerJob Number of threads of each job
+	 * @param [in] duration Total wall clock time of the batch in seconds
+	 */
+	void writeBatchSummary(std::ostream& os, const std::vector<BatchJob>& jobs, unsigned int nWorkers, unsigned int nThreadsPerJob, double duration);
+
+	/**
+	 * @brief Returns the combined return code of a batch run
+	 * @param [in] jobs Completed jobs
+	 * @return @c 0 if all jobs succeeded, otherwise the largest return code of all jobs
+	 */
+	int batchReturnCode(const std::vector<BatchJob>& jobs);
+
+} // namespace cadet
+
+#endif  // CADETCLI_BATCH_HPP_
@@ -12,6 +12,7 @@
 
 #include "cadet/cadet.hpp"
 #include "io/hdf5/HDF5Reader.hpp"
+#include "io/hdf5/HDF5CachedReader.hpp"
 #include "io/hdf5/HDF5Writer.hpp"
 #include "io/xml/XMLReader.hpp"
 #include "io/xml/XMLWriter.hpp"
@@ -21,6 +22,7 @@
 #include "common/TclapUtils.hpp"
 #include "ProgressBar.hpp"
 #include "SignalHandler.hpp"
+#include "Batch.hpp"
 
 #include "Logging.hpp"
 
@@ -36,6 +38,10 @@
 #include <iomanip>
 #include <sstream>
 #include <cctype>
+#include <type_traits>
+#include <fstream>
+#include <mutex>
+#include <filesystem>
 
 #ifndef CADET_LOGGING_DISABLE
 	template <>
@@ -215,17 +221,71 @@ public:
 };
 
 
+/**
+ * @brief Options of a single simulation run
+ */
+struct RunOptions
+{
+	bool showProgressBar; //!< Show a progress bar
+	bool resume; //!< Resume the simulation from the checkpoint in the output file
+	bool batch; //!< Simulation is part of a batch (no streaming, number of threads determined by batch)
+	std::mutex* ioMutex; //!< Serializes file access of concurrent simulations (may be @c nullptr)
+};
+
+/**
+ * @brief Locks the given mutex if it exists
+ * @param [in] m Mutex or @c nullptr
+ * @return Lock that owns the mutex if it exists
+ */
+inline std::unique_lock<std::mutex> lockFileAccess(std::mutex* m)
+{
+	if (m)
+		return std::unique_lock<std::mutex>(*m);
+
+	return std::unique_lock<std::mutex>();
+}
+
 template <class DriverConfigurator_t, class Writer_t>
-int run(const std::string& inFileName, const std::string& outFileName, bool showProgressBar)
+int run(const std::string& inFileName, const std::string& outFileName, const RunOptions& opts, std::ostream& err)
 {
 	int returnCode = 0;
 	cadet::Driver drv;
 	
 	{
+		// The HDF5 library is not necessarily thread-safe
+		std::unique_lock<std::mutex> lock = lockFileAccess(opts.ioMutex);
+
+		cadet::ProfileScope ps("read input");
 		DriverConfigurator_t dc;
 		dc.configure(drv, inFileName);
 	}
 
+	// Batch jobs use all threads of their task arena
+	if (opts.batch)
+		drv.simulator()->setNumThreads(0);
+
+	// Only HDF5 files support appending to datasets while the simulation is running
+	constexpr bool writerSupportsStreaming = std::is_same<Writer_t, cadet::io::HDF5Writer>::value;
+
+	if (opts.resume)
+	{
+		if constexpr (writerSupportsStreaming)
+		{
+			// Continue from the checkpoint in the output file, which requires appending to the existing output
+			cadet::io::HDF5Reader rd;
+			rd.openFile(outFileName, "r");
+			drv.resume(rd);
+			rd.closeFile();
+
+			drv.setStreamSolution(true);
+		}
+		else
+		{
+			err << "Resuming from a checkpoint requires an HDF5 output file" << std::endl;
+			return 2;
+		}
+	}
+
 	std::unique_ptr<SignalHandlingNotifier> shn = nullptr;
 
 #ifndef CADET_BENCHMARK_MODE
@@ -233,47 +293,74 @@ int run(const std::string& inFileName, const std::string& outFileName, bool show
 
 	std::unique_ptr<ProgressBarNotifier> pb = nullptr;
 
-	if (showProgressBar)
+	if (opts.showProgressBar && !opts.batch)
 	{
 		pb = std::make_unique<ProgressBarNotifier>();
-		drv.simulator()->setNotificationCallback(pb.get());
+		drv.setNotificationCallback(pb.get());
 	}
 	else
 	{
 		shn = std::make_unique<SignalHandlingNotifier>();
-		drv.simulator()->setNotificationCallback(shn.get());
+		drv.setNotificationCallback(shn.get());
 	}
 #else
 	// Always handle signals in benchmark mode (no progress bar overhead)
 	shn = std::make_unique<SignalHandlingNotifier>();
-	drv.simulator()->setNotificationCallback(shn.get());
+	drv.setNotificationCallback(shn.get());
 #endif
 
-	
+	Writer_t writer;
+
+	// Streaming would hold the file lock during the whole simulation
+	const bool streamSolution = writerSupportsStreaming && drv.streamSolution() && !opts.batch;
+	if (streamSolution)
+	{
+		if ((inFileName == outFileName) || opts.resume)
+			writer.openFile(outFileName, "rw");
+		else
+			writer.openFile(outFileName, "co");
+	}
+
 	try
 	{
-		drv.run();
+		if constexpr (writerSupportsStreaming)
+		{
+			if (streamSolution)
+				drv.run(writer);
+			else
+				drv.run();
+		}
+		else
+			drv.run();
 	}
 	catch (const cadet::IntegrationException& e)
 	{
-		std::cerr << "SOLVER ERROR: " << e.what() << std::endl;
+		err << "SOLVER ERROR: " << e.what() << std::endl;
 		returnCode = 3;
 	}
 
-	Writer_t writer;
-	if (inFileName == outFileName)
-		writer.openFile(outFileName, "rw");
-	else
-		writer.openFile(outFileName, "co");
+	{
+		std::unique_lock<std::mutex> lock = lockFileAccess(opts.ioMutex);
+
+		if (!streamSolution)
+		{
+			if (inFileName == outFileName)
+				writer.openFile(outFileName, "rw");
+			else
+				writer.openFile(outFileName, "co");
+		}
 
-	drv.write(writer);
-	writer.closeFile();
+		cadet::ProfileScope ps("write output");
+		drv.write(writer);
+		writer.closeFile();
+	}
 
 #ifdef CADET_BENCHMARK_MODE
 	// Write timings in JSON format
 
 	// First, timings of the ModelSystem
 	std::cout << "{\n\"TotalTimeIntegration\": " << drv.simulator()->totalSimulationDuration() << ",\n";
+	std::cout << "\"HeapAllocationsTimeIntegration\": " << drv.simulator()->numHeapAllocationsTimeIntegration() << ",\n";
 	std::cout << "\"ModelSystem\":\n\t{\n";
 	const std::vector<double> sysTiming = drv.model()->benchmarkTimings();
 	char const* const* sysDesc = drv.model()->benchmarkDescriptions();
@@ -307,71 +394,33 @@ int run(const std::string& inFileName, const std::string& outFileName, bool show
 }
 
 
-int main(int argc, char** argv)
-{	
-#ifdef CADET_BENCHMARK_MODE
-	// Benchmark the whole program from start to finish
-	BenchScope bsTotalTime;
-#endif
-
-	// Install signal handler
-	cadet::installSignalHandler();
-
-	// Program options
-	std::string inFileName = "";
-	std::string outFileName = "";
-	cadet::LogLevel logLevel = cadet::LogLevel::Trace;
-	bool showProgressBar = false;
-
-	try
-	{
-		TCLAP::CustomOutput customOut("cadet-cli");
-		TCLAP::CmdLine cmd("Simulates a chromatography setup using CADET", ' ', "1.0");
-		cmd.setOutput(&customOut);
-
-		cmd >> (new TCLAP::SwitchArg("", "progress", "Show a progress bar"))->storeIn(&showProgressBar);
-		cmd >> (new TCLAP::ValueArg<cadet::LogLevel>("L", "loglevel", "Set the log level", false, cadet::LogLevel::Trace, "LogLevel"))->storeIn(&logLevel);
-		cmd >> (new TCLAP::UnlabeledValueArg<std::string>("input", "Input file", true, "", "File"))->storeIn(&inFileName);
-		cmd >> (new TCLAP::UnlabeledValueArg<std::string>("output", "Output file (defaults to input file)", false, "", "File"))->storeIn(&outFileName);
-
-		cmd.parse(argc, argv);
-	}
-	catch (const TCLAP::ArgException &e)
-	{
-		std::cerr << "ERROR: " << e.error() << " for argument " << e.argId() << std::endl;
-		return 1;
-	}
-
-	// If no dedicated output filename was given, assume output = input file
-	if (outFileName.empty())
-		outFileName = inFileName;
-
-	std::cout << std::scientific << std::setprecision(std::numeric_limits<double>::digits10 + 1);
-
-	// Set LogLevel in library and locally
-	LogReceiver lr;
-	cadet::setLogReceiver(&lr);
-	cadet::setLogLevel(logLevel);
-	setLocalLogLevel(logLevel);
-
+/**
+ * @brief Simulates a single file with reader and writer selected by file extensions
+ * @param [in] inFileName Input file
+ * @param [in] outFileName Output file
+ * @param [in] opts Options of the run
+ * @param [out] err Stream that receives error messages
+ * @return Return code of cadet-cli
+ */
+int runFile(const std::string& inFileName, const std::string& outFileName, const RunOptions& opts, std::ostream& err)
+{
 	// Obtain file extensions for selecting corresponding reader and writer
 	const std::size_t dotPosIn = inFileName.find_last_of('.');
 	if (dotPosIn == std::string::npos)
 	{
-		std::cerr << "Could not deduce input filetype due to missing extension: " << inFileName << std::endl;
+		err << "Could not deduce input filetype due to missing extension: " << inFileName << std::endl;
 		return 2;
 	}
 
 	const std::size_t dotPosOut = outFileName.find_last_of('.');
 	if (dotPosOut == std::string::npos)
 	{
-		std::cerr << "Could not deduce output filetype due to missing extension: " << outFileName << std::endl;
+		err << "Could not deduce output filetype due to missing extension: " << outFileName << std::endl;
 		return 2;
 	}
 
 	const std::string fileExtIn = inFileName.substr(dotPosIn+1);
 	const std::string fileExtOut = outFileName.substr(dotPosOut+1);
-	int returnCode = 0;
 
 	try
 	{
@@ -379,15 +428,15 @@ int main(int argc, char** argv)
 		{
 			if (cadet::util::caseInsensitiveEquals(fileExtOut, "h5"))
 			{
-				returnCode = run<FileReaderDriverConfigurator<cadet::io::HDF5Reader>, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar);
+				return run<FileReaderDriverConfigurator<cadet::io::HDF5CachedReader>, cadet::io::HDF5Writer>(inFileName, outFileName, opts, err);
 			}
 			else if (cadet::util::caseInsensitiveEquals(fileExtOut, "xml"))
 			{
-				returnCode = run<FileReaderDriverConfigurator<cadet::io::HDF5Reader>, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar);
+				return run<FileReaderDriverConfigurator<cadet::io::HDF5CachedReader>, cadet::io::XMLWriter>(inFileName, outFileName, opts, err);
 			}
 			else
 			{
-				std::cerr << "Output file format ('." << fileExtOut << "') not supported" << std::endl;
+				err << "Output file format ('." << fileExtOut << "') not supported" << std::endl;
 				return 2;
 			}
 		}
@@ -395,15 +444,15 @@ int main(int argc, char** argv)
 		{
 			if (cadet::util::caseInsensitiveEquals(fileExtOut, "xml"))
 			{
-				returnCode = run<FileReaderDriverConfigurator<cadet::io::XMLReader>, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar);
+				return run<FileReaderDriverConfigurator<cadet::io::XMLReader>, cadet::io::XMLWriter>(inFileName, outFileName, opts, err);
 			}
 			else if (cadet::util::caseInsensitiveEquals(fileExtOut, "h5"))
 			{
-				returnCode = run<FileReaderDriverConfigurator<cadet::io::XMLReader>, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar);
+				return run<FileReaderDriverConfigurator<cadet::io::XMLReader>, cadet::io::HDF5Writer>(inFileName, outFileName, opts, err);
 			}
 			else
 			{
-				std::cerr << "Output file format ('." << fileExtOut << "') not supported" << std::endl;
+				err << "Output file format ('." << fileExtOut << "') not supported" << std::endl;
 				return 2;
 			}
 		}
@@ -411,39 +460,178 @@ int main(int argc, char** argv)
 		{
 			if (cadet::util::caseInsensitiveEquals(fileExtOut, "xml"))
 			{
-				returnCode = run<JsonDriverConfigurator, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar);
+				return run<JsonDriverConfigurator, cadet::io::XMLWriter>(inFileName, outFileName, opts, err);
 			}
 			else if (cadet::util::caseInsensitiveEquals(fileExtOut, "h5"))
 			{
-				returnCode = run<JsonDriverConfigurator, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar);
+				return run<JsonDriverConfigurator, cadet::io::HDF5Writer>(inFileName, outFileName, opts, err);
 			}
 			else
 			{
-				std::cerr << "Output file format ('." << fileExtOut << "') not supported" << std::endl;
+				err << "Output file format ('." << fileExtOut << "') not supported" << std::endl;
 				return 2;
 			}
 		}
 		else
 		{
-			std::cerr << "Input file format ('." << fileExtIn << "') not supported" << std::endl;
+			err << "Input file format ('." << fileExtIn << "') not supported" << std::endl;
 			return 2;
 		}
 	}
 	catch (const cadet::io::IOException& e)
 	{
-		std::cerr << "IO ERROR: " << e.what() << std::endl;
+		err << "IO ERROR: " << e.what() << std::endl;
 		return 2;
 	}
 	catch (const cadet::IntegrationException& e)
 	{
-		std::cerr << "SOLVER ERROR: " << e.what() << std::endl;
+		err << "SOLVER ERROR: " << e.what() << std::endl;
 		return 3;
 	}
 	catch (const std::exception& e)
 	{
-		std::cerr << "ERROR: " << e.what() << std::endl;
+		err << "ERROR: " << e.what() << std::endl;
 		return 1;
 	}
+}
+
+/**
+ * @brief Simulates multiple files in the same process
+ * @param [in] args Input files, directories, or glob patterns
+ * @param [in] outputDir Directory of the output files, input files also serve as output if empty
+ * @param [in] summaryFileName File the JSON summary is written to, standard output is used if empty
+ * @param [in] nWorkers Number of concurrently simulated files
+ * @param [in] nThreadsPerJob Number of threads of each simulation
+ * @return Return code of cadet-cli
+ */
+int runBatchMode(const std::vector<std::string>& args, const std::string& outputDir, const std::string& summaryFileName, unsigned int nWorkers, unsigned int nThreadsPerJob)
+{
+	const std::vector<std::string> inputFiles = cadet::collectBatchInputFiles(args, std::cerr);
+	if (inputFiles.empty())
+	{
+		std::cerr << "ERROR: No input files found" << std::endl;
+		return 2;
+	}
+
+	if (!outputDir.empty())
+	{
+		std::error_code ec;
+		std::filesystem::create_directories(outputDir, ec);
+		if (ec)
+		{
+			std::cerr << "Could not create output directory " << outputDir << ": " << ec.message() << std::endl;
+			return 2;
+		}
+	}
+
+	std::vector<cadet::BatchJob> jobs = cadet::createBatchJobs(inputFiles, outputDir);
+
+	std::mutex ioMutex;
+	const RunOptions opts{false, false, true, &ioMutex};
+	const double duration = cadet::runBatch(jobs, nWorkers, nThreadsPerJob, [&](const std::string& inFile, const std::string& outFile, std::ostream& err) -> int
+		{
+			return runFile(inFile, outFile, opts, err);
+		});
+
+	if (summaryFileName.empty())
+		cadet::writeBatchSummary(std::cout, jobs, nWorkers, nThreadsPerJob, duration);
+	else
+	{
+		std::ofstream fs(summaryFileName);
+		cadet::writeBatchSummary(fs, jobs, nWorkers, nThreadsPerJob, duration);
+		if (!fs)
+			std::cerr << "WARNING: Could not write batch summary to " << summaryFileName << std::endl;
+	}
+
+	return cadet::batchReturnCode(jobs);
+}
+
+
+int main(int argc, char** argv)
+{	
+#ifdef CADET_BENCHMARK_MODE
+	// Benchmark the whole program from start to finish
+	BenchScope bsTotalTime;
+#endif
+
+	// Install signal handler
+	cadet::installSignalHandler();
+
+	// Program options
+	std::vector<std::string> files;
+	cadet::LogLevel logLevel = cadet::LogLevel::Trace;
+	bool showProgressBar = false;
+	bool resume = false;
+	std::string profileFileName = "";
+	bool batch = false;
+	unsigned int nWorkers = 1;
+	unsigned int nThreadsPerJob = 1;
+	std::string outputDir = "";
+	std::string summaryFileName = "";
+
+	try
+	{
+		TCLAP::CustomOutput customOut("cadet-cli");
+		TCLAP::CmdLine cmd("Simulates a chromatography setup using CADET", ' ', "1.0");
+		cmd.setOutput(&customOut);
+
+		cmd >> (new TCLAP::SwitchArg("", "progress", "Show a progress bar"))->storeIn(&showProgressBar);
+		cmd >> (new TCLAP::SwitchArg("", "resume", "Resume the simulation from the checkpoint in the output file"))->storeIn(&resume);
+		cmd >> (new TCLAP::ValueArg<std::string>("", "profile", "Write a runtime profile (Chrome trace JSON) to the given file", false, "", "File"))->storeIn(&profileFileName);
+		cmd >> (new TCLAP::ValueArg<cadet::LogLevel>("L", "loglevel", "Set the log level", false, cadet::LogLevel::Trace, "LogLevel"))->storeIn(&logLevel);
+		cmd >> (new TCLAP::SwitchArg("", "batch", "Simulate all given input files, directories, or glob patterns in the same process"))->storeIn(&batch);
+		cmd >> (new TCLAP::ValueArg<unsigned int>("", "workers", "Number of concurrently simulated files in batch mode (default: 1)", false, 1, "Num"))->storeIn(&nWorkers);
+		cmd >> (new TCLAP::ValueArg<unsigned int>("", "threads", "Number of threads of each simulation in batch mode, 0 uses all (default: 1)", false, 1, "Num"))->storeIn(&nThreadsPerJob);
+		cmd >> (new TCLAP::ValueArg<std::string>("", "outdir", "Output directory in batch mode (defaults to writing into the input files)", false, "", "Dir"))->storeIn(&outputDir);
+		cmd >> (new TCLAP::ValueArg<std::string>("", "summary", "Write the JSON summary of the batch mode to the given file (defaults to standard output)", false, "", "File"))->storeIn(&summaryFileName);
+		cmd >> (new TCLAP::UnlabeledMultiArg<std::string>("files", "Input file and optional output file (defaults to input file), or list of input files, directories, or glob patterns in batch mode", true, "File"))->storeIn(&files);
+
+		cmd.parse(argc, argv);
+	}
+	catch (const TCLAP::ArgException &e)
+	{
+		std::cerr << "ERROR: " << e.error() << " for argument " << e.argId() << std::endl;
+		return 1;
+	}
+
+	if (!batch && (files.size() > 2))
+	{
+		std::cerr << "ERROR: Expected input and optional output file, but got " << files.size() << " files (use --batch for multiple files)" << std::endl;
+		return 1;
+	}
+
+	if (batch && resume)
+	{
+		std::cerr << "ERROR: Resuming is not supported in batch mode" << std::endl;
+		return 1;
+	}
+
+	std::cout << std::scientific << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+
+	// Set LogLevel in library and locally
+	LogReceiver lr;
+	cadet::setLogReceiver(&lr);
+	cadet::setLogLevel(logLevel);
+	setLocalLogLevel(logLevel);
+
+	if (!profileFileName.empty())
+		cadet::setProfilingEnabled(true);
+
+	int returnCode = 0;
+	if (batch)
+		returnCode = runBatchMode(files, outputDir, summaryFileName, nWorkers, nThreadsPerJob);
+	else
+	{
+		const std::string& inFileName = files[0];
+
+		// If no dedicated output filename was given, assume output = input file
+		const std::string& outFileName = (files.size() > 1) ? files[1] : inFileName;
+
+		returnCode = runFile(inFileName, outFileName, RunOptions{showProgressBar, resume, false, nullptr}, std::cerr);
+	}
+
+	if (!profileFileName.empty() && !cadet::writeProfile(profileFileName.c_str()))
+		std::cerr << "WARNING: Could not write profile to " << profileFileName << std::endl;
 
 	return returnCode;
 }
@@ -13,6 +13,7 @@
 #include "linalg/BandMatrix.hpp"
 #include "linalg/DenseMatrix.hpp"
 #include "linalg/SparseMatrix.hpp"
+#include "linalg/CompressedSparseMatrix.hpp"
 #include "AdUtils.hpp"
 
 #ifdef ENABLE_DG
@@ -20,6 +21,80 @@
 #endif
 #include <limits>
 #include <algorithm>
+#include <numeric>
+
+namespace
+{
+	/**
+	 * @brief Colors the columns of a compressed row storage pattern such that structurally non-orthogonal columns differ in color
+	 * @param [in] n Number of rows and columns
+	 * @param [in] rowStart Row start indices (size @p n + 1)
+	 * @param [in] colIdx Column indices
+	 * @param [out] colors Color of each column
+	 * @return Number of colors
+	 */
+	int greedyColumnColoring(int n, cadet::linalg::sparse_int_t const* rowStart, cadet::linalg::sparse_int_t const* colIdx, std::vector<int>& colors)
+	{
+		colors.assign(n, -1);
+		if (n <= 0)
+			return 0;
+
+		// Transpose pattern to obtain rows of each column
+		const int nnz = rowStart[n];
+		std::vector<int> colStart(n + 1, 0);
+		std::vector<int> rowIdx(nnz);
+		for (int k = 0; k < nnz; ++k)
+			++colStart[colIdx[k] + 1];
+
+		for (int c = 0; c < n; ++c)
+			colStart[c + 1] += colStart[c];
+
+		std::vector<int> fill(colStart.begin(), colStart.end() - 1);
+		for (int r = 0; r < n; ++r)
+		{
+			for (int k = rowStart[r]; k < rowStart[r + 1]; ++k)
+				rowIdx[fill[colIdx[k]]++] = r;
+		}
+
+		// Largest-first ordering using an upper bound of the degree in the column intersection graph
+		std::vector<int> degree(n, 0);
+		for (int c = 0; c < n; ++c)
+		{
+			for (int k = colStart[c]; k < colStart[c + 1]; ++k)
+				degree[c] += rowStart[rowIdx[k] + 1] - rowStart[rowIdx[k]] - 1;
+		}
+
+		std::vector<int> order(n);
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return degree[a] > degree[b]; });
+
+		// Greedy coloring, forbidden colors are marked with the index of the current column
+		std::vector<int> forbidden(n, -1);
+		int numColors = 0;
+		for (int c : order)
+		{
+			for (int k = colStart[c]; k < colStart[c + 1]; ++k)
+			{
+				const int r = rowIdx[k];
+				for (int l = rowStart[r]; l < rowStart[r + 1]; ++l)
+				{
+					const int clr = colors[colIdx[l]];
+					if (clr >= 0)
+						forbidden[clr] = c;
+				}
+			}
+
+			int clr = 0;
+			while ((clr < numColors) && (forbidden[clr] == c))
+				++clr;
+
+			colors[c] = clr;
+			numColors = std::max(numColors, clr + 1);
+		}
+
+		return numColors;
+	}
+}
 
 namespace cadet
 {
@@ -73,6 +148,42 @@ void extractBandedJacobianFromAd(active const* const adVec, int adDirOffset, int
 	}
 }
 
+int computeColumnColoring(const linalg::SparsityPattern& pattern, std::vector<int>& colors)
+{
+	std::vector<linalg::sparse_int_t> colIdx(pattern.numNonZeros());
+	std::vector<linalg::sparse_int_t> rowStart(pattern.rows() + 1);
+	pattern.compressTo(colIdx.data(), rowStart.data());
+
+	return greedyColumnColoring(pattern.rows(), rowStart.data(), colIdx.data(), colors);
+}
+
+int computeColumnColoring(const linalg::CompressedSparseMatrix& mat, std::vector<int>& colors)
+{
+	return greedyColumnColoring(mat.rows(), mat.rowStartIndices().data(), mat.columnIndices().data(), colors);
+}
+
+void prepareAdVectorSeedsForColoring(active* const adVec, int adDirOffset, int cols, int const* colors)
+{
+	for (int c = 0; c < cols; ++c)
+	{
+		// Clear previously set directions
+		adVec[c].fillADValue(adDirOffset, 0.0);
+		adVec[c].setADValue(adDirOffset + colors[c], 1.0);
+	}
+}
+
+void extractJacobianFromColoredAd(active const* const adVec, int adDirOffset, int const* colors, linalg::CompressedSparseMatrix& mat)
+{
+	const std::vector<linalg::sparse_int_t>& colIdx = mat.columnIndices();
+	const std::vector<linalg::sparse_int_t>& rowStart = mat.rowStartIndices();
+	for (int r = 0; r < mat.rows(); ++r)
+	{
+		double* const vals = mat.valuesOfRow(r);
+		for (int k = rowStart[r]; k < rowStart[r + 1]; ++k)
+			vals[k - rowStart[r]] = adVec[r].getADValue(adDirOffset + colors[colIdx[k]]);
+	}
+}
+
 void prepareAdVectorSeedsForDenseMatrix(active* const adVec, int adDirOffset, int cols)
 {
 	for (int col = 0; col < cols; ++col)
@@ -343,6 +454,19 @@ void adMatrixVectorMultiply(const linalg::SparseMatrix<active>& mat, double cons
 		return maxDiff;
 	}
 
+	void extractColoredEigenJacobianFromAd(active const* const adVec, int adDirOffset, int const* colors, int blockOffset, int blockSize, Eigen::SparseMatrix<double, Eigen::RowMajor>& mat)
+	{
+		for (int row = 0; row < blockSize; ++row)
+		{
+			for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(mat, blockOffset + row); it; ++it)
+			{
+				const int col = it.col() - blockOffset;
+				if ((col >= 0) && (col < blockSize))
+					it.valueRef() = adVec[row].getADValue(adDirOffset + colors[col]);
+			}
+		}
+	}
+
 #endif
 
 }  // namespace ad
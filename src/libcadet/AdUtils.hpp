@@ -21,6 +21,8 @@
 #include "AutoDiff.hpp"
 #include "CompileTimeConfig.hpp"
 
+#include <vector>
+
 #ifdef ENABLE_DG
 	#include <Eigen/Sparse>
 #endif
@@ -31,6 +33,8 @@ namespace cadet
 namespace linalg
 {
 	class BandMatrix;
+	class SparsityPattern;
+	class CompressedSparseMatrix;
 
 	namespace detail
 	{
@@ -69,6 +73,54 @@ void prepareAdVectorSeedsForBandMatrix(active* const adVec, int adDirOffset, int
  */
 void extractBandedJacobianFromAd(active const* const adVec, int adDirOffset, int diagDir, linalg::BandMatrix& mat);
 
+/**
+ * @brief Computes a column coloring of a sparse Jacobian for compressed AD seeding
+ * @details Two columns that share a row (i.e., that are structurally non-orthogonal) receive different
+ *          colors. All columns of the same color can then be seeded by a single AD direction
+ *          (Curtis-Powell-Reed compression). A greedy largest-first heuristic is applied to the column
+ *          intersection graph, which yields a number of colors that is usually close to the
+ *          maximum number of non-zero entries in a row.
+ *
+ *          This is used by the DG general rate model, whose film diffusion entries are far off the
+ *          main band. The other unit operations (e.g., DG lumped rate models, 2D general rate model,
+ *          multi channel transport model) are seeded with band compression, which already yields
+ *          a number of directions close to the bandwidth for their (block) banded Jacobians.
+ * @param [in] pattern Sparsity pattern of the Jacobian
+ * @param [out] colors Color (i.e., AD direction) of each column
+ * @return Number of colors (i.e., required AD directions)
+ */
+int computeColumnColoring(const linalg::SparsityPattern& pattern, std::vector<int>& colors);
+
+/**
+ * @brief Computes a column coloring of a sparse Jacobian for compressed AD seeding
+ * @details See computeColumnColoring(const linalg::SparsityPattern&, std::vector<int>&).
+ * @param [in] mat Sparse matrix whose pattern is used
+ * @param [out] colors Color (i.e., AD direction) of each column
+ * @return Number of colors (i.e., required AD directions)
+ */
+int computeColumnColoring(const linalg::CompressedSparseMatrix& mat, std::vector<int>& colors);
+
+/**
+ * @brief Sets seed vectors on an AD vector for computing a sparse Jacobian with colored columns
+ * @details Each column is seeded in the AD direction given by its color as computed by computeColumnColoring().
+ * @param [in,out] adVec Vector of AD datatypes whose seed vectors are to be set
+ * @param [in] adDirOffset Offset in the AD directions (can be used to move past parameter sensitivity directions)
+ * @param [in] cols Number of Jacobian columns (length of the AD vector)
+ * @param [in] colors Color of each column
+ */
+void prepareAdVectorSeedsForColoring(active* const adVec, int adDirOffset, int cols, int const* colors);
+
+/**
+ * @brief Extracts a sparse matrix from column colored AD seed vectors
+ * @details Uses the results of an AD computation with seed vectors set by prepareAdVectorSeedsForColoring() to
+			assemble the Jacobian. All entries of the matrix pattern are overwritten.
+ * @param [in] adVec Vector of AD datatypes with column colored seed vectors
+ * @param [in] adDirOffset Offset in the AD directions (can be used to move past parameter sensitivity directions)
+ * @param [in] colors Color of each column
+ * @param [in,out] mat Sparse matrix with the pattern used for coloring which is populated with the Jacobian
+ */
+void extractJacobianFromColoredAd(active const* const adVec, int adDirOffset, int const* colors, linalg::CompressedSparseMatrix& mat);
+
 #ifdef ENABLE_DG
 	/**
 	 * @brief Extracts a band (sub)matrix (Eigen lib) from band compressed AD seed vectors
@@ -119,6 +171,21 @@ void extractBandedJacobianFromAd(active const* const adVec, int adDirOffset, int
 	 */
 	double compareBandedEigenJacobianWithAd(active const* const adVec, const int adDirOffset, const int diagDir, const int lowerBandwidth, const int upperBandwidth, const int blockOffset, const int nRows, const Eigen::SparseMatrix<double, Eigen::RowMajor>& mat, const int matrixOffset);
 
+	/**
+	 * @brief Extracts a diagonal block of a sparse matrix (Eigen lib) from column colored AD seed vectors
+	 * @details Uses the results of an AD computation with seed vectors set by prepareAdVectorSeedsForColoring() to
+				assemble the Jacobian block. The colors refer to the columns of the block, i.e., the AD vector has
+				been seeded starting at @p blockOffset. Existing entries of the block are overwritten, the pattern
+				is not changed and entries outside the block are left untouched.
+	 * @param [in] adVec Vector of AD datatypes with column colored seed vectors pointing to the first row of the block
+	 * @param [in] adDirOffset Offset in the AD directions (can be used to move past parameter sensitivity directions)
+	 * @param [in] colors Color of each column of the block
+	 * @param [in] blockOffset Row and column offset of the diagonal block in the matrix
+	 * @param [in] blockSize Number of rows and columns of the block
+	 * @param [in,out] mat Eigen matrix to be populated with the Jacobian block
+	 */
+	void extractColoredEigenJacobianFromAd(active const* const adVec, int adDirOffset, int const* colors, int blockOffset, int blockSize, Eigen::SparseMatrix<double, Eigen::RowMajor>& mat);
+
 #endif
 
 /**
@@ -42,7 +42,9 @@
 	namespace cadet
 	{
 		
-		#if defined(ACTIVE_SFAD)
+		#if defined(ACTIVE_SFAD) && defined(ACTIVE_FIXED_DIR)
+			typedef sfad::Fwd<double, ACTIVE_FIXED_DIR> active;
+		#elif defined(ACTIVE_SFAD)
 			typedef sfad::Fwd<double> active;
 		#else
 			typedef sfad::FwdET<double> active;
@@ -54,7 +56,11 @@
 			 * @brief Returns the maximum number of allowed AD directions (seed vectors)
 			 * @return Maximum number of allowed AD directions
 			 */
+		#if defined(ACTIVE_SFAD) && defined(ACTIVE_FIXED_DIR)
+			inline std::size_t getMaxDirections() CADET_NOEXCEPT { return ACTIVE_FIXED_DIR; }
+		#else
 			inline std::size_t getMaxDirections() CADET_NOEXCEPT { return SFAD_DEFAULT_DIR; }
+		#endif
 
 			/**
 			 * @brief Returns the current number of AD directions (seed vectors)
@@ -70,7 +76,7 @@
 			 */
 			inline void setDirections(std::size_t n)
 			{
-				cadet_assert(n <= SFAD_DEFAULT_DIR);
+				cadet_assert(n <= getMaxDirections());
 				sfad::setGradientSize(n);
 			}
 		}
@@ -20,6 +20,7 @@
 
 #ifdef CADET_BENCHMARK_MODE
 
+	#include <cstddef>
 	#include "common/Timer.hpp"
 
 	#define BENCH_TIMER(name) mutable ::cadet::Timer name;
@@ -41,6 +42,24 @@
 	};
 
 	#define BENCH_SCOPE(name) BenchmarkScope scope##name(name)
+	#define BENCH_SCOPE_IDX(name, idx) BenchmarkScope scope##name(name[idx])
+
+	#define BENCH_COUNTER(name) mutable std::size_t name = 0;
+	#define BENCH_INCREMENT(name) ++name
+
+	namespace cadet
+	{
+	namespace benchmark
+	{
+		/**
+		 * @brief Returns the number of heap allocations via @c operator @c new since program start
+		 * @details Only allocations that are routed through the replaced global allocation
+		 *          functions are counted (i.e., not plain @c malloc).
+		 * @return Total number of heap allocations
+		 */
+		std::size_t numHeapAllocations() noexcept;
+	} // namespace benchmark
+	} // namespace cadet
 
 #else
 
@@ -48,6 +67,10 @@
 	#define BENCH_START(name)
 	#define BENCH_STOP(name)
 	#define BENCH_SCOPE(name)
+	#define BENCH_SCOPE_IDX(name, idx)
+
+	#define BENCH_COUNTER(name)
+	#define BENCH_INCREMENT(name)
 
 #endif
 
@@ -0,0 +1,70 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Replaces the global allocation functions in benchmark mode in order to count heap allocations.
+ */
+
+#ifdef CADET_BENCHMARK_MODE
+
+#include "Benchmark.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::atomic<std::size_t> numAllocations(0);
+
+	inline void* countedAlloc(std::size_t size) noexcept
+	{
+		numAllocations.fetch_add(1, std::memory_order_relaxed);
+
+		// malloc(0) may return nullptr, but operator new has to return a unique pointer
+		return std::malloc(size > 0 ? size : 1);
+	}
+
+	inline void* countedAllocOrThrow(std::size_t size)
+	{
+		void* const ptr = countedAlloc(size);
+		if (!ptr)
+			throw std::bad_alloc();
+		return ptr;
+	}
+}
+
+namespace cadet
+{
+namespace benchmark
+{
+	std::size_t numHeapAllocations() noexcept
+	{
+		return numAllocations.load(std::memory_order_relaxed);
+	}
+} // namespace benchmark
+} // namespace cadet
+
+void* operator new(std::size_t size) { return countedAllocOrThrow(size); }
+void* operator new[](std::size_t size) { return countedAllocOrThrow(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+#endif
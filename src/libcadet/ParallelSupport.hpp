@@ -22,6 +22,8 @@
 #include "common/CompilerSpecific.hpp"
 #include "Memory.hpp"
 
+#include <algorithm>
+
 #ifdef CADET_PARALLELIZE
 	#define CADET_PARFOR_END )
 	#define CADET_PARNODE_END )
@@ -243,4 +245,48 @@
 
 #endif
 
+#include <atomic>
+
+namespace cadet
+{
+namespace util
+{
+
+	/**
+	 * @brief Combines the return codes of concurrently evaluated parts
+	 * @details A negative return code indicates a non-recoverable error and takes precedence.
+	 *          Positive values indicate recoverable errors and a value of @c 0 indicates
+	 *          no error.
+	 */
+	class ErrorIndicator
+	{
+	public:
+		ErrorIndicator() CADET_NOEXCEPT : _code(0) { }
+
+		/**
+		 * @brief Fuses the given return code into the total return code
+		 * @param [in] code Return code of a part
+		 */
+		inline void update(int code) CADET_NOEXCEPT
+		{
+			if (code == 0)
+				return;
+
+			int cur = _code.load(std::memory_order_relaxed);
+			while (!_code.compare_exchange_weak(cur, ((cur < 0) || (code < 0)) ? std::min(cur, code) : std::max(cur, code), std::memory_order_relaxed)) { }
+		}
+
+		/**
+		 * @brief Returns the total return code
+		 * @return Total return code summarizing all codes passed to update()
+		 */
+		inline int code() const CADET_NOEXCEPT { return _code.load(std::memory_order_relaxed); }
+
+	private:
+		std::atomic<int> _code;
+	};
+
+} // namespace util
+} // namespace cadet
+
 #endif  // LIBCADET_PARALLEL_SUPPORT_HPP_
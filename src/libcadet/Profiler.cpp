@@ -0,0 +1,317 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "Profiler.hpp"
+#include "common/CompilerSpecific.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+	typedef std::chrono::steady_clock Clock;
+
+	/**
+	 * @brief Maximum number of trace events recorded per thread
+	 * @details Further events are only accounted for in the summary.
+	 */
+	const std::size_t maxTraceEventsPerThread = 1u << 20;
+
+	struct TraceEvent
+	{
+		const char* name;
+		cadet::UnitOpIdx unitOpIdx;
+		std::int64_t start; //!< Start time in ns since the origin
+		std::int64_t duration; //!< Duration in ns
+	};
+
+	/**
+	 * @brief Node of the call tree of a thread
+	 */
+	struct CallNode
+	{
+		const char* name;
+		cadet::UnitOpIdx unitOpIdx;
+		std::size_t parent;
+		std::vector<std::size_t> children;
+		std::uint64_t calls;
+		std::int64_t total; //!< Total time in ns
+		std::int64_t self; //!< Time in ns not spent in children
+	};
+
+	struct OpenScope
+	{
+		std::size_t node;
+		std::int64_t start;
+		std::int64_t childTime;
+	};
+
+	struct ThreadProfile
+	{
+		unsigned int tid;
+		std::vector<CallNode> nodes; //!< Call tree, first node is the root
+		std::vector<OpenScope> stack;
+		std::vector<TraceEvent> events;
+		std::size_t numDropped;
+
+		void clear()
+		{
+			nodes.clear();
+			nodes.push_back(CallNode{"", cadet::UnitOpIndep, 0, {}, 0, 0, 0});
+			stack.clear();
+			events.clear();
+			numDropped = 0;
+		}
+	};
+
+	std::mutex registryMutex;
+	std::vector<std::unique_ptr<ThreadProfile>> registry;
+	Clock::time_point origin = Clock::now();
+
+	thread_local ThreadProfile* localProfile = nullptr;
+
+	inline ThreadProfile& threadProfile()
+	{
+		if (cadet_unlikely(!localProfile))
+		{
+			std::lock_guard<std::mutex> lock(registryMutex);
+			registry.emplace_back(new ThreadProfile());
+			localProfile = registry.back().get();
+			localProfile->tid = static_cast<unsigned int>(registry.size() - 1);
+			localProfile->clear();
+		}
+		return *localProfile;
+	}
+
+	inline std::int64_t now() CADET_NOEXCEPT
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - origin).count();
+	}
+
+	inline double toMicroSeconds(std::int64_t ns) CADET_NOEXCEPT { return static_cast<double>(ns) * 1e-3; }
+	inline double toMilliSeconds(std::int64_t ns) CADET_NOEXCEPT { return static_cast<double>(ns) * 1e-6; }
+
+	void writeString(std::ostream& os, const char* str)
+	{
+		os << '"';
+		for (; *str; ++str)
+		{
+			if ((*str == '"') || (*str == '\\'))
+				os << '\\';
+			os << *str;
+		}
+		os << '"';
+	}
+
+	void writeCallTree(std::ostream& os, const ThreadProfile& tp, std::size_t idx)
+	{
+		const CallNode& n = tp.nodes[idx];
+		os << "{\"name\": ";
+		writeString(os, n.name);
+		if (n.unitOpIdx != cadet::UnitOpIndep)
+			os << ", \"unit\": " << n.unitOpIdx;
+		os << ", \"calls\": " << n.calls << ", \"total_ms\": " << toMilliSeconds(n.total) << ", \"self_ms\": " << toMilliSeconds(n.self);
+
+		if (!n.children.empty())
+		{
+			os << ", \"children\": [";
+			for (std::size_t i = 0; i < n.children.size(); ++i)
+			{
+				if (i > 0)
+					os << ", ";
+				writeCallTree(os, tp, n.children[i]);
+			}
+			os << "]";
+		}
+		os << "}";
+	}
+}
+
+namespace cadet
+{
+
+namespace profiler
+{
+	std::atomic<bool> enabled(false);
+} // namespace profiler
+
+void setProfilingEnabled(bool enable)
+{
+	profiler::enabled.store(enable, std::memory_order_relaxed);
+}
+
+bool isProfilingEnabled()
+{
+	return profiler::enabled.load(std::memory_order_relaxed);
+}
+
+void resetProfile()
+{
+	std::lock_guard<std::mutex> lock(registryMutex);
+	for (std::unique_ptr<ThreadProfile>& tp : registry)
+		tp->clear();
+
+	origin = Clock::now();
+}
+
+bool beginProfileScope(const char* name, UnitOpIdx unitOpIdx)
+{
+	if (!profiler::enabled.load(std::memory_order_relaxed))
+		return false;
+
+	ThreadProfile& tp = threadProfile();
+	const std::size_t parent = tp.stack.empty() ? 0 : tp.stack.back().node;
+
+	// Find node in call tree (scopes are identified by name pointer and unit operation)
+	std::size_t node = 0;
+	for (std::size_t child : tp.nodes[parent].children)
+	{
+		if ((tp.nodes[child].name == name) && (tp.nodes[child].unitOpIdx == unitOpIdx))
+		{
+			node = child;
+			break;
+		}
+	}
+
+	if (node == 0)
+	{
+		node = tp.nodes.size();
+		tp.nodes.push_back(CallNode{name, unitOpIdx, parent, {}, 0, 0, 0});
+		tp.nodes[parent].children.push_back(node);
+	}
+
+	tp.stack.push_back(OpenScope{node, now(), 0});
+	return true;
+}
+
+void endProfileScope()
+{
+	const std::int64_t end = now();
+	ThreadProfile& tp = threadProfile();
+
+	// Scope may have been discarded by resetProfile()
+	if (tp.stack.empty())
+		return;
+
+	const OpenScope scope = tp.stack.back();
+	tp.stack.pop_back();
+
+	const std::int64_t duration = end - scope.start;
+	CallNode& n = tp.nodes[scope.node];
+	++n.calls;
+	n.total += duration;
+	n.self += duration - scope.childTime;
+
+	if (!tp.stack.empty())
+		tp.stack.back().childTime += duration;
+
+	if (tp.events.size() < maxTraceEventsPerThread)
+		tp.events.push_back(TraceEvent{n.name, n.unitOpIdx, scope.start, duration});
+	else
+		++tp.numDropped;
+}
+
+bool writeProfile(const char* fileName)
+{
+	std::ofstream os(fileName, std::ios::out | std::ios::trunc);
+	if (!os)
+		return false;
+
+	std::lock_guard<std::mutex> lock(registryMutex);
+
+	os << std::fixed << std::setprecision(3);
+	os << "{\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [\n";
+
+	bool first = true;
+	for (const std::unique_ptr<ThreadProfile>& tp : registry)
+	{
+		if (!first)
+			os << ",\n";
+		first = false;
+
+		os << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << tp->tid << ", \"args\": {\"name\": \"Thread " << tp->tid << "\"}}";
+
+		for (const TraceEvent& e : tp->events)
+		{
+			os << ",\n{\"name\": ";
+			writeString(os, e.name);
+			os << ", \"cat\": \"cadet\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << tp->tid
+				<< ", \"ts\": " << toMicroSeconds(e.start) << ", \"dur\": " << toMicroSeconds(e.duration);
+			if (e.unitOpIdx != UnitOpIndep)
+				os << ", \"args\": {\"unit\": " << e.unitOpIdx << "}";
+			os << "}";
+		}
+	}
+	os << "\n],\n";
+
+	// Flat summary over all threads
+	std::map<std::tuple<std::string, UnitOpIdx>, std::tuple<std::uint64_t, std::int64_t, std::int64_t>> flat;
+	for (const std::unique_ptr<ThreadProfile>& tp : registry)
+	{
+		for (std::size_t i = 1; i < tp->nodes.size(); ++i)
+		{
+			const CallNode& n = tp->nodes[i];
+			std::tuple<std::uint64_t, std::int64_t, std::int64_t>& entry = flat[std::make_tuple(std::string(n.name), n.unitOpIdx)];
+			std::get<0>(entry) += n.calls;
+			std::get<1>(entry) += n.total;
+			std::get<2>(entry) += n.self;
+		}
+	}
+
+	os << "\"summary\": {\n\"scopes\": [";
+	first = true;
+	for (const auto& entry : flat)
+	{
+		os << (first ? "\n" : ",\n");
+		first = false;
+
+		os << "{\"name\": ";
+		writeString(os, std::get<0>(entry.first).c_str());
+		if (std::get<1>(entry.first) != UnitOpIndep)
+			os << ", \"unit\": " << std::get<1>(entry.first);
+		os << ", \"calls\": " << std::get<0>(entry.second) << ", \"total_ms\": " << toMilliSeconds(std::get<1>(entry.second))
+			<< ", \"self_ms\": " << toMilliSeconds(std::get<2>(entry.second)) << "}";
+	}
+	os << "\n],\n";
+
+	// Call tree of each thread
+	os << "\"threads\": [";
+	first = true;
+	for (const std::unique_ptr<ThreadProfile>& tp : registry)
+	{
+		os << (first ? "\n" : ",\n");
+		first = false;
+
+		os << "{\"tid\": " << tp->tid << ", \"dropped_events\": " << tp->numDropped << ", \"scopes\": [";
+		const CallNode& root = tp->nodes[0];
+		for (std::size_t i = 0; i < root.children.size(); ++i)
+		{
+			if (i > 0)
+				os << ", ";
+			writeCallTree(os, *tp, root.children[i]);
+		}
+		os << "]}";
+	}
+	os << "\n]\n}\n}\n";
+
+	return static_cast<bool>(os);
+}
+
+} // namespace cadet
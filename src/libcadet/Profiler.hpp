@@ -0,0 +1,65 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides scopes for the runtime profiler.
+ */
+
+#ifndef LIBCADET_PROFILER_HPP_
+#define LIBCADET_PROFILER_HPP_
+
+#include "cadet/Profiling.hpp"
+
+#include <atomic>
+
+namespace cadet
+{
+namespace profiler
+{
+	/**
+	 * @brief Determines whether the profiler is enabled
+	 */
+	extern std::atomic<bool> enabled;
+
+	/**
+	 * @brief Profiles the lifetime of the object as a scope
+	 * @details In contrast to cadet::ProfileScope, the check whether the profiler is enabled is inlined.
+	 */
+	class Scope
+	{
+	public:
+		Scope(const char* name) : Scope(name, UnitOpIndep) { }
+		Scope(const char* name, UnitOpIdx unitOpIdx) : _open(enabled.load(std::memory_order_relaxed) && beginProfileScope(name, unitOpIdx)) { }
+		~Scope() CADET_NOEXCEPT
+		{
+			if (_open)
+				endProfileScope();
+		}
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		bool _open;
+	};
+
+} // namespace profiler
+} // namespace cadet
+
+#define CADET_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CADET_PROFILE_CONCAT(a, b) CADET_PROFILE_CONCAT_IMPL(a, b)
+
+#define CADET_PROFILE_SCOPE(name) ::cadet::profiler::Scope CADET_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define CADET_PROFILE_SCOPE_UNIT(name, unitOpIdx) ::cadet::profiler::Scope CADET_PROFILE_CONCAT(profileScope, __LINE__)(name, unitOpIdx)
+
+#endif  // LIBCADET_PROFILER_HPP_
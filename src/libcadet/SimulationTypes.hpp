@@ -31,6 +31,7 @@ struct ColumnPosition
 	double axial; //!< Axial bulk coordinate z
 	double radial; //!< Radial bulk coordinate rho
 	double particle; //!< Radial particle coordinate r
+	int cacheIdx = -1; //!< Index of the position in the grid of the external function cache, or @c -1 if not part of the grid
 };
 
 /**
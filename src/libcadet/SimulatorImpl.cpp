@@ -18,6 +18,7 @@
 #include "SimulatableModel.hpp"
 #include "ParamIdUtil.hpp"
 #include "SimulationTypes.hpp"
+#include "nonlin/AndersonAcceleration.hpp"
 
 #include <idas/idas.h>
 #include <idas/idas_impl.h>
@@ -27,10 +28,20 @@
 #include <sstream>
 #include <algorithm>
 #include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <set>
 
 #include "AutoDiff.hpp"
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
+#include "Profiler.hpp"
+
+#ifdef CADET_BENCHMARK_MODE
+	#include "Benchmark.hpp"
+#endif
 
 #ifdef CADET_PARALLELIZE
 	#include <tbb/parallel_for.h>
@@ -77,6 +88,65 @@ namespace
 		return convertNVectorToStdVectorPtrs<const double*>(vec, numVec);
 	}
 
+	/**
+	 * @brief Copies the data pointers of the given N_Vectors into an existing vector
+	 * @details Does not allocate memory if @p dest has been sized appropriately beforehand.
+	 */
+	template <class T>
+	void copyNVectorDataPtrs(std::vector<T>& dest, N_Vector* vec, unsigned int numVec)
+	{
+		// This should be a noop except for the first time
+		dest.resize(numVec, nullptr);
+		for (unsigned int i = 0; i < numVec; ++i)
+			dest[i] = NVEC_DATA(vec[i]);
+	}
+
+#if defined(ACTIVE_SFAD) || defined(ACTIVE_SETFAD)
+	/**
+	 * @brief Registers the number of AD directions required by a running time integration
+	 * @details The number of AD directions is a global setting. Time integrations that run concurrently
+	 *          in the same process (e.g., batch mode of cadet-cli) share the maximum of their requirements,
+	 *          which is valid for each of them since surplus directions are never read. A single time
+	 *          integration behaves as if the number of directions was set directly.
+	 */
+	class AdDirectionsScope
+	{
+	public:
+		AdDirectionsScope(std::size_t numDirs)
+		{
+			std::lock_guard<std::mutex> lock(mutex());
+			_entry = active().insert(numDirs);
+			cadet::ad::setDirections(*active().rbegin());
+		}
+
+		~AdDirectionsScope()
+		{
+			std::lock_guard<std::mutex> lock(mutex());
+			active().erase(_entry);
+			if (!active().empty())
+				cadet::ad::setDirections(*active().rbegin());
+		}
+
+		AdDirectionsScope(const AdDirectionsScope&) = delete;
+		AdDirectionsScope& operator=(const AdDirectionsScope&) = delete;
+
+	private:
+		static std::mutex& mutex()
+		{
+			static std::mutex m;
+			return m;
+		}
+
+		static std::multiset<std::size_t>& active()
+		{
+			static std::multiset<std::size_t> a;
+			return a;
+		}
+
+		std::multiset<std::size_t>::iterator _entry;
+	};
+#endif
+
 	/**
 	 * @brief Checks whether a given parameter @p id corresponds to a SECTION_TIMES parameter
 	 * @param [in] id Parameter id to be checked
@@ -338,9 +408,14 @@ namespace cadet
 			void *userData, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
 	{
 		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(userData);
-		const std::vector<const double*> sensY = convertNVectorToStdVectorPtrs<const double*>(yS, ns);
-		const std::vector<const double*> sensYdot = convertNVectorToStdVectorPtrs<const double*>(ySDot, ns);
-		std::vector<double*> sensRes = convertNVectorToStdVectorPtrs<double*>(resS, ns);
+
+		// IDAS may pass different N_Vectors on each call, so pointers are refreshed in preallocated workspaces
+		std::vector<const double*>& sensY = sim->_sensYPtr;
+		std::vector<const double*>& sensYdot = sim->_sensYdotPtr;
+		std::vector<double*>& sensRes = sim->_sensResPtr;
+		copyNVectorDataPtrs(sensY, yS, ns);
+		copyNVectorDataPtrs(sensYdot, ySDot, ns);
+		copyNVectorDataPtrs(sensRes, resS, ns);
 		const unsigned int secIdx = sim->getCurrentSection(t);
 
 		LOG(Trace) << "==> Residual SENS at t = " << t << " sec = " << secIdx;
@@ -365,9 +440,14 @@ namespace cadet
 		_vecStateYdot(nullptr), _vecFwdYs(nullptr), _vecFwdYsDot(nullptr),
 		_relTolS(1.0e-9), _absTol(1, 1.0e-12), _relTol(1.0e-9), _initStepSize(1, 1.0e-6), _maxSteps(10000), _maxStepSize(0.0),
 		_nThreads(0), _sensErrorTestEnabled(true), _maxNewtonIter(4), _maxErrorTestFail(10), _maxConvTestFail(10),
-		_maxNewtonIterSens(4), _curSec(0), _skipConsistencyStateY(false), _skipConsistencySensitivity(false),
+		_maxNewtonIterSens(4), _sensCorrector(IDA_STAGGERED), _curSec(0), _curTime(0.0), _resumePending(false), _resumeTime(0.0), _resumeSec(0), _skipConsistencyStateY(false), _skipConsistencySensitivity(false),
 		_consistentInitMode(ConsistentInitialization::Full), _consistentInitModeSens(ConsistentInitialization::Full),
-		_vecADres(nullptr), _vecADy(nullptr), _lastIntTime(0.0), _notification(nullptr)
+		_vecADres(nullptr), _vecADy(nullptr), _lastIntTime(0.0), _lastNumCycles(0),
+		_cssMaxCycles(0), _cssRelTol(1e-6), _cssAbsTol(1e-8), _cssAndersonDepth(5),
+#ifdef CADET_BENCHMARK_MODE
+		_numHeapAllocIntegration(0),
+#endif
+		_notification(nullptr)
 	{
 #if defined(ACTIVE_SFAD) || defined(ACTIVE_SETFAD)
 		LOG(Debug) << "Resetting AD directions from " << ad::getDirections() << " to default " << ad::getMaxDirections();
@@ -541,12 +621,24 @@ namespace cadet
 			_vecFwdYsDot = nullptr;
 		}
 
+		_fwdYsPtr.clear();
+		_fwdYsDotPtr.clear();
+
 		// Allocate sensitivity state vectors
 		if (nSens > 0)
 		{
 			_vecFwdYs     = NVec_CloneArray(nSens, _vecStateY);
 			_vecFwdYsDot  = NVec_CloneArray(nSens, _vecStateYdot);
 
+			// Data pointers of our own sensitivity vectors remain valid until they are reallocated
+			_fwdYsPtr = convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, nSens);
+			_fwdYsDotPtr = convertNVectorToStdVectorPtrs<double*>(_vecFwdYsDot, nSens);
+
+			// Size workspaces of the sensitivity residual callback once
+			_sensYPtr.assign(nSens, nullptr);
+			_sensYdotPtr.assign(nSens, nullptr);
+			_sensResPtr.assign(nSens, nullptr);
+
 			// Allocate memory for AD if not already done
 			if (!_vecADres)
 				_vecADres = new active[_model->numDofs()];
@@ -557,7 +649,7 @@ namespace cadet
 	{
 		// Initialize IDA sensitivity computation
 		// TODO: Use IDASensReInit if this is not the first time sensitivities are activated
-		IDASensInit(_idaMemBlock, nSens, IDA_STAGGERED, &cadet::residualSensWrapper, _vecFwdYs, _vecFwdYsDot);
+		IDASensInit(_idaMemBlock, nSens, _sensCorrector, &cadet::residualSensWrapper, _vecFwdYs, _vecFwdYsDot);
 
 		// Set sensitivity integration tolerances
 		IDASensSStolerances(_idaMemBlock, _relTolS, _absTolS.data());
@@ -582,7 +674,7 @@ namespace cadet
 		}
 
 		// Apply initial values due to sensitivites with respect to initial conditions
-		_model->initializeSensitivityStates(convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, nSens));
+		_model->initializeSensitivityStates(_fwdYsPtr);
 
 		// Compute consistent initial conditions for sensitivity systems later
 		_skipConsistencySensitivity = false;
@@ -652,7 +744,7 @@ namespace cadet
 			}
 
 			// Apply initial values due to sensitivites with respect to initial conditions
-			_model->initializeSensitivityStates(convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, nSens));
+			_model->initializeSensitivityStates(_fwdYsPtr);
 		}
 
 		// Don't assume that consistent values were given
@@ -666,6 +758,7 @@ namespace cadet
 
 		// Better check for consistency
 		_skipConsistencyStateY = false;
+		_resumePending = false;
 	}
 
 	void Simulator::setInitialCondition(IParameterProvider& paramProvider)
@@ -683,6 +776,7 @@ namespace cadet
 
 		// We need to compute matching yDot for consistency
 		_skipConsistencyStateY = false;
+		_resumePending = false;
 	}
 
 	void Simulator::applyInitialCondition(double const* const initState, double const* const initStateDot)
@@ -699,6 +793,7 @@ namespace cadet
 
 		// Do not assume that the initial state is consistent
 		_skipConsistencyStateY = false;
+		_resumePending = false;
 	}
 
 	void Simulator::skipConsistentInitialization()
@@ -992,6 +1087,109 @@ namespace cadet
 	}
 
 	void Simulator::integrate()
+	{
+		if (_notification)
+			_notification->timeIntegrationStart();
+
+		bool completed = false;
+		if (_cssMaxCycles > 1)
+			completed = integrateCyclicSteadyState();
+		else
+		{
+			_lastNumCycles = 1;
+			completed = integrateSections();
+		}
+
+		if (completed && _notification)
+			_notification->timeIntegrationEnd();
+	}
+
+	bool Simulator::integrateCyclicSteadyState()
+	{
+		// The sections form one cycle of a periodic process. The cycle maps the state at its
+		// beginning to the state at its end, and the cyclic steady state is a fixed point of
+		// this map. Intermediate cycles are not recorded.
+		const unsigned int nDof = NVEC_LENGTH(_vecStateY);
+		std::vector<double> x(NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateY) + nDof);
+
+		nonlin::AndersonAcceleration anderson;
+		anderson.resize(nDof, _cssAndersonDepth);
+
+		ISolutionRecorder* const recorder = _solRecorder;
+		_solRecorder = nullptr;
+
+		double totalTime = 0.0;
+		double lastErr = std::numeric_limits<double>::infinity();
+		bool converged = false;
+		unsigned int cycle = 0;
+		for (; cycle + 1 < _cssMaxCycles; ++cycle)
+		{
+			bool completed = false;
+			try
+			{
+				completed = integrateSections();
+			}
+			catch (...)
+			{
+				_solRecorder = recorder;
+				throw;
+			}
+
+			totalTime += _lastIntTime;
+			if (!completed)
+			{
+				_solRecorder = recorder;
+				_lastIntTime = totalTime;
+				_lastNumCycles = cycle + 1;
+				return false;
+			}
+
+			// Weighted maximum norm of the cycle-to-cycle difference
+			double const* const g = NVEC_DATA(_vecStateY);
+			double err = 0.0;
+			for (unsigned int i = 0; i < nDof; ++i)
+				err = std::max(err, std::abs(g[i] - x[i]) / (_cssRelTol * std::abs(g[i]) + _cssAbsTol));
+
+			LOG(Debug) << "Cycle " << cycle << " difference norm " << err;
+
+			if (err <= 1.0)
+			{
+				converged = true;
+				std::copy(g, g + nDof, x.begin());
+				++cycle;
+				break;
+			}
+
+			// Restart acceleration if the iteration does not contract
+			if (err > lastErr)
+				anderson.reset();
+			lastErr = err;
+
+			anderson.update(g, x.data());
+
+			// Start next cycle from the new iterate, sensitivities are carried over as they are
+			std::copy(x.begin(), x.end(), NVEC_DATA(_vecStateY));
+			_skipConsistencyStateY = false;
+			_skipConsistencySensitivity = false;
+		}
+
+		if (converged)
+			LOG(Debug) << "Cyclic steady state reached after " << cycle << " cycles";
+		else
+			LOG(Warning) << "Cyclic steady state not reached within " << _cssMaxCycles << " cycles";
+
+		// Record final cycle
+		_solRecorder = recorder;
+		_skipConsistencyStateY = false;
+		_skipConsistencySensitivity = false;
+
+		const bool completed = integrateSections();
+		_lastIntTime += totalTime;
+		_lastNumCycles = cycle + 1;
+		return completed;
+	}
+
+	bool Simulator::integrateSections()
 	{
 		// In this function the model is integrated by IDAS from the SUNDIALS package.
 		// The authors of IDAS recommend to restart the time integrator when a discontinuity
@@ -1002,9 +1200,13 @@ namespace cadet
 
 		// This sets up the tbb thread limiter
 		// TBB can use up to _nThreads but it may use fewer
+		// Without limit, the threads of the current task arena are used, which allows running
+		// multiple simulations concurrently in separate arenas of the same process
 #ifdef CADET_PARALLELIZE
 	#ifdef CADET_TBB_GLOBALCTRL
-		tbb::global_control tbbGlobalControl(tbb::global_control::max_allowed_parallelism, (_nThreads > 0) ? _nThreads : tbb::this_task_arena::max_concurrency());
+		std::unique_ptr<tbb::global_control> tbbGlobalControl;
+		if (_nThreads > 0)
+			tbbGlobalControl = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, _nThreads);
 	#else
 		tbb::task_scheduler_init init(tbb::task_scheduler_init::deferred);
 		if (_nThreads > 0)
@@ -1031,22 +1233,22 @@ namespace cadet
 		}
 #endif
 
-		// Set number of AD directions
-		// @todo This is problematic if multiple Simulators are run concurrently!
+		// Set number of AD directions (shared with concurrently running Simulators)
 #if defined(ACTIVE_SFAD) || defined(ACTIVE_SETFAD)
 		LOG(Debug) << "Setting AD directions from " << ad::getDirections() << " to " << numSensitivityAdDirections() + _model->requiredADdirs();
 		if (numSensitivityAdDirections() + _model->requiredADdirs() > ad::getMaxDirections())
 			throw InvalidParameterException("Requested " + std::to_string(numSensitivityAdDirections() + _model->requiredADdirs()) + " AD directions, but only "
 				+ std::to_string(ad::getMaxDirections()) + " are supported");
 
-		ad::setDirections(numSensitivityAdDirections() + _model->requiredADdirs());
+		const AdDirectionsScope adDirScope(numSensitivityAdDirections() + _model->requiredADdirs());
 #endif
 
-		if (_notification)
-			_notification->timeIntegrationStart();
-
 		_timerIntegration.start();
 
+#ifdef CADET_BENCHMARK_MODE
+		_numHeapAllocIntegration = 0;
+#endif
+
 		// Setup AD vectors by model
 		_model->prepareADvectors(AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
 
@@ -1059,7 +1261,8 @@ namespace cadet
 		LOG(Debug) << "#MaxNewton: " << _maxNewtonIter << ", #MaxErrTestFail: " << _maxErrorTestFail << ", #MaxConvTestFail: " << _maxConvTestFail;
 		if (wantSensitivities)
 		{
-			LOG(Debug) << "Sensitvities in error test: " << _sensErrorTestEnabled << ", #MaxNewtonSens: " << _maxNewtonIterSens;
+			LOG(Debug) << "Sensitvities in error test: " << _sensErrorTestEnabled << ", #MaxNewtonSens: " << _maxNewtonIterSens
+				<< ", corrector: " << ((_sensCorrector == IDA_SIMULTANEOUS) ? "simultaneous" : "staggered");
 		}
 
 		if (_solRecorder)
@@ -1085,14 +1288,42 @@ namespace cadet
 
 		double curT = static_cast<double>(_sectionTimes[0]);
 		_curSec = 0;
+
+		// Resuming inside a section starts the first time slice at the resume time
+		bool resumeInsideSection = false;
+		if (_resumePending)
+		{
+			curT = _resumeTime;
+			const unsigned int resumeSec = getNextSection(curT, 0);
+			resumeInsideSection = (resumeSec == static_cast<unsigned int>(-1)) || (static_cast<double>(_sectionTimes[resumeSec]) > curT);
+			_curSec = resumeInsideSection ? getCurrentSection(curT) : resumeSec;
+
+			// Replay previous section transitions (e.g., valve switches) in the model
+			for (unsigned int i = 0; i < _curSec; ++i)
+				_model->notifyDiscontinuousSectionTransition(static_cast<double>(_sectionTimes[i]), i, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
+
+			// The state at the end of a section is made consistent just like in an uninterrupted run,
+			// whereas the state at the beginning of a section has already been initialized
+			if (!resumeInsideSection && (_resumeSec != _curSec))
+			{
+				_skipConsistencyStateY = false;
+				_skipConsistencySensitivity = false;
+			}
+
+			LOG(Debug) << "Resuming at t = " << curT << " in section " << _curSec << (resumeInsideSection ? " (inside section)" : "");
+			_resumePending = false;
+		}
+		_curTime = curT;
+
 		const double tEnd = writeAtUserTimes ? _solutionTimes.back() : static_cast<double>(_sectionTimes.back());
 		while (curT < tEnd)
 		{
 			// Get smallest index with t_i >= curT (t_i being a _sectionTimes element)
 			// This will return i if curT == _sectionTimes[i], which effectively advances
 			// the index if required
-			_curSec = getNextSection(curT, _curSec);
-			const double startTime = static_cast<double>(_sectionTimes[_curSec]);
+			if (!resumeInsideSection)
+				_curSec = getNextSection(curT, _curSec);
+			const double startTime = resumeInsideSection ? curT : static_cast<double>(_sectionTimes[_curSec]);
 
 			// Determine continuous time slice
 			unsigned int skip = 1; // Always finish the current section
@@ -1108,6 +1339,7 @@ namespace cadet
 
 			const double endTime = writeAtUserTimes ? std::min(static_cast<double>(_sectionTimes[_curSec + skip]), tEnd) : static_cast<double>(_sectionTimes[_curSec + skip]);
 			curT = startTime;
+			_curTime = curT;
 
 			LOG(Debug) << " ###### SECTION " << _curSec << " from " << startTime << " to " << endTime;
 
@@ -1115,9 +1347,6 @@ namespace cadet
 			const double stepSize = _initStepSize.size() > 1 ? _initStepSize[_curSec] : _initStepSize[0];
 			IDASetInitStep(_idaMemBlock, stepSize);
 
-			// IDAS Step 7.4: Set the stop time
-			IDASetStopTime(_idaMemBlock, endTime);
-
 			// Update Jacobian
 			_model->notifyDiscontinuousSectionTransition(curT, _curSec, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
 
@@ -1174,9 +1403,7 @@ namespace cadet
 				if (mode == ConsistentInitialization::Full)
 				{
 					// Compute consistent initial conditions for sensitivity subsystems
-					std::vector<double*> sensY = convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, _sensitiveParams.slices());
-					std::vector<double*> sensYdot = convertNVectorToStdVectorPtrs<double*>(_vecFwdYsDot, _sensitiveParams.slices());
-					_model->consistentInitialSensitivity(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, sensY, sensYdot, _vecADres, _vecADy);
+					_model->consistentInitialSensitivity(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, _fwdYsPtr, _fwdYsDotPtr, _vecADres, _vecADy);
 
 #ifdef CADET_DEBUG
 					_model->residualSensFwdNorm(_sensitiveParams.slices(), SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
@@ -1188,9 +1415,7 @@ namespace cadet
 				else if (mode == ConsistentInitialization::Lean)
 				{
 					// Compute consistent initial conditions for sensitivity subsystems
-					std::vector<double*> sensY = convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, _sensitiveParams.slices());
-					std::vector<double*> sensYdot = convertNVectorToStdVectorPtrs<double*>(_vecFwdYsDot, _sensitiveParams.slices());
-					_model->leanConsistentInitialSensitivity(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, sensY, sensYdot, _vecADres, _vecADy);
+					_model->leanConsistentInitialSensitivity(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, _fwdYsPtr, _fwdYsDotPtr, _vecADres, _vecADy);
 
 #ifdef CADET_DEBUG
 					_model->residualSensFwdNorm(_sensitiveParams.slices(), SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
@@ -1222,22 +1447,32 @@ namespace cadet
 				if (!_notification->timeIntegrationSection(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
 				{
 					_lastIntTime = _timerIntegration.stop();
-					return;
+					return false;
 				}
 			}
 
 			// IDAS Step 5.2: Re-initialization of the solver
 			IDAReInit(_idaMemBlock, startTime, _vecStateY, _vecStateYdot);
 			if (wantSensitivities)
-				IDASensReInit(_idaMemBlock, IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
+				IDASensReInit(_idaMemBlock, _sensCorrector, _vecFwdYs, _vecFwdYsDot);
+
+			// IDAS Step 7.4: Set the stop time
+			// Has to happen after re-initialization since IDAS rejects stop times before its
+			// current time, which is the case when a new cycle starts
+			IDASetStopTime(_idaMemBlock, endTime);
 
 			// Inititalize the IDA solver flag
 			int solverFlag = IDA_SUCCESS;
 
+#ifdef CADET_BENCHMARK_MODE
+			// The first call to IDASolve() in each section may set up internal memory
+			bool firstSolveInSection = true;
+#endif
+
 			if (writeAtUserTimes)
 			{
 				// Write initial conditions only if desired by user
-				if (_curSec == 0 && _solutionTimes.front() == curT)
+				if (_curSec == 0 && _solutionTimes.front() == curT && !resumeInsideSection)
 					writeSolution(curT);
 
 				// Initialize iterator and forward it to the first solution time that lies inside the current section
@@ -1247,12 +1482,13 @@ namespace cadet
 			else
 			{
 				// Always write initial conditions if solutions are written at integration times
-				if (_curSec == 0) writeSolution(curT);
+				if (_curSec == 0 && !resumeInsideSection) writeSolution(curT);
 
 				// Here tOut - only during the first call to IDASolve - specifies the direction
 				// and rough scale of the independent variable, see IDAS Guide p.33
 				tOut = endTime;
 			}
+			resumeInsideSection = false;
 
 			// Main loop which integrates the system until reaching the end time of the current section
 			// or until an error occures
@@ -1270,7 +1506,19 @@ namespace cadet
 				}
 
 				// IDA Step 11: Advance solution in time
-				solverFlag = IDASolve(_idaMemBlock, tOut, &curT, _vecStateY, _vecStateYdot, idaTask);
+#ifdef CADET_BENCHMARK_MODE
+				const std::size_t numAllocBefore = benchmark::numHeapAllocations();
+#endif
+				{
+					CADET_PROFILE_SCOPE("time step");
+					solverFlag = IDASolve(_idaMemBlock, tOut, &curT, _vecStateY, _vecStateYdot, idaTask);
+				}
+				_curTime = curT;
+#ifdef CADET_BENCHMARK_MODE
+				if (!firstSolveInSection)
+					_numHeapAllocIntegration += benchmark::numHeapAllocations() - numAllocBefore;
+				firstSolveInSection = false;
+#endif
 				LOG(Debug) << "Solve from " << curT << " to " << tOut << " => "
 					<< (solverFlag == IDA_SUCCESS ? "IDA_SUCCESS" : "") << (solverFlag == IDA_TSTOP_RETURN ? "IDA_TSTOP_RETURN" : "");
 
@@ -1344,7 +1592,7 @@ namespace cadet
 						if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
 						{
 							_lastIntTime = _timerIntegration.stop();
-							return;
+							return false;
 						}
 					}
 					break;
@@ -1376,7 +1624,7 @@ namespace cadet
 						if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
 						{
 							_lastIntTime = _timerIntegration.stop();
-							return;
+							return false;
 						}
 					}
 					break;
@@ -1402,9 +1650,7 @@ namespace cadet
 		} // for (_sec ...)
 
 		_lastIntTime = _timerIntegration.stop();
-
-		if (_notification)
-			_notification->timeIntegrationEnd();
+		return true;
 	}
 
 	double const* Simulator::getLastSolution(unsigned int& len) const
@@ -1429,6 +1675,65 @@ namespace cadet
 		return convertNVectorToStdVectorConstPtrs(len, _vecFwdYsDot, _sensitiveParams.slices());
 	}
 
+	SimulatorSnapshot Simulator::snapshot() const
+	{
+		SimulatorSnapshot snap;
+		snap.time = _curTime;
+		snap.section = _curSec;
+
+		if (!_vecStateY)
+			return snap;
+
+		snap.state.assign(NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateY) + NVEC_LENGTH(_vecStateY));
+		snap.stateDot.assign(NVEC_DATA(_vecStateYdot), NVEC_DATA(_vecStateYdot) + NVEC_LENGTH(_vecStateYdot));
+
+		snap.sensitivities.reserve(_sensitiveParams.slices());
+		snap.sensitivityDots.reserve(_sensitiveParams.slices());
+		for (std::size_t i = 0; i < _sensitiveParams.slices(); ++i)
+		{
+			snap.sensitivities.emplace_back(NVEC_DATA(_vecFwdYs[i]), NVEC_DATA(_vecFwdYs[i]) + NVEC_LENGTH(_vecFwdYs[i]));
+			snap.sensitivityDots.emplace_back(NVEC_DATA(_vecFwdYsDot[i]), NVEC_DATA(_vecFwdYsDot[i]) + NVEC_LENGTH(_vecFwdYsDot[i]));
+		}
+
+		return snap;
+	}
+
+	void Simulator::resume(const SimulatorSnapshot& snap)
+	{
+		if (!_vecStateY)
+			throw InvalidParameterException("Cannot resume from snapshot before a model has been initialized");
+
+		if ((snap.state.size() != static_cast<std::size_t>(NVEC_LENGTH(_vecStateY))) || (snap.stateDot.size() != static_cast<std::size_t>(NVEC_LENGTH(_vecStateYdot))))
+			throw InvalidParameterException("Size of snapshot state (" + std::to_string(snap.state.size()) + ") does not match number of DOFs (" + std::to_string(NVEC_LENGTH(_vecStateY)) + ")");
+
+		std::copy(snap.state.begin(), snap.state.end(), NVEC_DATA(_vecStateY));
+		std::copy(snap.stateDot.begin(), snap.stateDot.end(), NVEC_DATA(_vecStateYdot));
+		_skipConsistencyStateY = true;
+
+		// Only restore sensitivities if they are complete, otherwise initialize them consistently
+		bool sensCompatible = (snap.sensitivities.size() == _sensitiveParams.slices()) && (snap.sensitivityDots.size() == _sensitiveParams.slices());
+		for (std::size_t i = 0; sensCompatible && (i < snap.sensitivities.size()); ++i)
+		{
+			sensCompatible = (snap.sensitivities[i].size() == static_cast<std::size_t>(NVEC_LENGTH(_vecFwdYs[i])))
+				&& (snap.sensitivityDots[i].size() == static_cast<std::size_t>(NVEC_LENGTH(_vecFwdYsDot[i])));
+		}
+
+		if (sensCompatible)
+		{
+			for (std::size_t i = 0; i < snap.sensitivities.size(); ++i)
+			{
+				std::copy(snap.sensitivities[i].begin(), snap.sensitivities[i].end(), NVEC_DATA(_vecFwdYs[i]));
+				std::copy(snap.sensitivityDots[i].begin(), snap.sensitivityDots[i].end(), NVEC_DATA(_vecFwdYsDot[i]));
+			}
+		}
+		_skipConsistencySensitivity = sensCompatible;
+
+		_resumeTime = snap.time;
+		_resumeSec = snap.section;
+		_curTime = snap.time;
+		_resumePending = true;
+	}
+
 	void Simulator::configureTimeIntegrator(double relTol, double absTol, double initStepSize, unsigned int maxSteps, double maxStepSize)
 	{
 		_absTol.clear();
@@ -1501,6 +1806,11 @@ namespace cadet
 		if (paramProvider.exists("MAX_NEWTON_ITER_SENS"))
 			_maxNewtonIterSens = paramProvider.getInt("MAX_NEWTON_ITER_SENS");
 
+		if (paramProvider.exists("USE_SIMULTANEOUS_SENS"))
+			_sensCorrector = paramProvider.getBool("USE_SIMULTANEOUS_SENS") ? IDA_SIMULTANEOUS : IDA_STAGGERED;
+		else
+			_sensCorrector = IDA_STAGGERED;
+
 		paramProvider.popScope();
 
 		if (paramProvider.exists("NTHREADS"))
@@ -1522,6 +1832,14 @@ namespace cadet
 		if (paramProvider.exists("CONSISTENT_INIT_MODE_SENS"))
 			_consistentInitModeSens = toConsistentInitialization(paramProvider.getInt("CONSISTENT_INIT_MODE_SENS"));
 
+		_cssMaxCycles = 0;
+		if (paramProvider.exists("CSS_MAX_CYCLES"))
+			_cssMaxCycles = std::max(paramProvider.getInt("CSS_MAX_CYCLES"), 0);
+
+		_cssRelTol = paramProvider.exists("CSS_RELTOL") ? paramProvider.getDouble("CSS_RELTOL") : 1e-6;
+		_cssAbsTol = paramProvider.exists("CSS_ABSTOL") ? paramProvider.getDouble("CSS_ABSTOL") : 1e-8;
+		_cssAndersonDepth = paramProvider.exists("CSS_ANDERSON_DEPTH") ? std::max(paramProvider.getInt("CSS_ANDERSON_DEPTH"), 0) : 5;
+
 		// @todo: Read more configuration values
 	}
 
@@ -1634,6 +1952,21 @@ namespace cadet
 			IDASetSensMaxNonlinIters(_idaMemBlock, nIter);
 	}
 
+	void Simulator::configureCyclicSteadyState(unsigned int maxCycles, double relTol, double absTol, unsigned int andersonDepth)
+	{
+		_cssMaxCycles = maxCycles;
+		_cssRelTol = relTol;
+		_cssAbsTol = absTol;
+		_cssAndersonDepth = andersonDepth;
+	}
+
+	void Simulator::setSimultaneousSensitivityCorrector(bool simultaneous)
+	{
+		_sensCorrector = simultaneous ? IDA_SIMULTANEOUS : IDA_STAGGERED;
+
+		// The corrector method is handed over to IDAS on the next call to IDASensReInit() in integrate()
+	}
+
 
 
 	bool Simulator::reconfigureModel(IParameterProvider& paramProvider)
@@ -1669,6 +2002,8 @@ namespace cadet
 		if (!_solRecorder)
 			return;
 
+		CADET_PROFILE_SCOPE("write solution");
+
 		_solRecorder->beginTimestep(t);
 
 		_solRecorder->beginSolution();
@@ -101,6 +101,9 @@ public:
 	virtual std::vector<double const*> getLastSensitivities(unsigned int& len) const;
 	virtual std::vector<double const*> getLastSensitivityDerivatives(unsigned int& len) const;
 
+	virtual SimulatorSnapshot snapshot() const;
+	virtual void resume(const SimulatorSnapshot& snap);
+
 	virtual void configure(IParameterProvider& paramProvider);
 	virtual void reconfigure(IParameterProvider& paramProvider);
 	virtual void configureTimeIntegrator(double relTol, double absTol, double initStepSize, unsigned int maxSteps, double maxStepSize);
@@ -121,6 +124,8 @@ public:
 	virtual void setMaxErrorTestFails(unsigned int nFails);
 	virtual void setMaxConvergenceFails(unsigned int nFails);
 	virtual void setMaxSensNewtonIteration(unsigned int nIter);
+	virtual void setSimultaneousSensitivityCorrector(bool simultaneous);
+	virtual void configureCyclicSteadyState(unsigned int maxCycles, double relTol, double absTol, unsigned int andersonDepth);
 
 	virtual bool reconfigureModel(IParameterProvider& paramProvider);
 	virtual bool reconfigureModel(IParameterProvider& paramProvider, unsigned int unitOpIdx);
@@ -133,6 +138,11 @@ public:
 
 	virtual double lastSimulationDuration() const CADET_NOEXCEPT { return _lastIntTime; }
 	virtual double totalSimulationDuration() const CADET_NOEXCEPT { return _timerIntegration.totalElapsedTime(); }
+	virtual unsigned int lastNumCycles() const CADET_NOEXCEPT { return _lastNumCycles; }
+
+#ifdef CADET_BENCHMARK_MODE
+	virtual std::size_t numHeapAllocationsTimeIntegration() const CADET_NOEXCEPT { return _numHeapAllocIntegration; }
+#endif
 
 	virtual void setNotificationCallback(INotificationCallback* nc) CADET_NOEXCEPT;
 protected:
@@ -142,6 +152,19 @@ protected:
 	 */
 	void clearModel() CADET_NOEXCEPT;
 
+	/**
+	 * @brief Integrates the model over all sections
+	 * @return @c true if the end of the last section has been reached, @c false if the user aborted the time integration
+	 */
+	bool integrateSections();
+
+	/**
+	 * @brief Repeats the integration over all sections until a cyclic steady state is reached
+	 * @details Only the last cycle is recorded.
+	 * @return @c true if the last cycle has been completed, @c false if the user aborted the time integration
+	 */
+	bool integrateCyclicSteadyState();
+
 	/**
 	 * @brief Writes the solution at time point t
 	 * @param [in] t Current time point
@@ -247,6 +270,11 @@ protected:
 	N_Vector _vecStateYdot; //!< IDAS state vector time derivative
 	N_Vector* _vecFwdYs; //!< IDAS sensitivities vector	
 	N_Vector* _vecFwdYsDot; //!< IDAS sensitivities vector time derivative
+	std::vector<double*> _fwdYsPtr; //!< Data pointers of _vecFwdYs
+	std::vector<double*> _fwdYsDotPtr; //!< Data pointers of _vecFwdYsDot
+	std::vector<const double*> _sensYPtr; //!< Workspace for sensitivity state pointers passed to residualSensWrapper()
+	std::vector<const double*> _sensYdotPtr; //!< Workspace for sensitivity state time derivative pointers passed to residualSensWrapper()
+	std::vector<double*> _sensResPtr; //!< Workspace for sensitivity residual pointers passed to residualSensWrapper()
 	util::SlicedVector<ParameterId> _sensitiveParams; //!< Stores (fused) sensitive parameters
 	std::vector<double> _sensitiveParamsFactor; //!< Stores the factors of the linear sensitive parameter combinations
 	std::vector<active> _sectionTimes; //!< Stores the AD variables used for SECTION_TIMES parameter derivatives
@@ -269,8 +297,13 @@ protected:
 	unsigned int _maxErrorTestFail; //!< Maximum number of local time integration error test failures
 	unsigned int _maxConvTestFail; //!< Maximum number of Newton iteration failures
 	unsigned int _maxNewtonIterSens; //!< Maximum number of Newton iterations for forward sensitivity systems
+	int _sensCorrector; //!< Nonlinear corrector method for forward sensitivity systems (@c IDA_STAGGERED or @c IDA_SIMULTANEOUS)
 
 	SectionIdx _curSec; //!< Index of the current section
+	double _curTime; //!< Time point of the current state vectors
+	bool _resumePending; //!< Determines whether the next call to integrate() resumes from _resumeTime
+	double _resumeTime; //!< Time point from which the next call to integrate() resumes
+	SectionIdx _resumeSec; //!< Index of the section in which the snapshot to resume from has been taken
 
 	bool _skipConsistencyStateY; //!< Flag that determines whether the consistent initialization is skipped
 	bool _skipConsistencySensitivity; //!< Flag that determines whether the consistent initialization of the sensitivity systems is skipped
@@ -283,6 +316,16 @@ protected:
 
 	Timer _timerIntegration; //!< Timer measuring the duration of the call to integrate()
 	double _lastIntTime; //!< Last simulation duration
+	unsigned int _lastNumCycles; //!< Number of cycles of the last simulation run
+
+	unsigned int _cssMaxCycles; //!< Maximum number of cycles in cyclic steady state mode (@c 0 or @c 1 disables the mode)
+	double _cssRelTol; //!< Relative tolerance of the cycle-to-cycle state difference
+	double _cssAbsTol; //!< Absolute tolerance of the cycle-to-cycle state difference
+	unsigned int _cssAndersonDepth; //!< Number of previous cycles used by Anderson acceleration (@c 0 disables acceleration)
+
+#ifdef CADET_BENCHMARK_MODE
+	std::size_t _numHeapAllocIntegration; //!< Number of heap allocations during steady-state time integration of the last call to integrate()
+#endif
 
 	INotificationCallback* _notification; //!< Callback handler for notifications
 };
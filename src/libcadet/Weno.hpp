@@ -57,7 +57,7 @@ public:
 	/**
 	 * @brief Creates the WENO scheme
 	 */
-	Weno() : _order(maxOrder()), _boundaryTreatment(BoundaryTreatment::ReduceOrder), _intermediateValues(3 * maxOrder() * sizeof(active)) { }
+	Weno() : _order(maxOrder()), _boundaryTreatment(BoundaryTreatment::ReduceOrder) { }
 
 	/**
 	 * @brief Returns the maximum order \f$ r \f$ of the implemented schemes
@@ -85,7 +85,7 @@ public:
 	 * @return Order of the WENO scheme that was used in the computation
 	 */
 	template <typename StateType, typename StencilType>
-	int reconstruct(double epsilon, unsigned int cellIdx, unsigned int numCells, const StencilType& w, StateType& result, double* const Dvm)
+	int reconstruct(double epsilon, unsigned int cellIdx, unsigned int numCells, const StencilType& w, StateType& result, double* const Dvm) const
 	{
 		return reconstruct<StateType, StencilType, true>(epsilon, cellIdx, numCells, w, result, Dvm);
 	}
@@ -103,11 +103,72 @@ public:
 	 * @return Order of the WENO scheme that was used in the computation
 	 */
 	template <typename StateType, typename StencilType>
-	int reconstruct(double epsilon, unsigned int cellIdx, unsigned int numCells, const StencilType& w, StateType& result)
+	int reconstruct(double epsilon, unsigned int cellIdx, unsigned int numCells, const StencilType& w, StateType& result) const
 	{
 		return reconstruct<StateType, StencilType, false>(epsilon, cellIdx, numCells, w, result, nullptr);
 	}
 
+	/**
+	 * @brief Reconstructs the right face values of all cells from volume averages in one pass
+	 * @details The volume averages are expected in a contiguous array that is padded with maxOrder() - 1 zeros
+	 *          on both sides (i.e., @p v points to the first padding element and the average of cell @c i is
+	 *          located at <tt>v[i + maxOrder() - 1]</tt>). Results are identical to calling reconstruct()
+	 *          for each cell. Since the order is fixed at compile time for the interior cells, the loop over
+	 *          these cells does not contain any branches and is amenable to auto-vectorization.
+	 * @param [in] epsilon \f$ \varepsilon \f$ of the WENO method (prevents division by zero in the weights)
+	 * @param [in] numCells Number of cells
+	 * @param [in] v Padded volume averages of all cells
+	 * @param [out] result Reconstructed right face values of all cells (array of size @p numCells)
+	 * @param [out] Dvm Gradients of the reconstructed face values (array of size <tt>numCells * stencilSize()</tt>,
+	 *                  gradient of cell @c i starts at <tt>Dvm[i * stencilSize()]</tt>), only used if @p wantJac is @c true
+	 * @tparam StateType Type of the state variables
+	 * @tparam wantJac Determines if the gradients are computed (@c true) or not (@c false)
+	 */
+	template <typename StateType, bool wantJac>
+	void reconstructBatch(double epsilon, unsigned int numCells, StateType const* v, StateType* result, double* const Dvm) const
+	{
+		// Shift pointer such that v[0] is the average of the first cell
+		StateType const* const vStart = v + maxOrder() - 1;
+		switch (_order)
+		{
+			case 1:
+				reconstructBatchImpl<1, StateType, wantJac>(epsilon, numCells, vStart, result, Dvm);
+				break;
+			case 2:
+				reconstructBatchImpl<2, StateType, wantJac>(epsilon, numCells, vStart, result, Dvm);
+				break;
+			case 3:
+				reconstructBatchImpl<3, StateType, wantJac>(epsilon, numCells, vStart, result, Dvm);
+				break;
+		}
+	}
+
+	/**
+	 * @brief Returns the local order of the scheme used at a given cell
+	 * @details The order may be reduced at the boundaries depending on the boundary treatment.
+	 * @param [in] cellIdx Index of the current cell
+	 * @param [in] numCells Number of cells
+	 * @return Order of the WENO scheme that is used in the given cell
+	 */
+	inline int localOrder(unsigned int cellIdx, unsigned int numCells) const CADET_NOEXCEPT
+	{
+		switch (_boundaryTreatment)
+		{
+		default:
+		case BoundaryTreatment::ReduceOrder:
+			// Lower WENO order such that maximum order is used at all points
+			// This very statement selects the max. weno order for the current column cell
+			// order = min(maxOrderleft, maxOrderright)
+			return std::min(std::min(static_cast<int>(cellIdx) + 1, _order), std::min(static_cast<int>(numCells - cellIdx), _order));
+
+		case BoundaryTreatment::ZeroWeightsForPnotZero:
+			return (cellIdx == 0) ? 1 : _order;
+
+		case BoundaryTreatment::ZeroWeights:
+			return _order;
+		}
+	}
+
 	/**
 	 * @brief Sets the WENO order
 	 * @param [in] order Order of the WENO method
@@ -196,15 +257,10 @@ private:
 	 * @return Order of the WENO scheme that was used in the computation
 	 */
 	template <typename StateType, typename StencilType, bool wantJac>
-	int reconstruct(double epsilon, unsigned int cellIdx, unsigned int numCells, const StencilType& w, StateType& result, double* const Dvm)
+	int reconstruct(double epsilon, unsigned int cellIdx, unsigned int numCells, const StencilType& w, StateType& result, double* const Dvm) const
 	{
-#if defined(ACTIVE_SETFAD) || defined(ACTIVE_SFAD)
-		using cadet::sqr;
-		using sfad::sqr;
-#endif
-
 		// Local order of the scheme that is actually used (may be changed by treatment of boundaries)
-		int order = _order;
+		const int order = localOrder(cellIdx, numCells);
 
 		// Boundaries
 		int bnd = 0;
@@ -212,10 +268,6 @@ private:
 		{
 		default:
 		case BoundaryTreatment::ReduceOrder:
-			// Lower WENO order such that maximum order is used at all points
-			// This very statement selects the max. weno order for the current column cell
-			// order = min(maxOrderleft, maxOrderright)
-			order = std::min(std::min(static_cast<int>(cellIdx) + 1, _order), std::min(static_cast<int>(numCells - cellIdx), _order));
 			break;
 
 		case BoundaryTreatment::ZeroWeights:
@@ -228,9 +280,7 @@ private:
 
 		case BoundaryTreatment::ZeroWeightsForPnotZero:
 			// Zero weights for p != 0
-			if (cellIdx == 0)
-				order = 1;
-			else
+			if (cellIdx != 0)
 			{
 				if (cellIdx < static_cast<unsigned int>(order - 1))
 					bnd = -(order - 1 - cellIdx);
@@ -252,137 +302,200 @@ private:
 				w[2] = 1e50;
 			break;
 */
-		}		
+		}
+
+		switch (order)
+		{
+			case 1:
+				reconstructFixed<1, StateType, StencilType, wantJac>(epsilon, w, result, Dvm, bnd);
+				break;
+			case 2:
+				reconstructFixed<2, StateType, StencilType, wantJac>(epsilon, w, result, Dvm, bnd);
+				break;
+			case 3:
+				reconstructFixed<3, StateType, StencilType, wantJac>(epsilon, w, result, Dvm, bnd);
+				break;
+		}
 
-		// Total stencil size
-		const int sl = 2 * order - 1;
+		return order;
+	}
+
+	/**
+	 * @brief Reconstructs the right face values of all cells using a WENO scheme of fixed order
+	 * @details See reconstructBatch(). The interior cells, which are not affected by the boundary
+	 *          treatment, are processed in a single loop with compile-time order and without branches.
+	 * @param [in] epsilon \f$ \varepsilon \f$ of the WENO method (prevents division by zero in the weights)
+	 * @param [in] numCells Number of cells
+	 * @param [in] v Volume averages padded with zeros
+	 * @param [out] result Reconstructed right face values of all cells
+	 * @param [out] Dvm Gradients of the reconstructed face values, \f$ 2r-1 \f$ entries per cell
+	 * @tparam Order WENO order \f$ r \f$
+	 * @tparam StateType Type of the state variables
+	 * @tparam wantJac Determines if the gradients are computed (@c true) or not (@c false)
+	 */
+	template <int Order, typename StateType, bool wantJac>
+	void reconstructBatchImpl(double epsilon, unsigned int numCells, StateType const* v, StateType* result, double* const Dvm) const
+	{
+		CADET_CONSTEXPR int sl = 2 * Order - 1;
+
+		// Cells in [Order - 1, numCells - Order] use the full stencil
+		const unsigned int firstInterior = std::min(static_cast<unsigned int>(Order - 1), numCells);
+		const unsigned int endInterior = std::max(numCells + 1 - std::min(static_cast<unsigned int>(Order), numCells + 1), firstInterior);
+
+		for (unsigned int col = 0; col < firstInterior; ++col)
+			reconstruct<StateType, StateType const*, wantJac>(epsilon, col, numCells, v + col, result[col], wantJac ? Dvm + col * sl : nullptr);
+
+		for (unsigned int col = firstInterior; col < endInterior; ++col)
+			reconstructFixed<Order, StateType, StateType const*, wantJac>(epsilon, v + col, result[col], wantJac ? Dvm + col * sl : nullptr, 0);
 
-		// Simple upwind scheme
-		if (order == 1)
+		for (unsigned int col = endInterior; col < numCells; ++col)
+			reconstruct<StateType, StateType const*, wantJac>(epsilon, col, numCells, v + col, result[col], wantJac ? Dvm + col * sl : nullptr);
+	}
+
+	/**
+	 * @brief Reconstructs a cell face value from volume averages using a WENO scheme of fixed order
+	 * @param [in] epsilon \f$ \varepsilon \f$ of the WENO method (prevents division by zero in the weights)
+	 * @param [in] w Stencil that contains the \f$ 2r-1 \f$ volume averages centered at the current cell
+	 * @param [out] result Reconstructed cell face value
+	 * @param [out] Dvm Gradient of the reconstructed cell face value (array has to be of size \f$ 2r-1\f$)
+	 * @param [in] bnd Number of substencils at the beginning (negative) or end (positive) of the domain whose weights are set to zero
+	 * @tparam Order WENO order \f$ r \f$
+	 * @tparam StateType Type of the state variables
+	 * @tparam StencilType Type of the stencil (can be a dedicated class with overloaded operator[] or a simple pointer)
+	 * @tparam wantJac Determines if the gradient is computed (@c true) or not (@c false)
+	 */
+	template <int Order, typename StateType, typename StencilType, bool wantJac>
+	static inline void reconstructFixed(double epsilon, const StencilType& w, StateType& result, double* const Dvm, int bnd)
+	{
+#if defined(ACTIVE_SETFAD) || defined(ACTIVE_SFAD)
+		using cadet::sqr;
+		using sfad::sqr;
+#endif
+
+		if constexpr (Order == 1)
 		{
+			// Simple upwind scheme
 			result = w[0];
 			if (wantJac)
 				*Dvm = 1.0;
-			return order;
 		}
+		else
+		{
+			// Total stencil size
+			CADET_CONSTEXPR int sl = 2 * Order - 1;
 
-		// Allocate memory for intermediate values: beta, alpha (= omega), and vr
-		StateType* const work = _intermediateValues.create<StateType>(3 * order);
-		StateType* const beta  = work;
-		StateType* const alpha = work + order;
-		StateType* const omega = work + order;
-		StateType* const vr    = work + 2*order; // Reconstructed values
+			// Intermediate values: beta, alpha (= omega), and vr
+			StateType beta[Order];
+			StateType alpha[Order];
+			StateType* const omega = alpha;
+			StateType vr[Order]; // Reconstructed values
 
-		const double* d = nullptr;
-		const double* c = nullptr;
-		const double* Jbvv = nullptr;
+			const double* d = nullptr;
+			const double* c = nullptr;
+			const double* Jbvv = nullptr;
 
-		// Calculate smoothness measures
-		switch (order)
-		{
-			case 2:
+			// Calculate smoothness measures
+			if constexpr (Order == 2)
+			{
 				beta[0] = sqr(w[1] - w[0]);
 				beta[1] = sqr(w[0] - w[-1]);
 				d = _wenoD2;
 				c = _wenoC2;
 				Jbvv = _wenoJbvv2;
-				break;
-			case 3:
+			}
+			else
+			{
 				beta[0] = 13.0/12.0 * sqr(w[ 0] - 2.0 * w[ 1] + w[2]) + 0.25 * sqr(3.0 * w[ 0] - 4.0 * w[ 1] +       w[2]);
 				beta[1] = 13.0/12.0 * sqr(w[-1] - 2.0 * w[ 0] + w[1]) + 0.25 * sqr(      w[-1] -       w[ 1]             );
 				beta[2] = 13.0/12.0 * sqr(w[-2] - 2.0 * w[-1] + w[0]) + 0.25 * sqr(      w[-2] - 4.0 * w[-1] + 3.0 * w[0]);
 				d = _wenoD3;
 				c = _wenoC3;
 				Jbvv = _wenoJbvv3;
-				break;
-		}
+			}
 
-		// Add eps to avoid divide-by-zeros
-		for (int r = 0; r < order; ++r)
-			beta[r] += epsilon;
+			// Add eps to avoid divide-by-zeros
+			for (int r = 0; r < Order; ++r)
+				beta[r] += epsilon;
 
-		// Calculate weights
-		for (int r = 0; r < order; ++r)
-			alpha[r] = d[r] / sqr(beta[r]);
+			// Calculate weights
+			for (int r = 0; r < Order; ++r)
+				alpha[r] = d[r] / sqr(beta[r]);
 
-		// Avoid boundaries
-		if (cadet_unlikely(bnd != 0))
-		{
-			if (bnd < 0)
-				// Beginning of interval
-				for (int r = 0; r < -bnd; ++r)
-					alpha[order - 1 - r] = 0.0;
-			else
-				// End of interval
-				for (int r = 0; r < bnd; ++r)
-					alpha[r] = 0.0;
-		}
+			// Avoid boundaries
+			if (cadet_unlikely(bnd != 0))
+			{
+				if (bnd < 0)
+					// Beginning of interval
+					for (int r = 0; r < -bnd; ++r)
+						alpha[Order - 1 - r] = 0.0;
+				else
+					// End of interval
+					for (int r = 0; r < bnd; ++r)
+						alpha[r] = 0.0;
+			}
 
-		// Normalize weights
-		StateType alpha_sum = alpha[0];
-		for (int r = 1; r < order; ++r)
-			alpha_sum += alpha[r];
-		for (int r = 0; r < order; ++r)
-			omega[r] /= alpha_sum;
+			// Normalize weights
+			StateType alpha_sum = alpha[0];
+			for (int r = 1; r < Order; ++r)
+				alpha_sum += alpha[r];
+			for (int r = 0; r < Order; ++r)
+				omega[r] /= alpha_sum;
 
-		// Calculate reconstructed values
-		for (int r = 0; r < order; ++r)
-		{
-			vr[r] = 0.0;
-			for (int j = 0; j < order; ++j)
-				vr[r] += c[r + order * j] * w[-r+j];
-		}
+			// Calculate reconstructed values
+			for (int r = 0; r < Order; ++r)
+			{
+				vr[r] = 0.0;
+				for (int j = 0; j < Order; ++j)
+					vr[r] += c[r + Order * j] * w[-r+j];
+			}
 
-		// Weighted sum
-		result = 0;
-		for (int r = 0; r < order; ++r)
-			result += vr[r] * omega[r];
+			// Weighted sum
+			result = 0;
+			for (int r = 0; r < Order; ++r)
+				result += vr[r] * omega[r];
 
-		// Jacobian
-		if (wantJac)
-		{
-			// Dependencies
-			// 1. Constant vr in (*)
-
-			// Start with "d(result)/d(omega)" = vr and
-			// multiply with "d(omega)/d(alpha)" to get "d(result)/d(alpha)"
-			double dot = 0.0;
-			for (int r = 0; r < order; ++r)
-				dot += static_cast<double>(vr[r]) * static_cast<double>(omega[r]); //StateType(vr[r] * omega[r]);
-			for (int r = 0; r < order; ++r)
-				vr[r] = (vr[r] - dot) / alpha_sum;
-
-			// Multiply with "d(alpha)/d(beta)" to get "d(result)/d(beta)"
-			for (int r = 0; r < order; ++r)
-				vr[r] *= -2.0 * d[r] / pow(beta[r], 3.0);
-
-			// Multiply with "d(beta)/d(v)" to get Dvm = "d(result)/d(v)"
-			for (int j = 0; j < sl; ++j)
+			// Jacobian
+			if (wantJac)
 			{
-				Dvm[j] = 0.0;
-				for (int r = 0; r < order; ++r)
+				// Dependencies
+				// 1. Constant vr in (*)
+
+				// Start with "d(result)/d(omega)" = vr and
+				// multiply with "d(omega)/d(alpha)" to get "d(result)/d(alpha)"
+				double dot = 0.0;
+				for (int r = 0; r < Order; ++r)
+					dot += static_cast<double>(vr[r]) * static_cast<double>(omega[r]); //StateType(vr[r] * omega[r]);
+				for (int r = 0; r < Order; ++r)
+					vr[r] = (vr[r] - dot) / alpha_sum;
+
+				// Multiply with "d(alpha)/d(beta)" to get "d(result)/d(beta)"
+				for (int r = 0; r < Order; ++r)
+					vr[r] *= -2.0 * d[r] / pow(beta[r], 3.0);
+
+				// Multiply with "d(beta)/d(v)" to get Dvm = "d(result)/d(v)"
+				for (int j = 0; j < sl; ++j)
 				{
-					dot = 0.0;
-					for (int i = 0; i < sl; ++i)
-						dot += static_cast<double>(Jbvv[r + order * j + order * sl * i]) * static_cast<double>(w[i - order + 1]);
-					// To do: re-arange Jbvv to reduce cache misses !
-					Dvm[j] += static_cast<double>(vr[r]) * dot; // StateType(vr[r] * dot);
+					Dvm[j] = 0.0;
+					for (int r = 0; r < Order; ++r)
+					{
+						dot = 0.0;
+						for (int i = 0; i < sl; ++i)
+							dot += static_cast<double>(Jbvv[r + Order * j + Order * sl * i]) * static_cast<double>(w[i - Order + 1]);
+						// To do: re-arange Jbvv to reduce cache misses !
+						Dvm[j] += static_cast<double>(vr[r]) * dot; // StateType(vr[r] * dot);
+					}
 				}
-			}
 
-			// 2. Constant omega[r] in (*)
-			for (int r = 0; r < order; ++r)
-				for (int j = 0; j < order; ++j)
-					Dvm[order - 1 + j - r] += static_cast<double>(omega[r]) * c[r + order * j];
+				// 2. Constant omega[r] in (*)
+				for (int r = 0; r < Order; ++r)
+					for (int j = 0; j < Order; ++j)
+						Dvm[Order - 1 + j - r] += static_cast<double>(omega[r]) * c[r + Order * j];
+			}
 		}
-
-		_intermediateValues.destroy<StateType>();
-		return order;
 	}
 
 	int _order; //!< Selected WENO order
 	BoundaryTreatment _boundaryTreatment; //!< Controls how to treat boundary cells
-	ArrayPool _intermediateValues; //!< Buffer for intermediate and temporary values
 
 	static const double _wenoD2[2];
 	static const double _wenoC2[2*2];
@@ -20,6 +20,20 @@
 #include "Logging.hpp"
 
 #include "common/Driver.hpp"
+#include "ParallelSupport.hpp"
+
+#include <atomic>
+#include <limits>
+#include <memory>
+
+#ifdef CADET_PARALLELIZE
+	#include <tbb/parallel_for.h>
+
+	#ifdef CADET_TBB_GLOBALCTRL
+		#define TBB_PREVIEW_GLOBAL_CONTROL 1
+		#include <tbb/global_control.h>
+	#endif
+#endif
 
 
 #define CADET_XSTR(a) #a
@@ -33,6 +47,12 @@ extern "C"
 	struct cdtDriver
 	{
 		cadet::Driver* driver;
+
+		std::vector<double> batchTime; //!< Solution times of the last batch simulation
+		std::vector<double> batchOutlet; //!< Outlet of all variants of the last batch simulation
+		std::vector<cdtResult> batchStatus; //!< Result code of each variant of the last batch simulation
+		int batchNumPorts; //!< Number of outlet ports of the unit operation recorded in the last batch simulation
+		int batchNumComp; //!< Number of components of the unit operation recorded in the last batch simulation
 	};
 }
 
@@ -47,7 +67,11 @@ namespace v1
 
 	cdtDriver* createDriver()
 	{
-		return new cdtDriver{ new cadet::Driver() };
+		cdtDriver* const drv = new cdtDriver();
+		drv->driver = new cadet::Driver();
+		drv->batchNumPorts = 0;
+		drv->batchNumComp = 0;
+		return drv;
 	}
 
 	void deleteDriver(cdtDriver* drv)
@@ -59,6 +83,10 @@ namespace v1
 
 		delete drv->driver;
 		drv->driver = nullptr;
+
+		drv->batchTime.clear();
+		drv->batchOutlet.clear();
+		drv->batchStatus.clear();
 	}
 
 	/**
@@ -1000,6 +1028,235 @@ namespace v1
 		return cdtOK;
 	}
 
+	cdtResult runSimulationBatch(cdtDriver* drv, cdtParameterProvider const* paramProvider, cdtParameterId const* params, int nParams,
+		double const* values, int nVariants, int unitOpId, int nWorkers)
+	{
+		if (!drv || !drv->driver)
+			return cdtErrorInvalidInputs;
+		if (!paramProvider)
+			return cdtErrorInvalidInputs;
+		if ((nParams < 0) || (nVariants < 0) || (unitOpId < 0))
+			return cdtErrorInvalidInputs;
+		if ((nParams > 0) && (nVariants > 0) && (!params || !values))
+			return cdtErrorInvalidInputs;
+
+		drv->batchTime.clear();
+		drv->batchOutlet.clear();
+		drv->batchStatus.clear();
+		drv->batchNumPorts = 0;
+		drv->batchNumComp = 0;
+
+		if (nVariants == 0)
+			return cdtOK;
+
+		// Convert parameter identifiers
+		std::vector<ParameterId> paramIds;
+		paramIds.reserve(nParams);
+		for (int i = 0; i < nParams; ++i)
+		{
+			if (!params[i].name)
+				return cdtErrorInvalidInputs;
+
+			paramIds.push_back(makeParamId(params[i].name, params[i].unitOperation, params[i].component, params[i].particleType, params[i].boundState, params[i].reaction, params[i].section));
+		}
+
+		// The thread limit of the solver applies to the whole batch
+		int nThreads = 0;
+		try
+		{
+			CallbackParameterProvider cpp(*paramProvider);
+			cpp.pushScope("solver");
+			if (cpp.exists("NTHREADS"))
+				nThreads = std::max(cpp.getInt("NTHREADS"), 0);
+			cpp.popScope();
+		}
+		catch(const std::exception& e)
+		{
+			LOG(Error) << "Configuration of batch simulation failed: " << e.what();
+			return cdtError;
+		}
+
+#ifdef CADET_PARALLELIZE
+	#ifdef CADET_TBB_GLOBALCTRL
+		// The global control is process-wide and, hence, set up once for all workers
+		std::unique_ptr<tbb::global_control> tbbGlobalControl;
+		if (nThreads > 0)
+			tbbGlobalControl = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, nThreads);
+	#endif
+
+		const int maxWorkers = (nWorkers > 0) ? nWorkers : tbb::this_task_arena::max_concurrency();
+		const int numWorkers = std::max(1, std::min(maxWorkers, nVariants));
+#else
+		const int numWorkers = 1;
+#endif
+
+		// Configure one driver per worker (the callbacks of the parameter provider are not assumed to be thread-safe)
+		std::vector<std::unique_ptr<Driver>> workers(numWorkers);
+		try
+		{
+			CallbackParameterProvider cpp(*paramProvider);
+			for (int w = 0; w < numWorkers; ++w)
+			{
+				workers[w] = std::make_unique<Driver>();
+				workers[w]->configure(cpp);
+
+				// Workers use the threads of the batch instead of setting up their own limit
+				workers[w]->simulator()->setNumThreads(0);
+
+				// Only record the outlet of the requested unit operation
+				InternalStorageSystemRecorder* const sysRec = workers[w]->solution();
+				sysRec->deleteRecorders();
+				sysRec->storeTime(true);
+
+				InternalStorageUnitOpRecorder* const unitRec = new InternalStorageUnitOpRecorder(static_cast<UnitOpIdx>(unitOpId));
+				unitRec->solutionConfig({false, false, false, false, true, false, false});
+				unitRec->solutionDotConfig({false, false, false, false, false, false, false});
+				unitRec->sensitivityConfig({false, false, false, false, false, false, false});
+				unitRec->sensitivityDotConfig({false, false, false, false, false, false, false});
+				sysRec->addRecorder(unitRec);
+			}
+		}
+		catch(const std::exception& e)
+		{
+			LOG(Error) << "Configuration of batch simulation failed: " << e.what();
+			return cdtError;
+		}
+
+		// Run variants, each worker takes the next variant that has not been simulated yet
+		std::vector<std::vector<double>> outlets(nVariants);
+		std::vector<cdtResult> status(nVariants, cdtError);
+		std::atomic<int> nextVariant(0);
+
+#ifdef CADET_PARALLELIZE
+		tbb::parallel_for(0, numWorkers, [&](int w)
+#else
+		for (int w = 0; w < numWorkers; ++w)
+#endif
+		{
+			Driver& wd = *workers[w];
+			for (int v = nextVariant++; v < nVariants; v = nextVariant++)
+			{
+				try
+				{
+					for (int i = 0; i < nParams; ++i)
+						wd.simulator()->setParameterValue(paramIds[i], values[static_cast<std::size_t>(v) * nParams + i]);
+
+					wd.clearResults();
+					wd.resetInitialCondition();
+					wd.run();
+
+					InternalStorageUnitOpRecorder const* const unitRec = wd.solution()->recorder(0);
+					const std::size_t n = static_cast<std::size_t>(unitRec->numDataPoints()) * unitRec->numOutletPorts() * unitRec->numComponents();
+					if (n == 0)
+					{
+						// Unit operation does not exist or does not have an outlet
+						LOG(Error) << "Outlet of unit " << unitOpId << " not recorded";
+						status[v] = cdtDataNotStored;
+						continue;
+					}
+
+					outlets[v].assign(unitRec->outlet(), unitRec->outlet() + n);
+					status[v] = cdtOK;
+				}
+				catch(const std::exception& e)
+				{
+					LOG(Error) << "Simulation of variant " << v << " failed: " << e.what();
+				}
+			}
+		} CADET_PARFOR_END;
+
+		// Assemble results in one contiguous array using the layout of the first successful variant
+		int refVariant = -1;
+		for (int v = 0; v < nVariants; ++v)
+		{
+			if (status[v] == cdtOK)
+			{
+				refVariant = v;
+				break;
+			}
+		}
+
+		cdtResult retCode = cdtOK;
+		if (refVariant >= 0)
+		{
+			// The recorders of all workers share the same structure
+			InternalStorageSystemRecorder const* const sysRec = workers[0]->solution();
+			InternalStorageUnitOpRecorder const* const unitRec = sysRec->recorder(0);
+			drv->batchNumPorts = unitRec->numOutletPorts();
+			drv->batchNumComp = unitRec->numComponents();
+
+			// Solution times are identical for all variants if USER_SOLUTION_TIMES is used
+			const std::size_t sliceSize = outlets[refVariant].size();
+			const std::size_t nTime = sliceSize / std::max(1, drv->batchNumPorts * drv->batchNumComp);
+			for (const std::unique_ptr<Driver>& wd : workers)
+			{
+				if (wd->solution()->numDataPoints() == nTime)
+				{
+					drv->batchTime.assign(wd->solution()->time(), wd->solution()->time() + nTime);
+					break;
+				}
+			}
+
+			drv->batchOutlet.resize(sliceSize * nVariants, std::numeric_limits<double>::quiet_NaN());
+			for (int v = 0; v < nVariants; ++v)
+			{
+				if (status[v] != cdtOK)
+					continue;
+
+				if (outlets[v].size() != sliceSize)
+				{
+					LOG(Error) << "Number of time points of variant " << v << " differs from variant " << refVariant;
+					status[v] = cdtError;
+					continue;
+				}
+
+				std::copy(outlets[v].begin(), outlets[v].end(), drv->batchOutlet.begin() + v * sliceSize);
+			}
+		}
+
+		for (int v = 0; v < nVariants; ++v)
+		{
+			if (status[v] != cdtOK)
+			{
+				retCode = cdtError;
+				break;
+			}
+		}
+
+		drv->batchStatus = std::move(status);
+		return retCode;
+	}
+
+	cdtResult getBatchOutlet(cdtDriver* drv, double const** time, double const** data, cdtResult const** status, int* nVariants, int* nTime, int* nPort, int* nComp)
+	{
+		if (!drv || !drv->driver)
+			return cdtErrorInvalidInputs;
+
+		if (drv->batchStatus.empty())
+		{
+			LOG(Error) << "No batch simulation results available";
+			return cdtDataNotStored;
+		}
+
+		const int numVariants = drv->batchStatus.size();
+		if (nVariants)
+			*nVariants = numVariants;
+		if (nTime)
+			*nTime = drv->batchTime.size();
+		if (nPort)
+			*nPort = drv->batchNumPorts;
+		if (nComp)
+			*nComp = drv->batchNumComp;
+		if (time)
+			*time = drv->batchTime.data();
+		if (data)
+			*data = drv->batchOutlet.data();
+		if (status)
+			*status = drv->batchStatus.data();
+
+		return cdtOK;
+	}
+
 }  // namespace v1
 
 }  // namespace api
@@ -1074,6 +1331,9 @@ extern "C"
 
 		ptr->getTimeSim = &cadet::api::v1::getTimeSim;
 
+		ptr->runSimulationBatch = &cadet::api::v1::runSimulationBatch;
+		ptr->getBatchOutlet = &cadet::api::v1::getBatchOutlet;
+
 		return cdtOK;
 	}
 
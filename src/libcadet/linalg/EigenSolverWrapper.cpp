@@ -75,6 +75,8 @@ namespace linalg
             else
                 return new cadet::linalg::LeastSquaresConjugateGradient<Eigen::LeastSquareDiagonalPreconditioner<double>>();
         }
+        else if (solverName == "IncompleteLUT")
+            return new cadet::linalg::IncompleteLUT();
         else {
             throw std::invalid_argument("Unknown linear solver name: " + solverName);
         }
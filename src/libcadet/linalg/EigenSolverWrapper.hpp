@@ -14,7 +14,10 @@
 #define LIBCADET_EigenSolverWrapper_HPP_
 
 #include <Eigen/Sparse>
+#include <algorithm>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 namespace cadet
 {
@@ -22,120 +25,225 @@ namespace cadet
 namespace linalg
 {
 
+/**
+ * @brief Copies the Jacobian @p src into @p dest
+ * @details If both matrices share the same sparsity pattern, only the values array is copied.
+ *          Otherwise, a full (deep) copy is performed.
+ * @param [out] dest Destination matrix
+ * @param [in] src Source matrix
+ */
+inline void assignSparseValues(Eigen::SparseMatrix<double, Eigen::RowMajor>& dest, const Eigen::SparseMatrix<double, Eigen::RowMajor>& src)
+{
+    const bool samePattern = dest.isCompressed() && src.isCompressed() && (dest.rows() == src.rows()) && (dest.cols() == src.cols())
+        && (dest.nonZeros() == src.nonZeros())
+        && std::equal(src.outerIndexPtr(), src.outerIndexPtr() + src.outerSize() + 1, dest.outerIndexPtr())
+        && std::equal(src.innerIndexPtr(), src.innerIndexPtr() + src.nonZeros(), dest.innerIndexPtr());
+
+    if (samePattern)
+        std::copy(src.valuePtr(), src.valuePtr() + src.nonZeros(), dest.valuePtr());
+    else
+        dest = src;
+}
+
+/**
+ * @brief Interface of the Eigen based sparse linear solvers
+ * @details The linear solvers operate on a square diagonal block of a row-major matrix (e.g., the Jacobian without
+ *          inlet DOFs). The sparsity pattern of the block is copied once into the storage order required by the
+ *          solver in analyzePattern(), which also performs the symbolic analysis. Subsequent calls to factorize()
+ *          only refresh the values array in place and reuse the symbolic analysis. Solutions are written directly
+ *          into the memory of the caller.
+ */
 class EigenSolverBase {
 public:
+    typedef Eigen::SparseMatrix<double, Eigen::RowMajor> MatrixType;
+
     virtual ~EigenSolverBase() = default;
 
-    virtual void analyzePattern(const Eigen::SparseMatrix<double>& mat) = 0;
-    virtual void factorize(const Eigen::SparseMatrix<double>& mat) = 0;
-    virtual Eigen::VectorXd solve(const Eigen::VectorXd& b) = 0;
+    /**
+     * @brief Analyzes the sparsity pattern of a square diagonal block of the given matrix
+     * @details Has to be called again if the sparsity pattern of the matrix changes.
+     * @param [in] mat Matrix
+     * @param [in] offset Index of the first row and column of the block
+     * @param [in] size Number of rows and columns of the block
+     */
+    virtual void analyzePattern(const MatrixType& mat, int offset, int size) = 0;
+
+    /**
+     * @brief Analyzes the sparsity pattern of the given matrix
+     * @param [in] mat Matrix
+     */
+    void analyzePattern(const MatrixType& mat) { analyzePattern(mat, 0, mat.rows()); }
+
+    /**
+     * @brief Factorizes the block of the given matrix selected in analyzePattern()
+     * @details The sparsity pattern of @p mat has to match the one passed to analyzePattern().
+     *          If the number of nonzero elements differs, the pattern is analyzed again.
+     * @param [in] mat Matrix
+     */
+    virtual void factorize(const MatrixType& mat) = 0;
+
+    /**
+     * @brief Solves the factorized linear system in place
+     * @param [in,out] x On entry, right hand side; on exit, solution of the linear system
+     */
+    virtual void solve(Eigen::Ref<Eigen::VectorXd> x) = 0;
+
     virtual Eigen::ComputationInfo info() const = 0;
 };
 
-template <typename OrderingType>
-class SparseLU : public EigenSolverBase {
+/**
+ * @brief Implements the EigenSolverBase interface for a given Eigen solver
+ * @details Holds a copy of the matrix block in the storage order of the solver. Only the values of this copy
+ *          are updated in factorize().
+ * @tparam SolverType Eigen sparse solver
+ * @tparam SolverMatrixT Matrix type passed to the solver, defaults to the matrix type of the solver
+ */
+template <typename SolverType, typename SolverMatrixT = typename SolverType::MatrixType>
+class EigenSolverAdapter : public EigenSolverBase {
 public:
-    void analyzePattern(const Eigen::SparseMatrix<double>& mat) override {
-        solver.analyzePattern(mat);
-    }
+    typedef SolverMatrixT SolverMatrixType;
 
-    void factorize(const Eigen::SparseMatrix<double>& mat) override {
-        solver.factorize(mat);
-    }
+    EigenSolverAdapter() : _offset(0), _size(0), _srcNonZeros(-1) { }
 
-    Eigen::VectorXd solve(const Eigen::VectorXd& b) override {
-        return solver.solve(b);
+    void analyzePattern(const MatrixType& mat, int offset, int size) override {
+        extractPattern(mat, offset, size);
+        analyzeImpl();
     }
 
-    Eigen::ComputationInfo info() const override {
-        return solver.info();
-    }
+    void factorize(const MatrixType& mat) override {
+        // Sparsity pattern has changed since the last analysis
+        if ((mat.nonZeros() != _srcNonZeros) || (mat.rows() < _offset + _size))
+            analyzePattern(mat, _offset, _size);
 
-private:
-    Eigen::SparseLU<Eigen::SparseMatrix<double>, OrderingType> solver;
-};
-
-template <typename OrderingType>
-class SparseQR : public EigenSolverBase {
-public:
-    void analyzePattern(const Eigen::SparseMatrix<double>& mat) override {
-        //solver.analyzePattern(mat);
-    }
+        double const* const src = mat.valuePtr();
+        double* const dest = _mat.valuePtr();
+        for (std::size_t i = 0; i < _srcIdx.size(); ++i)
+            dest[i] = src[_srcIdx[i]];
 
-    void factorize(const Eigen::SparseMatrix<double>& mat) override {
-        solver.factorize(mat);
+        factorizeImpl();
     }
 
-    Eigen::VectorXd solve(const Eigen::VectorXd& b) override {
-        return solver.solve(b);
+    void solve(Eigen::Ref<Eigen::VectorXd> x) override {
+        // Copy the right hand side to a persistent buffer since the solver must not work in place
+        _rhs = x;
+        x = _solver.solve(_rhs);
     }
 
     Eigen::ComputationInfo info() const override {
-        return solver.info();
+        return _solver.info();
     }
 
-private:
-    Eigen::SparseQR<Eigen::SparseMatrix<double, Eigen::RowMajor>, OrderingType> solver;
-};
+protected:
 
-template <typename PreConditioner>
-class BiCGSTAB : public EigenSolverBase {
-public:
-    void analyzePattern(const Eigen::SparseMatrix<double>& mat) override {
-        solver.analyzePattern(mat);
+    virtual void analyzeImpl() {
+        _solver.analyzePattern(_mat);
     }
 
-    void factorize(const Eigen::SparseMatrix<double>& mat) override {
+    virtual void factorizeImpl() {
+        _solver.factorize(_mat);
+    }
 
-        solver.compute(mat);
+    /**
+     * @brief Copies the sparsity pattern of the block into _mat and records the positions of its values in @p mat
+     * @param [in] mat Matrix
+     * @param [in] offset Index of the first row and column of the block
+     * @param [in] size Number of rows and columns of the block
+     */
+    void extractPattern(const MatrixType& mat, int offset, int size) {
+        _offset = offset;
+        _size = size;
+        _srcNonZeros = mat.nonZeros();
 
-        if (solver.info() != Eigen::Success)
+        // Count entries of each outer index (row or column, depending on storage order of the solver)
+        std::vector<int> outerCount(size + 1, 0);
+        for (int row = offset; row < offset + size; ++row)
         {
-            throw std::runtime_error("BiCGSTAB decomposition failed");
+            for (MatrixType::InnerIterator it(mat, row); it; ++it)
+            {
+                const int col = static_cast<int>(it.col()) - offset;
+                if ((col < 0) || (col >= size))
+                    continue;
+
+                ++outerCount[(SolverMatrixType::IsRowMajor ? row - offset : col) + 1];
+            }
         }
-    }
 
-    Eigen::VectorXd solve(const Eigen::VectorXd& b) override {
-        return solver.solve(b);
-    }
+        for (int i = 0; i < size; ++i)
+            outerCount[i + 1] += outerCount[i];
 
-    Eigen::ComputationInfo info() const override {
-        return solver.info();
+        _mat.resize(size, size);
+        _mat.resizeNonZeros(outerCount[size]);
+        _srcIdx.resize(outerCount[size]);
+        std::copy(outerCount.begin(), outerCount.end(), _mat.outerIndexPtr());
+
+        // Rows are traversed in ascending order, so inner indices are sorted in both storage orders
+        for (int row = offset; row < offset + size; ++row)
+        {
+            for (MatrixType::InnerIterator it(mat, row); it; ++it)
+            {
+                const int col = static_cast<int>(it.col()) - offset;
+                if ((col < 0) || (col >= size))
+                    continue;
+
+                const int outer = SolverMatrixType::IsRowMajor ? row - offset : col;
+                const int pos = outerCount[outer]++;
+                _mat.innerIndexPtr()[pos] = SolverMatrixType::IsRowMajor ? col : row - offset;
+                _srcIdx[pos] = static_cast<int>(&it.value() - mat.valuePtr());
+            }
+        }
+
+        _rhs.resize(size);
     }
 
-private:
-    Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::RowMajor>, PreConditioner> solver;
+    SolverType _solver; //!< Eigen solver
+    SolverMatrixType _mat; //!< Copy of the matrix block in the storage order of the solver
+    std::vector<int> _srcIdx; //!< Position of each value of _mat in the values array of the source matrix
+    Eigen::VectorXd _rhs; //!< Buffer for the right hand side
+    int _offset; //!< Index of the first row and column of the block
+    int _size; //!< Number of rows and columns of the block
+    Eigen::Index _srcNonZeros; //!< Number of nonzero elements of the source matrix at the time of the last analysis
 };
 
-template <typename PreConditioner>
-class LeastSquaresConjugateGradient : public EigenSolverBase {
-public:
-    void analyzePattern(const Eigen::SparseMatrix<double>& mat) override {
-        //solver.analyzePattern(mat);
-    }
+template <typename OrderingType>
+class SparseLU : public EigenSolverAdapter<Eigen::SparseLU<Eigen::SparseMatrix<double>, OrderingType>> { };
 
-    void factorize(const Eigen::SparseMatrix<double>& mat) override {
+template <typename OrderingType>
+class SparseQR : public EigenSolverAdapter<Eigen::SparseQR<Eigen::SparseMatrix<double>, OrderingType>> { };
 
-        solver.compute(mat);
+template <typename PreConditioner>
+class BiCGSTAB : public EigenSolverAdapter<Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::RowMajor>, PreConditioner>> {
+protected:
+    void factorizeImpl() override {
 
-        if (solver.info() != Eigen::Success)
+        this->_solver.factorize(this->_mat);
+
+        if (this->_solver.info() != Eigen::Success)
         {
-            throw std::runtime_error("LeastSquaresConjugateGradient decomposition failed");
+            throw std::runtime_error("BiCGSTAB decomposition failed");
         }
     }
+};
 
-    Eigen::VectorXd solve(const Eigen::VectorXd& b) override {
-        return solver.solve(b);
-    }
+template <typename PreConditioner>
+class LeastSquaresConjugateGradient : public EigenSolverAdapter<Eigen::LeastSquaresConjugateGradient<Eigen::SparseMatrix<double, Eigen::RowMajor>, PreConditioner>> {
+protected:
+    void factorizeImpl() override {
 
-    Eigen::ComputationInfo info() const override {
-        return solver.info();
-    }
+        this->_solver.factorize(this->_mat);
 
-private:
-    Eigen::LeastSquaresConjugateGradient<Eigen::SparseMatrix<double, Eigen::RowMajor>, PreConditioner> solver;
+        if (this->_solver.info() != Eigen::Success)
+        {
+            throw std::runtime_error("LeastSquaresConjugateGradient decomposition failed");
+        }
+    }
 };
 
+/**
+ * @brief Incomplete LU factorization with dual thresholding
+ * @details Only yields an approximate solution and is intended to be used as a preconditioner.
+ */
+class IncompleteLUT : public EigenSolverAdapter<Eigen::IncompleteLUT<double>, Eigen::SparseMatrix<double>> { };
+
 cadet::linalg::EigenSolverBase* setLinearSolver(const std::string solverName);
 
 } // namespace linalg
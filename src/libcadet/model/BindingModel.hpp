@@ -162,6 +162,30 @@ public:
 	 */
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) = 0;
 
+	/**
+	 * @brief Evaluates the external functions on a grid of positions and caches the results
+	 * @details Unit operations call this function once per residual evaluation before evaluating
+	 *          fluxes. Subsequent calls of flux() and related functions with the same time and section
+	 *          read externally dependent parameters from the cache if the ColumnPosition::cacheIdx
+	 *          of their position is set to the index of the position in @p colPos. The cache is only
+	 *          refilled if time or section change. Does nothing if the binding model does not depend
+	 *          on external functions.
+	 *
+	 *          This function is not called concurrently with any other function of the binding model.
+	 * @param [in] t Current time point
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] colPos Array with grid positions of size @p nPositions
+	 * @param [in] nPositions Number of grid positions
+	 */
+	virtual void updateExternalFunctionCache(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nPositions) = 0;
+
+	/**
+	 * @brief Discards the cached external function values
+	 * @details Unit operations call this function whenever the grid positions may have changed
+	 *          and at the beginning of a simulation.
+	 */
+	virtual void invalidateExternalFunctionCache() = 0;
+
 	/**
 	 * @brief Checks whether a given parameter exists
 	 * @param [in] pId ParameterId that identifies the parameter uniquely
@@ -283,6 +307,46 @@ public:
 	virtual int flux(double t, unsigned int secIdx, const ColumnPosition& colPos, double const* y, double const* yCp, active* res, LinearBufferAllocator workSpace) const = 0;
 	virtual int flux(double t, unsigned int secIdx, const ColumnPosition& colPos, double const* y, double const* yCp, double* res, LinearBufferAllocator workSpace) const = 0;
 
+	/**
+	 * @brief Returns whether fluxBatch() is implemented
+	 * @details Unit operations only call fluxBatch() if this function returns @c true.
+	 *          Otherwise, flux() is called for each cell separately.
+	 * @return @c true if fluxBatch() is available, otherwise @c false
+	 */
+	virtual bool supportsFluxBatch() const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Returns the size of the workspace required by fluxBatch() in bytes
+	 * @param [in] nComp Number of components
+	 * @param [in] totalNumBoundStates Total number of bound states
+	 * @param [in] nBoundStates Array with bound states for each component
+	 * @param [in] nCells Maximum number of cells evaluated in one call to fluxBatch()
+	 * @return Size of the workspace in bytes
+	 */
+	virtual unsigned int fluxBatchWorkspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates, unsigned int nCells) const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Evaluates the fluxes of multiple cells at once
+	 * @details Computes the same quantities as flux() for @p nCells cells in one call, which
+	 *          amortizes the parameter update and allows vectorizing the computation over cells.
+	 *          All arrays use structure-of-arrays layout, that is, the value of component (or
+	 *          bound state) @c i in cell @c k is stored at index <tt>i * nCells + k</tt>.
+	 *
+	 *          This function is called simultaneously from multiple threads.
+	 *          It needs to overwrite all values of @p res as the result array @p res is not
+	 *          zeroed on entry.
+	 * @param [in] t Current time point
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] colPos Array with positions of the cells in normalized coordinates (see flux())
+	 * @param [in] nCells Number of cells
+	 * @param [in] y Bound states of all cells
+	 * @param [in] yCp Mobile phase of all cells
+	 * @param [out] res Fluxes of all cells
+	 * @param [in,out] workSpace Memory work space of size fluxBatchWorkspaceSize()
+	 * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+	 */
+	virtual int fluxBatch(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nCells, double const* y, double const* yCp, double* res, LinearBufferAllocator workSpace) const = 0;
+
 	/**
 	 * @brief Evaluates the Jacobian of the fluxes analytically
 	 * @details This function is called simultaneously from multiple threads.
@@ -0,0 +1,135 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides helpers for batching the cell-wise nonlinear solves in consistent initialization.
+ */
+
+#ifndef LIBCADET_CONSISTENTINITBATCHING_HPP_
+#define LIBCADET_CONSISTENTINITBATCHING_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+#include "common/Timer.hpp"
+#include "SimulationTypes.hpp"
+#include "Logging.hpp"
+
+#include <atomic>
+#include <algorithm>
+#include <vector>
+
+namespace cadet
+{
+
+namespace model
+{
+
+/**
+ * @brief Collects statistics of the cell-wise nonlinear solves of one consistent initialization
+ * @details Cells are processed in parallel, hence, all counters are atomic. The timer
+ *          is started on construction and stopped by report().
+ */
+class ConsistentInitStatistics
+{
+public:
+	ConsistentInitStatistics() CADET_NOEXCEPT : _numSolves(0), _numReused(0), _numRetries(0), _numFailures(0), _numResidualEvals(0), _numJacobianEvals(0)
+	{
+		_timer.start();
+	}
+
+	/**
+	 * @brief Registers a cell that has been solved by the nonlinear solver
+	 * @param [in] retried Determines whether the solver has been restarted from another initial guess
+	 * @param [in] converged Determines whether the solver has converged
+	 */
+	inline void addSolve(bool retried, bool converged) CADET_NOEXCEPT
+	{
+		++_numSolves;
+		if (retried)
+			++_numRetries;
+		if (!converged)
+			++_numFailures;
+	}
+
+	/**
+	 * @brief Registers cells whose solution has been copied from an identical cell
+	 * @param [in] n Number of cells
+	 */
+	inline void addReused(unsigned int n = 1) CADET_NOEXCEPT { _numReused += n; }
+
+	inline void addResidualEvaluation() CADET_NOEXCEPT { ++_numResidualEvals; }
+	inline void addJacobianEvaluation() CADET_NOEXCEPT { ++_numJacobianEvals; }
+
+	/**
+	 * @brief Stops the timer and logs the statistics
+	 * @param [in] unitOpIdx Index of the unit operation
+	 * @param [in] simTime Simulation time information
+	 */
+	inline void report(UnitOpIdx unitOpIdx, const SimulationTime& simTime)
+	{
+		const double elapsed = _timer.stop();
+		if (_numSolves + _numReused == 0)
+			return;
+
+		LOG(Debug) << "Consistent init unit " << unitOpIdx << " t = " << simTime.t << " sec = " << simTime.secIdx << ": "
+			<< _numSolves << " cell solves (" << _numRetries << " retries, " << _numFailures << " failures), " << _numReused << " reused, "
+			<< _numResidualEvals << " residual evals, " << _numJacobianEvals << " Jacobian evals in " << elapsed << " s";
+
+		if (_numFailures > 0)
+			LOG(Warning) << "Consistent init unit " << unitOpIdx << " t = " << simTime.t << ": Nonlinear solver did not converge in " << _numFailures << " cells";
+	}
+
+	inline unsigned int numSolves() const CADET_NOEXCEPT { return _numSolves; }
+	inline unsigned int numReused() const CADET_NOEXCEPT { return _numReused; }
+	inline unsigned int numRetries() const CADET_NOEXCEPT { return _numRetries; }
+	inline unsigned int numFailures() const CADET_NOEXCEPT { return _numFailures; }
+
+protected:
+	std::atomic<unsigned int> _numSolves; //!< Number of cells solved by the nonlinear solver
+	std::atomic<unsigned int> _numReused; //!< Number of cells that reuse the solution of an identical cell
+	std::atomic<unsigned int> _numRetries; //!< Number of solves restarted from the solution of a neighboring cell
+	std::atomic<unsigned int> _numFailures; //!< Number of solves that did not converge
+	std::atomic<unsigned int> _numResidualEvals; //!< Number of residual evaluations
+	std::atomic<unsigned int> _numJacobianEvals; //!< Number of Jacobian evaluations
+	Timer _timer; //!< Measures the duration of the consistent initialization
+};
+
+/**
+ * @brief Groups consecutive blocks with bitwise identical state
+ * @details If the model parameters do not depend on the position (i.e., no external functions are used),
+ *          all blocks in a group have the same consistent initial state. Hence, only the first block
+ *          of each group needs to be solved and its solution is copied to the remaining blocks.
+ * @param [in] state Pointer to the first element of the first block
+ * @param [in] nBlocks Number of blocks
+ * @param [in] blockStride Distance between the first elements of two consecutive blocks
+ * @param [in] blockSize Number of elements in a block
+ * @param [in] allowGrouping Determines whether blocks may be grouped, otherwise each block forms its own group
+ * @return Index of the first block of each group followed by @p nBlocks
+ */
+inline std::vector<unsigned int> groupIdenticalBlocks(double const* state, unsigned int nBlocks, unsigned int blockStride, unsigned int blockSize, bool allowGrouping)
+{
+	std::vector<unsigned int> groupStart;
+	groupStart.reserve(nBlocks + 1);
+	for (unsigned int i = 0; i < nBlocks; ++i)
+	{
+		if (!allowGrouping || (i == 0) || !std::equal(state + i * blockStride, state + i * blockStride + blockSize, state + (i - 1) * blockStride))
+			groupStart.push_back(i);
+	}
+	groupStart.push_back(nBlocks);
+	return groupStart;
+}
+
+} // namespace model
+
+} // namespace cadet
+
+#endif  // LIBCADET_CONSISTENTINITBATCHING_HPP_
@@ -51,6 +51,20 @@ namespace model
 		 */
 		inline void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { }
 
+		/**
+		 * @brief Evaluates the external functions on a grid of positions and caches the results
+		 * @param [in] t Current time
+		 * @param [in] secIdx Index of the current section
+		 * @param [in] colPos Array with grid positions of size @p nPositions
+		 * @param [in] nPositions Number of grid positions
+		 */
+		inline void updateExternalFunctionCache(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nPositions) { }
+
+		/**
+		 * @brief Discards the cached external function values
+		 */
+		inline void invalidateExternalFunctionCache() { }
+
 		/**
 		 * @brief Returns whether the model parameters depend on time
 		 * @details Model parameters that do not use external functions do not depend on time.
@@ -101,6 +115,8 @@ namespace model
 		 */
 		inline void setExternalFunctions(IExternalFunction** extFuns, int size)
 		{
+			invalidateExternalFunctionCache();
+
 			_extFun.clear();
 			_extFun.resize(_extFunIndex.size(), nullptr);
 			for (std::size_t i = 0; i < _extFunIndex.size(); ++i)
@@ -129,12 +145,92 @@ namespace model
 		 */
 		static bool requiresWorkspace() CADET_NOEXCEPT { return true; }
 
+		/**
+		 * @brief Evaluates the external functions on a grid of positions and caches the results
+		 * @details Subsequent calls of evaluateExternalFunctions() with the same time and section
+		 *          read the values of positions with a valid ColumnPosition::cacheIdx from the cache
+		 *          instead of evaluating the external functions. The cache is only refilled if time
+		 *          or section change. Each external function is evaluated once for all grid positions
+		 *          using IExternalFunction::externalProfileBatch().
+		 *
+		 *          This function must not be called concurrently with evaluateExternalFunctions().
+		 * @param [in] t Current time
+		 * @param [in] secIdx Index of the current section
+		 * @param [in] colPos Array with grid positions of size @p nPositions, the ColumnPosition::cacheIdx of
+		 *             a position used for lookups is its index in this array
+		 * @param [in] nPositions Number of grid positions
+		 */
+		inline void updateExternalFunctionCache(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nPositions)
+		{
+			if (_cacheValid && (_cacheTime == t) && (_cacheSecIdx == secIdx) && (_cacheNumPositions == nPositions))
+				return;
+
+			const unsigned int nParams = _extFun.size();
+			_cacheValues.resize(nParams * nPositions);
+			_cacheBuffer.resize(4 * nPositions);
+
+			double* const z = _cacheBuffer.data();
+			double* const rho = z + nPositions;
+			double* const r = rho + nPositions;
+			double* const values = r + nPositions;
+			for (unsigned int j = 0; j < nPositions; ++j)
+			{
+				z[j] = colPos[j].axial;
+				rho[j] = colPos[j].radial;
+				r[j] = colPos[j].particle;
+			}
+
+			for (unsigned int i = 0; i < nParams; ++i)
+			{
+				IExternalFunction* const fun = _extFun[i];
+
+				// Reuse values of a previous parameter that depends on the same external function
+				unsigned int src = 0;
+				while ((src < i) && (_extFun[src] != fun))
+					++src;
+
+				if (src < i)
+				{
+					for (unsigned int j = 0; j < nPositions; ++j)
+						_cacheValues[j * nParams + i] = _cacheValues[j * nParams + src];
+					continue;
+				}
+
+				if (fun)
+					fun->externalProfileBatch(t, z, rho, r, nPositions, secIdx, values);
+				else
+					std::fill_n(values, nPositions, 0.0);
+
+				// Store values of all parameters of one position contiguously
+				for (unsigned int j = 0; j < nPositions; ++j)
+					_cacheValues[j * nParams + i] = values[j];
+			}
+
+			_cacheTime = t;
+			_cacheSecIdx = secIdx;
+			_cacheNumPositions = nPositions;
+			_cacheValid = true;
+		}
+
+		/**
+		 * @brief Discards the cached external function values
+		 * @details Has to be called whenever the grid positions or the external functions change.
+		 */
+		inline void invalidateExternalFunctionCache() { _cacheValid = false; }
+
 	protected:
 
 		std::vector<IExternalFunction*> _extFun; //!< Pointer to the external function
 		std::vector<int> _extFunIndex; //!< Index to the external function
 
-		ExternalParamHandlerBase() : _extFun(), _extFunIndex() { }
+		bool _cacheValid; //!< Determines whether the cache holds valid values
+		double _cacheTime; //!< Time of the cached values
+		unsigned int _cacheSecIdx; //!< Section index of the cached values
+		unsigned int _cacheNumPositions; //!< Number of grid positions in the cache
+		std::vector<double> _cacheValues; //!< Cached function values (all parameters of a grid position are stored contiguously)
+		std::vector<double> _cacheBuffer; //!< Buffer for coordinates and function values of the grid positions
+
+		ExternalParamHandlerBase() : _extFun(), _extFunIndex(), _cacheValid(false), _cacheTime(0.0), _cacheSecIdx(0), _cacheNumPositions(0) { }
 		
 		/**
 		 * @brief Configures the external data source of this externally dependent parameter set
@@ -143,6 +239,8 @@ namespace model
 		 */
 		inline void configure(IParameterProvider& paramProvider, unsigned int nParams)
 		{			
+			invalidateExternalFunctionCache();
+
 			std::vector<int> idx;
 			if (paramProvider.exists("EXTFUN"))
 				idx = paramProvider.getIntArray("EXTFUN");
@@ -167,6 +265,7 @@ namespace model
 
 		/**
 		 * @brief Evaluates the external functions for the different parameters
+		 * @details Reads the values from the cache if @p colPos is part of the cached grid and time and section match.
 		 * @param [in] t Current time
 		 * @param [in] z Axial coordinate in the column
 		 * @param [in] r Radial coordinate in the bead
@@ -176,6 +275,12 @@ namespace model
 		 */
 		inline void evaluateExternalFunctions(double t, unsigned int secIdx, const ColumnPosition& colPos, unsigned int nParams, double* buffer) const
 		{
+			if (_cacheValid && (colPos.cacheIdx >= 0) && (static_cast<unsigned int>(colPos.cacheIdx) < _cacheNumPositions) && (_cacheTime == t) && (_cacheSecIdx == secIdx))
+			{
+				std::copy_n(_cacheValues.data() + colPos.cacheIdx * _extFun.size(), nParams, buffer);
+				return;
+			}
+
 			for (unsigned int i = 0; i < nParams; ++i)
 			{
 				IExternalFunction* const fun = _extFun[i];
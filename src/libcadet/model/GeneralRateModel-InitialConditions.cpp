@@ -20,6 +20,7 @@
 #include "model/parts/BindingCellKernel.hpp"
 #include "SimulationTypes.hpp"
 #include "SensParamUtil.hpp"
+#include "model/ConsistentInitBatching.hpp"
 
 #include <algorithm>
 #include <functional>
@@ -312,6 +313,7 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 	BENCH_SCOPE(_timerConsistentInit);
 
 	Indexer idxr(_disc);
+	ConsistentInitStatistics stats;
 
 	// Step 1: Solve algebraic equations
 
@@ -347,13 +349,21 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 		const linalg::ConstMaskArray mask{qsMask.data(), static_cast<int>(_disc.nComp + _disc.strideBound[type])};
 		const int probSize = linalg::numMaskActive(mask);
 
+		// Cells with identical state have the same solution unless parameters depend on time and position
+		const bool reuseSolution = !_binding[type]->dependsOnTime() && !(_dynReaction[type] && _dynReaction[type]->dependsOnTime());
+
+		// Group consecutive particles with identical state and only solve the first particle of each group
+		const std::vector<unsigned int> groupStart = groupIdenticalBlocks(vecStateY + idxr.offsetCp(ParticleTypeIndex{type}),
+			_disc.nCol, idxr.strideParBlock(type), idxr.strideParBlock(type), reuseSolution);
+
 #ifdef CADET_PARALLELIZE
 		BENCH_SCOPE(_timerConsistentInitPar);
-		tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCol), [&](std::size_t pblk)
+		tbb::parallel_for(std::size_t(0), groupStart.size() - 1, [&](std::size_t grp)
 #else
-		for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+		for (std::size_t grp = 0; grp < groupStart.size() - 1; ++grp)
 #endif
 		{
+			const unsigned int pblk = groupStart[grp];
 			LinearBufferAllocator tlmAlloc = threadLocalMem.get();
 
 			// Reuse memory of band matrix for dense matrix
@@ -381,6 +391,23 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 			BufferedArray<double> conservedQuantsBuffer = tlmAlloc.array<double>(numActiveComp);
 			double* const conservedQuants = static_cast<double*>(conservedQuantsBuffer);
 
+			// Initial and final state of the previous shell for reusing its solution
+			BufferedArray<double> prevInitialBuffer = tlmAlloc.array<double>(mask.len);
+			double* const prevInitial = static_cast<double*>(prevInitialBuffer);
+
+			BufferedArray<double> prevFinalBuffer = tlmAlloc.array<double>(mask.len);
+			double* const prevFinal = static_cast<double*>(prevFinalBuffer);
+
+			// Last converged solution in this particle used as warm start if the solver fails
+			BufferedArray<double> prevSolutionBuffer = tlmAlloc.array<double>(probSize);
+			double* const prevSolution = static_cast<double*>(prevSolutionBuffer);
+
+			BufferedArray<double> firstAttemptBuffer = tlmAlloc.array<double>(probSize);
+			double* const firstAttempt = static_cast<double*>(firstAttemptBuffer);
+
+			bool hasPrevShell = false;
+			bool hasPrevSolution = false;
+
 			linalg::DenseMatrixView jacobianMatrix(jacobianMem, _jacPdisc[type * _disc.nCol + pblk].pivot(), probSize, probSize);
 			const parts::cell::CellParameters cellResParams = makeCellResidualParams(type, mask.mask + _disc.nComp);
 
@@ -397,9 +424,25 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 
 				const ColumnPosition colPos{z, 0.0, static_cast<double>(_parCenterRadius[_disc.nParCellsBeforeType[type] + shell]) / static_cast<double>(_parRadius[type])};
 
+				// Reuse solution of previous shell if its initial state is identical
+				double* const cellState = qShell - idxr.strideParLiquid();
+				if (reuseSolution)
+				{
+					if (hasPrevShell && std::equal(cellState, cellState + mask.len, prevInitial))
+					{
+						std::copy_n(prevFinal, mask.len, cellState);
+						stats.addReused();
+						continue;
+					}
+					std::copy_n(cellState, mask.len, prevInitial);
+				}
+
 				// Determine whether nonlinear solver is required
 				if (!_binding[type]->preConsistentInitialState(simTime.t, simTime.secIdx, colPos, qShell, qShell - idxr.strideParLiquid(), tlmAlloc))
+				{
+					hasPrevShell = false;
 					continue;
+				}
 
 				// Extract initial values from current state
 				linalg::selectVectorSubset(qShell - _disc.nComp, mask, solution);
@@ -413,6 +456,8 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 				{
 					jacFunc = [&](double const* const x, linalg::detail::DenseMatrixBase& mat)
 					{
+						stats.addJacobianEvaluation();
+
 						// Copy over state vector to AD state vector (without changing directional values to keep seed vectors)
 						// and initialize residuals with zero (also resetting directional values)
 						ad::copyToAd(qShell - _disc.nComp, localAdY, mask.len);
@@ -489,6 +534,8 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 				{
 					jacFunc = [&](double const* const x, linalg::detail::DenseMatrixBase& mat)
 					{
+						stats.addJacobianEvaluation();
+
 						// Prepare input vector by overwriting masked items
 						std::copy_n(qShell - _disc.nComp, mask.len, fullX);
 						linalg::applyVectorSubset(x, mask, fullX);
@@ -534,10 +581,10 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 					};
 				}
 
-				// Apply nonlinear solver
-				_nonlinearSolver->solve(
-					[&](double const* const x, double* const r)
+				const auto residual = [&](double const* const x, double* const r)
 					{
+						stats.addResidualEvaluation();
+
 						// Prepare input vector by overwriting masked items
 						std::copy_n(qShell - _disc.nComp, mask.len, fullX);
 						linalg::applyVectorSubset(x, mask, fullX);
@@ -578,14 +625,47 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 						}
 
 						return true;
-					},
-					jacFunc, errorTol, solution, nonlinMem, jacobianMatrix, probSize);
+					};
+
+				// Apply nonlinear solver
+				bool converged = _nonlinearSolver->solve(residual, jacFunc, errorTol, solution, nonlinMem, jacobianMatrix, probSize);
+
+				// Restart from solution of neighboring shell on failure
+				const bool retry = !converged && hasPrevSolution;
+				if (retry)
+				{
+					std::copy_n(solution, probSize, firstAttempt);
+					std::copy_n(prevSolution, probSize, solution);
+					converged = _nonlinearSolver->solve(residual, jacFunc, errorTol, solution, nonlinMem, jacobianMatrix, probSize);
+					if (!converged)
+						std::copy_n(firstAttempt, probSize, solution);
+				}
+
+				stats.addSolve(retry, converged);
+				if (converged)
+				{
+					std::copy_n(solution, probSize, prevSolution);
+					hasPrevSolution = true;
+				}
 
 				// Apply solution
 				linalg::applyVectorSubset(solution, mask, qShell - idxr.strideParLiquid());
 
 				// Refine / correct solution
 				_binding[type]->postConsistentInitialState(simTime.t, simTime.secIdx, colPos, qShell, qShell - idxr.strideParLiquid(), tlmAlloc);
+
+				if (reuseSolution)
+				{
+					std::copy_n(cellState, mask.len, prevFinal);
+					hasPrevShell = true;
+				}
+			}
+
+			// Copy solution to the remaining particles of the group
+			for (unsigned int i = pblk + 1; i < groupStart[grp + 1]; ++i)
+			{
+				std::copy_n(vecStateY + localOffsetToParticle, idxr.strideParBlock(type), vecStateY + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{i}));
+				stats.addReused(_disc.nParCell[type]);
 			}
 		} CADET_PARFOR_END;
 	}
@@ -597,6 +677,8 @@ void GeneralRateModel<ConvDispOperator>::consistentInitialState(const Simulation
 	std::fill(jf, jf + _disc.nComp * _disc.nCol * _disc.nParType, 0.0);
 
 	solveForFluxes(vecStateY, idxr);
+
+	stats.report(_unitOpIdx, simTime);
 }
 
 /**
@@ -24,6 +24,7 @@
 #include "Logging.hpp"
 
 #include "ParallelSupport.hpp"
+#include "Profiler.hpp"
 
 #ifdef CADET_PARALLELIZE
 	#include <tbb/parallel_for.h>
@@ -114,24 +115,31 @@ int GeneralRateModel<ConvDispOperator>::linearSolve(double t, double alpha, doub
 	const ConstSimulationState& simState)
 {
 	BENCH_SCOPE(_timerLinearSolve);
+	BENCH_INCREMENT(_numLinearSolves);
 
 	Indexer idxr(_disc);
 
 	// ==== Step 1: Factorize diagonal Jacobian blocks
 
 	// Factorize partial Jacobians only if required
+	// In the parallel case, the factorization nodes A and B are only connected to
+	// the graph and triggered if the Jacobian has changed since the last call.
+	// Otherwise, the graph starts at node C and reuses the existing factorizations.
 
 #ifdef CADET_PARALLELIZE
 	tbb::flow::graph g;
 #else
 	if (_factorizeJacobian)
 	{
+		BENCH_INCREMENT(_numFactorizations);
 #endif
 
 #ifdef CADET_PARALLELIZE
 		node_t A(g, [&](msg_t)
 #endif
 		{
+			CADET_PROFILE_SCOPE_UNIT("factorize bulk", _unitOpIdx);
+
 			// Assemble and factorize discretized bulk Jacobian
 			const bool result = _convDispOp.assembleAndFactorizeDiscretizedJacobian(alpha);
 			if (cadet_unlikely(!result))
@@ -145,6 +153,8 @@ int GeneralRateModel<ConvDispOperator>::linearSolve(double t, double alpha, doub
 		node_t B(g, [&](msg_t)
 #endif
 		{
+			CADET_PROFILE_SCOPE_UNIT("factorize particles", _unitOpIdx);
+
 #ifdef CADET_PARALLELIZE
 			tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCol * _disc.nParType), [&](std::size_t pblk)
 #else
@@ -256,7 +266,10 @@ int GeneralRateModel<ConvDispOperator>::linearSolve(double t, double alpha, doub
 		const double tolerance = std::sqrt(static_cast<double>(_gmres.matrixSize())) * outerTol * _schurSafety;
 
 		BENCH_START(_timerGmres);
-		_gmres.solve(tolerance, weight + idxr.offsetJf(), _tempState + idxr.offsetJf(), rhs + idxr.offsetJf());
+		{
+			CADET_PROFILE_SCOPE_UNIT("unit gmres", _unitOpIdx);
+			_gmres.solve(tolerance, weight + idxr.offsetJf(), _tempState + idxr.offsetJf(), rhs + idxr.offsetJf());
+		}
 		BENCH_STOP(_timerGmres);
 
 		// Remove temporary results that are leftovers from schurComplementMatrixVector()
@@ -343,6 +356,7 @@ int GeneralRateModel<ConvDispOperator>::linearSolve(double t, double alpha, doub
 	{
 		// Do not factorize again at next call without changed Jacobians
 		_factorizeJacobian = false;
+		BENCH_INCREMENT(_numFactorizations);
 
 		A.try_put(tbb::flow::continue_msg());
 		B.try_put(tbb::flow::continue_msg());
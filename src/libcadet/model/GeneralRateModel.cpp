@@ -40,6 +40,7 @@
 #include <functional>
 #include <numeric>
 #include <iterator>
+#include <type_traits>
 
 #include "ParallelSupport.hpp"
 #ifdef CADET_PARALLELIZE
@@ -891,6 +892,18 @@ unsigned int GeneralRateModel<ConvDispOperator>::threadLocalMemorySize() const C
 	lms.add<double>((maxStrideBound + _disc.nComp) * (maxStrideBound + _disc.nComp));
 
 	lms.commit();
+
+	// Memory for batched binding flux evaluation in residualParticle()
+	for (unsigned int i = 0; i < _disc.nParType; ++i)
+	{
+		if (!_binding[i] || !_binding[i]->supportsFluxBatch())
+			continue;
+
+		lms.add<ColumnPosition>(_disc.nParCell[i]);
+		lms.addBlock(parts::cell::bindingFluxBatchMemorySize(*_binding[i], _disc.nComp, _disc.strideBound[i], _disc.nBound + i * _disc.nComp, _disc.nParCell[i]));
+		lms.commit();
+	}
+
 	const std::size_t resImplSize = lms.bufferSize();
 
 	// Memory for consistentInitialState()
@@ -901,6 +914,12 @@ unsigned int GeneralRateModel<ConvDispOperator>::threadLocalMemorySize() const C
 	lms.add<double>((_disc.nComp + maxStrideBound) * (_disc.nComp + maxStrideBound));
 	lms.add<double>(_disc.nComp);
 
+	// Previous shell state and solution for reuse and warm start
+	lms.add<double>(_disc.nComp + maxStrideBound);
+	lms.add<double>(_disc.nComp + maxStrideBound);
+	lms.add<double>(_disc.nComp + maxStrideBound);
+	lms.add<double>(_disc.nComp + maxStrideBound);
+
 	lms.addBlock(resImplSize);
 	lms.commit();
 
@@ -948,6 +967,10 @@ void GeneralRateModel<ConvDispOperator>::useAnalyticJacobian(const bool analytic
 template <typename ConvDispOperator>
 void GeneralRateModel<ConvDispOperator>::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
 {
+	// Particle shell positions may have changed since the last simulation
+	if (secIdx == 0)
+		setupBindingExternalFunctionGrid();
+
 	// Setup flux Jacobian blocks at the beginning of the simulation or in case of
 	// section dependent film or particle diffusion coefficients
 	if ((secIdx == 0) || isSectionDependent(_filmDiffusionMode) || isSectionDependent(_parDiffusionMode) || isSectionDependent(_parSurfDiffusionMode))
@@ -982,6 +1005,36 @@ void GeneralRateModel<ConvDispOperator>::notifyDiscontinuousSectionTransition(do
 	}
 }
 
+template <typename ConvDispOperator>
+void GeneralRateModel<ConvDispOperator>::setupBindingExternalFunctionGrid()
+{
+	if (!bindingDependsOnTime())
+	{
+		setBindingExternalFunctionGrid({}, {});
+		return;
+	}
+
+	// All particle shells of a particle type in order of column cell and particle shell
+	std::vector<ColumnPosition> grid;
+	std::vector<unsigned int> typeOffset(_disc.nParType + 1, 0);
+	grid.reserve(_disc.nCol * _disc.nParCellsBeforeType[_disc.nParType]);
+	for (unsigned int type = 0; type < _disc.nParType; ++type)
+	{
+		typeOffset[type] = grid.size();
+
+		active const* const parCenterRadius = _parCenterRadius.data() + _disc.nParCellsBeforeType[type];
+		for (unsigned int col = 0; col < _disc.nCol; ++col)
+		{
+			const double z = _convDispOp.relativeCoordinate(col);
+			for (unsigned int par = 0; par < _disc.nParCell[type]; ++par)
+				grid.push_back(ColumnPosition{z, 0.0, static_cast<double>(parCenterRadius[par]) / static_cast<double>(_parRadius[type])});
+		}
+	}
+	typeOffset[_disc.nParType] = grid.size();
+
+	setBindingExternalFunctionGrid(std::move(grid), std::move(typeOffset));
+}
+
 template <typename ConvDispOperator>
 void GeneralRateModel<ConvDispOperator>::setFlowRates(active const* in, active const* out) CADET_NOEXCEPT
 {
@@ -1249,6 +1302,11 @@ int GeneralRateModel<ConvDispOperator>::residualImpl(double t, unsigned int secI
 {
 	BENCH_START(_timerResidualPar);
 
+	// Evaluate external functions of the binding models once for all particle shells
+	updateBindingExternalFunctionCache(t, secIdx);
+
+	util::ErrorIndicator err;
+
 #ifdef CADET_PARALLELIZE
 	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCol * _disc.nParType + 1), [&](std::size_t pblk)
 #else
@@ -1261,14 +1319,14 @@ int GeneralRateModel<ConvDispOperator>::residualImpl(double t, unsigned int secI
 		{
 			const unsigned int type = (pblk - 1) / _disc.nCol;
 			const unsigned int par = (pblk - 1) % _disc.nCol;
-			residualParticle<StateType, ResidualType, ParamType, wantJac, wantRes>(t, type, par, secIdx, y, yDot, res, threadLocalMem);
+			err.update(residualParticle<StateType, ResidualType, ParamType, wantJac, wantRes>(t, type, par, secIdx, y, yDot, res, threadLocalMem));
 		}
 	} CADET_PARFOR_END;
 
 	BENCH_STOP(_timerResidualPar);
 
 	if (!wantRes)
-		return 0;
+		return err.code();
 
 	residualFlux<StateType, ResidualType, ParamType>(t, secIdx, y, yDot, res);
 
@@ -1278,7 +1336,7 @@ int GeneralRateModel<ConvDispOperator>::residualImpl(double t, unsigned int secI
 		res[i] = y[i];
 	}
 
-	return 0;
+	return err.code();
 }
 
 template <typename ConvDispOperator>
@@ -1358,13 +1416,34 @@ int GeneralRateModel<ConvDispOperator>::residualParticle(double t, unsigned int
 	int const* const qsReaction = _binding[parType]->reactionQuasiStationarity();
 	const parts::cell::CellParameters cellResParams = makeCellResidualParams(parType, qsReaction);
 
+	// Evaluate binding fluxes of all particle cells at once if the binding model supports it
+	int retCode = 0;
+	bool bindingDone = false;
+	if constexpr (std::is_same_v<StateType, double> && std::is_same_v<ResidualType, double> && !wantJac && wantRes)
+	{
+		if (_binding[parType]->supportsFluxBatch())
+		{
+			LinearBufferAllocator batchAlloc = tlmAlloc;
+			BufferedArray<ColumnPosition> colPos = batchAlloc.array<ColumnPosition>(_disc.nParCell[parType]);
+			for (unsigned int par = 0; par < _disc.nParCell[parType]; ++par)
+				colPos[par] = ColumnPosition{z, 0.0, static_cast<double>(parCenterRadius[par]) / static_cast<double>(_parRadius[parType]), bindingExternalFunctionCacheIdx(parType, colCell * _disc.nParCell[parType] + par)};
+
+			retCode = parts::cell::bindingFluxBatch(t, secIdx, static_cast<ColumnPosition*>(colPos), _disc.nParCell[parType], idxr.strideParShell(parType), y, res, cellResParams, batchAlloc);
+			bindingDone = true;
+		}
+	}
+
 	// Loop over particle cells
 	for (unsigned int par = 0; par < _disc.nParCell[parType]; ++par)
 	{
-		const ColumnPosition colPos{z, 0.0, static_cast<double>(parCenterRadius[par]) / static_cast<double>(_parRadius[parType])};
+		const ColumnPosition colPos{z, 0.0, static_cast<double>(parCenterRadius[par]) / static_cast<double>(_parRadius[parType]), bindingExternalFunctionCacheIdx(parType, colCell * _disc.nParCell[parType] + par)};
 
 		// Handle time derivatives, binding, dynamic reactions
-		if (wantRes)
+		if (wantRes && bindingDone)
+			parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, true, true, false>(
+				t, secIdx, colPos, y, yDotBase ? yDot : nullptr, res, jac, cellResParams, tlmAlloc
+			);
+		else if (wantRes)
 			parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, true>(
 				t, secIdx, colPos, y, yDotBase ? yDot : nullptr, res, jac, cellResParams, tlmAlloc
 			);
@@ -1897,7 +1976,7 @@ int GeneralRateModel<ConvDispOperator>::residualParticle(double t, unsigned int
 		// Advance yDot over particle shell
 		yDot += idxr.strideParShell(parType);
 	}
-	return 0;
+	return retCode;
 }
 
 template <typename ConvDispOperator>
@@ -206,7 +206,9 @@ public:
 			_timerFactorizePar.totalElapsedTime(),
 			_timerMatVec.totalElapsedTime(),
 			_timerGmres.totalElapsedTime(),
-			static_cast<double>(_gmres.numIterations())
+			static_cast<double>(_gmres.numIterations()),
+			static_cast<double>(_numFactorizations),
+			static_cast<double>(_numLinearSolves)
 		});
 	}
 
@@ -226,7 +228,9 @@ public:
 			"FactorizePar",
 			"MatVec",
 			"Gmres",
-			"NumGMRESIter"
+			"NumGMRESIter",
+			"NumFactorize",
+			"NumLinearSolve"
 		};
 		return desc;
 	}
@@ -251,6 +255,7 @@ protected:
 	int residualFlux(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res);
 
 	void assembleOffdiagJac(double t, unsigned int secIdx, double const* vecStateY);
+	void setupBindingExternalFunctionGrid();
 	void assembleOffdiagJacFluxParticle(double t, unsigned int secIdx, double const* vecStateY);
 	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
 
@@ -387,6 +392,8 @@ protected:
 	BENCH_TIMER(_timerFactorizePar)
 	BENCH_TIMER(_timerMatVec)
 	BENCH_TIMER(_timerGmres)
+	BENCH_COUNTER(_numFactorizations)
+	BENCH_COUNTER(_numLinearSolves)
 
 	// Wrapper for calling the corresponding function in GeneralRateModel class
 	template <typename Op_t>
@@ -673,8 +673,6 @@ void GeneralRateModelDG::consistentInitialTimeDerivative(const SimulationTime& s
 	for (unsigned int entry = 0; entry < _globalJacDisc.nonZeros(); entry++)
 		entries[entry] = 0.0;
 
-	Eigen::Map<VectorXd> yDot(vecStateYdot, numDofs());
-
 	// Note that the residual has not been negated, yet. We will do that now.
 	for (unsigned int i = 0; i < numDofs(); ++i)
 		vecStateYdot[i] = -vecStateYdot[i];
@@ -748,15 +746,13 @@ void GeneralRateModelDG::consistentInitialTimeDerivative(const SimulationTime& s
 #endif
 
 	// Factorize
-	_linearSolver->factorize(_globalJacDisc.block(idxr.offsetC(), idxr.offsetC(), numPureDofs(), numPureDofs()));
-	if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
+	if (cadet_unlikely(!factorizeDiscretizedJacobian()))
 	{
 		LOG(Error) << "Factorize() failed";
 	}
 
 	// Solve
-	yDot.segment(idxr.offsetC(), numPureDofs()) = _linearSolver->solve(yDot.segment(idxr.offsetC(), numPureDofs()));
-	if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
+	if (cadet_unlikely(!solveDiscretizedJacobian(vecStateYdot + idxr.offsetC())))
 	{
 		LOG(Error) << "Solve() failed";
 	}
@@ -1169,19 +1165,13 @@ void GeneralRateModelDG::consistentInitialSensitivity(const SimulationTime& simT
 
 		} CADET_PARFOR_END;
 
-		Eigen::Map<VectorXd> yDot(sensYdot, numPureDofs());
-
 		// Factorize
-		_linearSolver->factorize(_globalJacDisc.block(idxr.offsetC(), idxr.offsetC(), numPureDofs(), numPureDofs()));
-
-		if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
+		if (cadet_unlikely(!factorizeDiscretizedJacobian()))
 		{
 			LOG(Error) << "Factorize() failed";
 		}
 		// Solve
-		yDot.segment(0, numPureDofs()) = _linearSolver->solve(yDot.segment(0, numPureDofs()));
-
-		if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
+		if (cadet_unlikely(!solveDiscretizedJacobian(sensYdot)))
 		{
 			LOG(Error) << "Solve() failed";
 		}
@@ -1214,23 +1204,28 @@ void GeneralRateModelDG::solveBulkTimeDerivativeSystem(const SimulationTime& sim
 	}
 
 	const int bulkRows = idxr.offsetCp() - idxr.offsetC();
-	_linearSolver->analyzePattern(_globalJacDisc.block(idxr.offsetC(), idxr.offsetC(), bulkRows, bulkRows));
-	_linearSolver->factorize(_globalJacDisc.block(idxr.offsetC(), idxr.offsetC(), bulkRows, bulkRows));
 
-	if (_linearSolver->info() != Success) {
+	// In iterative mode, the first block of the preconditioner is the bulk block
+	linalg::EigenSolverBase* const bulkSolver = _iterativeLinearSolver ? _precondSolvers[0] : _linearSolver;
+	if (!_iterativeLinearSolver)
+		bulkSolver->analyzePattern(_globalJacDisc, idxr.offsetC(), bulkRows);
+	bulkSolver->factorize(_globalJacDisc);
+
+	if (bulkSolver->info() != Success) {
 		LOG(Error) << "factorization failed in sensitivity initialization";
 	}
 
 	Eigen::Map<Eigen::VectorXd> ret_vec(rhs, bulkRows);
-	ret_vec = _linearSolver->solve(ret_vec);
+	bulkSolver->solve(ret_vec);
 
 	// Use the factors to solve the linear system 
-	if (_linearSolver->info() != Success) {
+	if (bulkSolver->info() != Success) {
 		LOG(Error) << "solve failed in sensitivity initialization";
 	}
 
 	// reset linear solver to global Jacobian
-	_linearSolver->analyzePattern(_globalJacDisc.block(idxr.offsetC(), idxr.offsetC(), numPureDofs(), numPureDofs()));
+	if (!_iterativeLinearSolver)
+		analyzeDiscretizedJacobianPattern();
 }
 
 /**
@@ -16,6 +16,7 @@
 #include "AdUtils.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 
 #include "LoggingUtils.hpp"
@@ -126,9 +127,11 @@ int GeneralRateModelDG::linearSolve(double t, double alpha, double outerTol, dou
 		// Assemble and factorize discretized bulk Jacobian
 		assembleDiscretizedGlobalJacobian(alpha, idxr);
 
-		_linearSolver->factorize(_globalJacDisc.block(idxr.offsetC(), idxr.offsetC(), numPureDofs(), numPureDofs()));
+		BENCH_START(_timerFactorize);
+		const bool result = factorizeDiscretizedJacobian();
+		BENCH_STOP(_timerFactorize);
 
-		if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
+		if (cadet_unlikely(!result))
 		{
 			LOG(Error) << "Factorize() failed";
 		}
@@ -152,9 +155,15 @@ int GeneralRateModelDG::linearSolve(double t, double alpha, double outerTol, dou
 	// ==== Step 2: Solve system of pure DOFs
 	// The result is stored in rhs (in-place solution)
 
-	r.segment(idxr.offsetC(), numPureDofs()) = _linearSolver->solve(r.segment(idxr.offsetC(), numPureDofs()));
+	if (_iterativeLinearSolver)
+	{
+		const double tolerance = std::sqrt(static_cast<double>(_gmres.matrixSize())) * outerTol * _schurSafety;
 
-	if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
+		// Let the time integrator decide how to proceed if GMRES did not converge
+		if (cadet_unlikely(!solveDiscretizedJacobian(rhs + idxr.offsetC(), weight + idxr.offsetC(), tolerance)))
+			return 1;
+	}
+	else if (cadet_unlikely(!solveDiscretizedJacobian(rhs + idxr.offsetC())))
 	{
 		LOG(Error) << "Solve() failed";
 	}
@@ -163,6 +172,175 @@ int GeneralRateModelDG::linearSolve(double t, double alpha, double outerTol, dou
 	return 0;
 }
 
+/**
+ * @brief Analyzes the sparsity pattern of the discretized Jacobian of the pure DOFs
+ * @details In iterative mode, only the diagonal blocks (bulk block and particle blocks)
+ *          of the block-Jacobi preconditioner are analyzed.
+ */
+void GeneralRateModelDG::analyzeDiscretizedJacobianPattern()
+{
+	if (!_iterativeLinearSolver)
+	{
+		_linearSolver->analyzePattern(_globalJacDisc, _disc.nComp, numPureDofs());
+		return;
+	}
+
+	for (std::size_t blk = 0; blk < _precondSolvers.size(); ++blk)
+		_precondSolvers[blk]->analyzePattern(_globalJacDisc, _precondBlockOffset[blk], _precondBlockOffset[blk + 1] - _precondBlockOffset[blk]);
+}
+
+/**
+ * @brief Factorizes the discretized Jacobian of the pure DOFs stored in _globalJacDisc
+ * @details In iterative mode, only the diagonal blocks of the block-Jacobi preconditioner
+ *          are factorized. Their size does not depend on the number of elements, which
+ *          keeps the memory requirements linear in the mesh size.
+ * @return @c true if the factorization was successful, otherwise @c false
+ */
+bool GeneralRateModelDG::factorizeDiscretizedJacobian()
+{
+	if (!_iterativeLinearSolver)
+	{
+		_linearSolver->factorize(_globalJacDisc);
+		return _linearSolver->info() == Eigen::Success;
+	}
+
+#ifdef CADET_PARALLELIZE
+	BENCH_START(_timerFactorizePar);
+	tbb::parallel_for(std::size_t(0), _precondSolvers.size(), [&](std::size_t blk)
+#else
+	for (std::size_t blk = 0; blk < _precondSolvers.size(); ++blk)
+#endif
+	{
+		_precondSolvers[blk]->factorize(_globalJacDisc);
+	} CADET_PARFOR_END;
+
+#ifdef CADET_PARALLELIZE
+	BENCH_STOP(_timerFactorizePar);
+#endif
+
+	return std::all_of(_precondSolvers.begin(), _precondSolvers.end(), [](cadet::linalg::EigenSolverBase const* ls) { return ls->info() == Eigen::Success; });
+}
+
+/**
+ * @brief Solves the linear system with the factorized discretized Jacobian of the pure DOFs
+ * @details In iterative mode, the system @f$ J x = b @f$ is solved by GMRES with right preconditioning,
+ *          that is, @f$ J P^{-1} u = b @f$ is solved for @f$ u @f$ and the solution is recovered by
+ *          @f$ x = P^{-1} u @f$. The block-Jacobi preconditioner @f$ P @f$ consists of the bulk block
+ *          and the particle blocks of @f$ J @f$, which are only coupled by film diffusion.
+ *          Since the residual of the preconditioned system equals the residual of the original
+ *          system, the tolerance applies to the original system.
+ * @param [in,out] rhs On entry the right hand side of the pure DOFs, on exit the solution
+ * @param [in] weight Error weights of the pure DOFs used in the GMRES norm
+ * @param [in] tolerance Tolerance on the weighted l^2 norm of the residual
+ * @return @c true if the system has been solved successfully, otherwise @c false
+ */
+bool GeneralRateModelDG::solveDiscretizedJacobian(double* const rhs, double const* const weight, double tolerance)
+{
+	if (!_iterativeLinearSolver)
+	{
+		_linearSolver->solve(Eigen::Map<VectorXd>(rhs, numPureDofs()));
+		return _linearSolver->info() == Eigen::Success;
+	}
+
+	// Use zero as initial guess
+	std::copy_n(rhs, numPureDofs(), _gmresRhs.data());
+	std::fill_n(rhs, numPureDofs(), 0.0);
+
+	BENCH_START(_timerGmres);
+	const int gmresResult = _gmres.solve(tolerance, weight, _gmresRhs.data(), rhs);
+	BENCH_STOP(_timerGmres);
+
+	// Recover solution of original system
+	solveDiagonalBlocks(rhs);
+
+	if (cadet_unlikely(gmresResult != 0))
+	{
+		LOG(Debug) << "GMRES did not converge: " << _gmres.getReturnFlagName(gmresResult);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Solves the linear system with the factorized discretized Jacobian of the pure DOFs
+ * @details Used by the consistent initialization, which does not provide error weights.
+ *          The system matrices assembled there are block diagonal and, hence, are solved
+ *          by the block-Jacobi preconditioner in one GMRES iteration if the blocks are
+ *          factorized exactly.
+ * @param [in,out] rhs On entry the right hand side of the pure DOFs, on exit the solution
+ * @return @c true if the system has been solved successfully, otherwise @c false
+ */
+bool GeneralRateModelDG::solveDiscretizedJacobian(double* const rhs)
+{
+	if (!_iterativeLinearSolver)
+		return solveDiscretizedJacobian(rhs, nullptr, 0.0);
+
+	const double tolerance = std::max(Eigen::Map<const VectorXd>(rhs, numPureDofs()).norm(), 1.0) * 1e-12;
+	return solveDiscretizedJacobian(rhs, _gmresWeight.data(), tolerance);
+}
+
+/**
+ * @brief Applies the inverse of the block-Jacobi preconditioner @f$ P @f$
+ * @param [in,out] x On entry the vector @f$ x @f$ of the pure DOFs, on exit @f$ P^{-1} x @f$
+ */
+void GeneralRateModelDG::solveDiagonalBlocks(double* const x)
+{
+	const int offset = _precondBlockOffset.front();
+
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(std::size_t(0), _precondSolvers.size(), [&](std::size_t blk)
+#else
+	for (std::size_t blk = 0; blk < _precondSolvers.size(); ++blk)
+#endif
+	{
+		_precondSolvers[blk]->solve(Eigen::Map<VectorXd>(x + _precondBlockOffset[blk] - offset, _precondBlockOffset[blk + 1] - _precondBlockOffset[blk]));
+	} CADET_PARFOR_END;
+}
+
+/**
+ * @brief Performs the matrix-vector product @f$ z = J P^{-1} x @f$ of the right preconditioned system
+ * @details The product with the discretized Jacobian @f$ J @f$ of the pure DOFs uses the assembled
+ *          matrix _globalJacDisc. Inlet DOFs are excluded.
+ * @param [in] x Vector @f$ x @f$ of the pure DOFs
+ * @param [out] z Result of the matrix-vector product
+ * @return @c 0 if successful, any other value in case of failure
+ */
+int GeneralRateModelDG::preconditionedMatrixVector(double const* x, double* z)
+{
+	BENCH_SCOPE(_timerMatVec);
+
+	const int offset = _precondBlockOffset.front();
+	double* const px = _tempState + offset;
+
+	std::copy_n(x, numPureDofs(), px);
+	solveDiagonalBlocks(px);
+
+	int const* const rowStart = _globalJacDisc.outerIndexPtr();
+	int const* const colIdx = _globalJacDisc.innerIndexPtr();
+	double const* const values = _globalJacDisc.valuePtr();
+
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(std::size_t(0), _precondSolvers.size(), [&](std::size_t blk)
+#else
+	for (std::size_t blk = 0; blk < _precondSolvers.size(); ++blk)
+#endif
+	{
+		for (int row = _precondBlockOffset[blk]; row < _precondBlockOffset[blk + 1]; ++row)
+		{
+			double sum = 0.0;
+			for (int k = rowStart[row]; k < rowStart[row + 1]; ++k)
+			{
+				if (colIdx[k] >= offset)
+					sum += values[k] * px[colIdx[k] - offset];
+			}
+			z[row - offset] = sum;
+		}
+	} CADET_PARFOR_END;
+
+	return 0;
+}
+
 /**
  * @brief Assembles bulk Jacobian @f$ J_i @f$ (@f$ i > 0 @f$) of the time-discretized equations
  * @details The system \f[ \left( \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} \right) x = b \f]
@@ -181,7 +359,7 @@ int GeneralRateModelDG::linearSolve(double t, double alpha, double outerTol, dou
 void GeneralRateModelDG::assembleDiscretizedGlobalJacobian(double alpha, Indexer idxr) {
 
 	/* add static (per section) jacobian without inlet */
-	_globalJacDisc = _globalJac;
+	linalg::assignSparseValues(_globalJacDisc, _globalJac);
 
 	// Add time derivatives to particle shells
 	for (unsigned int parType = 0; parType < _disc.nParType; parType++) {
@@ -26,6 +26,7 @@
 #include "SimulationTypes.hpp"
 #include "linalg/Norms.hpp"
 #include "linalg/Subset.hpp"
+#include "linalg/CompressedSparseMatrix.hpp"
 
 #include "AdUtils.hpp"
 #include "SensParamUtil.hpp"
@@ -53,9 +54,15 @@ constexpr double SurfVolRatioSphere = 3.0;
 constexpr double SurfVolRatioCylinder = 2.0;
 constexpr double SurfVolRatioSlab = 1.0;
 
+int preconditionedMultiplierGRMDG(void* userData, double const* x, double* z)
+{
+	GeneralRateModelDG* const grm = static_cast<GeneralRateModelDG*>(userData);
+	return grm->preconditionedMatrixVector(x, z);
+}
+
 
 GeneralRateModelDG::GeneralRateModelDG(UnitOpIdx unitOpIdx) : UnitOperationBase(unitOpIdx),
-	_hasSurfaceDiffusion(0, false), _dynReactionBulk(nullptr),
+	_hasSurfaceDiffusion(0, false), _dynReactionBulk(nullptr), _linearSolver(nullptr), _iterativeLinearSolver(false),
 	_globalJac(), _globalJacDisc(), _jacInlet(), _hasParDepSurfDiffusion(false),
 	_analyticJac(true), _jacobianAdDirs(0), _factorizeJacobian(false), _tempState(nullptr),
 	_initC(0), _initCp(0), _initQ(0), _initState(0), _initStateDot(0)
@@ -102,6 +109,9 @@ GeneralRateModelDG::~GeneralRateModelDG() CADET_NOEXCEPT
 	delete[] _disc.localFlux;
 
 	delete _linearSolver;
+
+	for (cadet::linalg::EigenSolverBase* ls : _precondSolvers)
+		delete ls;
 }
 
 unsigned int GeneralRateModelDG::numDofs() const CADET_NOEXCEPT
@@ -160,7 +170,11 @@ bool GeneralRateModelDG::configureModelDiscretization(IParameterProvider& paramP
 
 	paramProvider.pushScope("discretization");
 
-	_linearSolver = cadet::linalg::setLinearSolver(paramProvider.exists("LINEAR_SOLVER") ? paramProvider.getString("LINEAR_SOLVER") : "SparseLU");
+	// GMRES solves the full linear system iteratively and uses the direct solvers only for the diagonal blocks (preconditioner)
+	const std::string linSolverName = paramProvider.exists("LINEAR_SOLVER") ? paramProvider.getString("LINEAR_SOLVER") : "SparseLU";
+	_iterativeLinearSolver = (linSolverName == "GMRES");
+	if (!_iterativeLinearSolver)
+		_linearSolver = cadet::linalg::setLinearSolver(linSolverName);
 
 	if (!newNBoundInterface && paramProvider.exists("NBOUND")) // done here and in this order for backwards compatibility
 		nBound = paramProvider.getIntArray("NBOUND");
@@ -427,6 +441,38 @@ bool GeneralRateModelDG::configureModelDiscretization(IParameterProvider& paramP
 	// Create nonlinear solver for consistent initialization
 	configureNonlinearSolver(paramProvider);
 
+	if (_iterativeLinearSolver)
+	{
+		// Initialize and configure GMRES for solving the full linear system
+		const unsigned int maxKrylov = paramProvider.exists("MAX_KRYLOV") ? paramProvider.getInt("MAX_KRYLOV") : 30;
+		const unsigned int gsType = paramProvider.exists("GS_TYPE") ? paramProvider.getInt("GS_TYPE") : 1;
+		const unsigned int maxRestarts = paramProvider.exists("MAX_RESTARTS") ? paramProvider.getInt("MAX_RESTARTS") : 10;
+		_gmres.initialize(numPureDofs(), maxKrylov, linalg::toOrthogonalization(gsType), maxRestarts);
+		_gmres.matrixVectorMultiplier(&preconditionedMultiplierGRMDG, this);
+		_schurSafety = paramProvider.exists("SCHUR_SAFETY") ? paramProvider.getDouble("SCHUR_SAFETY") : 1e-8;
+
+		_gmresRhs.resize(numPureDofs());
+		_gmresWeight.resize(numPureDofs(), 1.0);
+
+		// The preconditioner consists of the bulk block and one block for each particle (column node and particle type),
+		// which are stored consecutively in the state vector
+		const std::string precondSolverName = paramProvider.exists("PRECONDITIONER_SOLVER") ? paramProvider.getString("PRECONDITIONER_SOLVER") : "SparseLU";
+		Indexer idxr(_disc);
+		const unsigned int nBlocks = 1 + _disc.nPoints * _disc.nParType;
+		_precondSolvers.reserve(nBlocks);
+		_precondBlockOffset.reserve(nBlocks + 1);
+		_precondBlockOffset.push_back(idxr.offsetC());
+		for (unsigned int type = 0; type < _disc.nParType; ++type)
+		{
+			for (unsigned int par = 0; par < _disc.nPoints; ++par)
+				_precondBlockOffset.push_back(idxr.offsetCp(ParticleTypeIndex{ type }, ParticleIndex{ par }));
+		}
+		_precondBlockOffset.push_back(numDofs());
+
+		for (unsigned int blk = 0; blk < nBlocks; ++blk)
+			_precondSolvers.push_back(cadet::linalg::setLinearSolver(precondSolverName));
+	}
+
 	paramProvider.popScope();
 
 	// ==== Construct and configure parameter dependencies
@@ -873,9 +919,11 @@ bool GeneralRateModelDG::configure(IParameterProvider& paramProvider)
 	// jaobian pattern set after binding and particle surface diffusion are configured
 	setJacobianPattern_GRM(_globalJac, 0, _dynReactionBulk);
 	_globalJacDisc = _globalJac;
+	// AD seed vectors are colored using the Jacobian pattern, which is only available now
+	useAnalyticJacobian(_analyticJac);
 	// the solver repetitively solves the linear system with a static pattern of the jacobian (set above). 
 	// The goal of analyzePattern() is to reorder the nonzero elements of the matrix, such that the factorization step creates less fill-in
-	_linearSolver->analyzePattern(_globalJacDisc.block(_disc.nComp, _disc.nComp, numPureDofs(), numPureDofs()));
+	analyzeDiscretizedJacobianPattern();
 
 	return transportSuccess && parSurfDiffDepConfSuccess && bindingConfSuccess && dynReactionConfSuccess;
 }
@@ -925,8 +973,12 @@ unsigned int GeneralRateModelDG::threadLocalMemorySize() const CADET_NOEXCEPT
 
 unsigned int GeneralRateModelDG::numAdDirsForJacobian() const CADET_NOEXCEPT
 {
-	// The global DG Jacobian is banded around the main diagonal and has additional (also banded) entries for film diffusion.
-	// To feasibly seed and reconstruct the Jacobian, we create dedicated active directions for the bulk and each particle type (see @ todo)
+	// Once the Jacobian pattern is known, the number of colors of its columns determines the required directions
+	if (!_jacColors.empty())
+		return *std::max_element(_jacColors.begin(), _jacColors.end()) + 1;
+
+	// Otherwise, use an upper bound: The global DG Jacobian is banded around the main diagonal and has additional (also banded) entries
+	// for film diffusion. Dedicated active directions for the bulk and each particle type are sufficient to seed the Jacobian.
 	Indexer idxr(_disc);
 	
 	int sumParBandwidth = 0;
@@ -938,19 +990,78 @@ unsigned int GeneralRateModelDG::numAdDirsForJacobian() const CADET_NOEXCEPT
 	return _convDispOp.requiredADdirs() + sumParBandwidth;
 }
 
+/**
+ * @brief Computes a coloring of the Jacobian columns for compressed AD seeding
+ * @details The pattern of the pure block of the global Jacobian is colored (Curtis-Powell-Reed), where each
+ *          particle block is treated as dense. This way, the coloring stays valid if the pattern within a
+ *          particle block changes (e.g., due to surface diffusion) and all particle entries can be extracted.
+ */
+void GeneralRateModelDG::computeJacobianColoring()
+{
+	Indexer idxr(_disc);
+	const int offset = idxr.offsetC();
+	const int numPureDofs = numDofs() - offset;
+
+	linalg::SparsityPattern pattern(numPureDofs, _globalJac.nonZeros() / std::max(numPureDofs, 1) + 1);
+	for (int row = 0; row < numPureDofs; ++row)
+	{
+		for (Eigen::SparseMatrix<double, RowMajor>::InnerIterator it(_globalJac, offset + row); it; ++it)
+		{
+			if (it.col() >= offset)
+				pattern.add(row, it.col() - offset);
+		}
+	}
+
+	for (unsigned int type = 0; type < _disc.nParType; ++type)
+	{
+		for (unsigned int par = 0; par < _disc.nPoints; ++par)
+		{
+			const int parOffset = idxr.offsetCp(ParticleTypeIndex{ type }, ParticleIndex{ par }) - offset;
+			for (int row = 0; row < static_cast<int>(idxr.strideParBlock(type)); ++row)
+			{
+				for (int col = 0; col < static_cast<int>(idxr.strideParBlock(type)); ++col)
+					pattern.add(parOffset + row, parOffset + col);
+			}
+		}
+	}
+
+	const int numColors = ad::computeColumnColoring(pattern, _jacColors);
+	LOG(Debug) << "Jacobian coloring requires " << numColors << " AD directions (" << numPureDofs << " columns)";
+}
+
 void GeneralRateModelDG::useAnalyticJacobian(const bool analyticJac)
 {
+	const bool prevAnalyticJac = _analyticJac;
+
 #ifndef CADET_CHECK_ANALYTIC_JACOBIAN
 	_analyticJac = analyticJac;
-	if (!_analyticJac)
-		_jacobianAdDirs = numAdDirsForJacobian();
-	else
-		_jacobianAdDirs = 0;
 #else
 	// If CADET_CHECK_ANALYTIC_JACOBIAN is active, we always enable AD for comparison and use it in simulation
 	_analyticJac = false;
-	_jacobianAdDirs = numAdDirsForJacobian();
 #endif
+
+	// The pattern depends on the Jacobian mode (dense particle blocks for AD), reset it if the mode changes after configuration
+	if ((prevAnalyticJac != _analyticJac) && (_globalJac.nonZeros() > 0))
+	{
+		setJacobianPattern_GRM(_globalJac, 0, _dynReactionBulk);
+		_globalJacDisc = _globalJac;
+		analyzeDiscretizedJacobianPattern();
+	}
+
+	if (_analyticJac)
+	{
+		_jacColors.clear();
+		_jacobianAdDirs = 0;
+		return;
+	}
+
+	// The Jacobian pattern is set in configure(), before that only an upper bound of the AD directions is known
+	if (_globalJac.nonZeros() > 0)
+		computeJacobianColoring();
+	else
+		_jacColors.clear();
+
+	_jacobianAdDirs = numAdDirsForJacobian();
 }
 
 void GeneralRateModelDG::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
@@ -1007,93 +1118,28 @@ void GeneralRateModelDG::prepareADvectors(const AdJacobianParams& adJac) const
 	if (!adJac.adY)
 		return;
 
-	Indexer idxr(_disc);
-
 	// The global DG Jacobian is banded around the main diagonal and has additional (also banded, but offset) entries for film diffusion,
 	// i.e. banded AD vector seeding is not sufficient (as it is for the FV Jacobians, see @puttmann2016 and the DG LRM Jacobian).
-	// The compressed vectorial AD seeding and Jacobian construction is described in the following.
-	// The global DG Jacobian is banded around the main diagonal and has additional (also banded) entries for film diffusion.
-	// To feasibly seed and reconstruct the Jacobian (we need information for decompression), we create dedicated active directions for
-	// the bulk and each particle type. Particle AD directions are treated as dense (per particle block) since only nCells > 6 would
-	// justify band compression, which rarely ever happens.
-
-	// We begin by seeding the (banded around main diagonal) bulk Jacobian block
-	// We have differing Jacobian structures for exact integration and collocation DG scheme, i.e. we need different seed vectors
-	// collocation DG: 2 * N_n * (N_c + N_q) + 1 = total bandwidth (main diagonal entries maximally depend on the next and last N_n liquid phase entries of same component)
-	//    ex. int. DG: 4 * N_n * (N_c + N_q) + 1 = total bandwidth (main diagonal entries maximally depend on the next and last 2*N_n liquid phase entries of same component)
-	const int lowerBandwidth = (_disc.exactInt) ? 2 * _disc.nNodes * idxr.strideColNode() : _disc.nNodes * idxr.strideColNode();
-	const int upperBandwidth = lowerBandwidth;
-	const int bulkRows = idxr.offsetCp() - idxr.offsetC();
-	ad::prepareAdVectorSeedsForBandMatrix(adJac.adY + _disc.nComp, adJac.adDirOffset, bulkRows, lowerBandwidth, upperBandwidth, lowerBandwidth);
-
-	// We now seed the particle Jacobian blocks using the individual AD directions for each particle type.
-	unsigned int adDirOffset = adJac.adDirOffset + _convDispOp.requiredADdirs();
-
-	for (unsigned int type = 0; type < _disc.nParType; type++)
-	{
-		for (unsigned int parBlock = 0; parBlock < _disc.nPoints; parBlock++)
-		{
-			// move adVec pointer to start of current particle block 
-			active* _adVec = adJac.adY + idxr.offsetCp(ParticleTypeIndex{ type }, ParticleIndex{ parBlock });
-
-			for (int eq = 0; eq < idxr.strideParBlock(type); ++eq)
-			{
-				// Clear previously set directions
-				_adVec[eq].fillADValue(adJac.adDirOffset, 0.0);
-				// Set direction
-				_adVec[eq].setADValue(adDirOffset + eq, 1.0);
-
-			}
-		}
-		if (type < _disc.nParType - 1u) // move to dedicated DoFs of next particle type
-			adDirOffset += idxr.strideParBlock(type);
-	}
+	// Instead, the columns of the Jacobian pattern are colored such that columns sharing a row have different colors (Curtis-Powell-Reed).
+	// Each color is seeded by one AD direction, which yields the full Jacobian including the film diffusion entries.
+	// The particle blocks are treated as dense when coloring, see computeJacobianColoring().
+	Indexer idxr(_disc);
+	ad::prepareAdVectorSeedsForColoring(adJac.adY + idxr.offsetC(), adJac.adDirOffset, _jacColors.size(), _jacColors.data());
 }
+
 /**
- * @brief Extracts the system Jacobian from band compressed AD seed vectors
- * @param [in] adRes Residual vector of AD datatypes with band compressed seed vectors
+ * @brief Extracts the system Jacobian from column colored AD seed vectors
+ * @param [in] adRes Residual vector of AD datatypes with column colored seed vectors
  * @param [in] adDirOffset Number of AD directions used for non-Jacobian purposes (e.g., parameter sensitivities)
  */
 void GeneralRateModelDG::extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset)
 {
 	Indexer idxr(_disc);
+	const int offset = idxr.offsetC();
 
-	const active* const adVec = adRes + idxr.offsetC();
-
-	/* Extract bulk phase equations entries */
-	const int lowerBandwidth = (_disc.exactInt) ? 2 * _disc.nNodes * idxr.strideColNode() : _disc.nNodes * idxr.strideColNode();
-	const int upperBandwidth = lowerBandwidth;
-	const int stride = lowerBandwidth + 1 + upperBandwidth;
-	int diagDir = lowerBandwidth;
-	const int bulkDoFs = idxr.offsetCp() - idxr.offsetC();
-	const int eqOffset = 0;
-	const int matOffset = idxr.offsetC();
-	ad::extractBandedBlockEigenJacobianFromAd(adVec, adDirOffset, diagDir, lowerBandwidth, upperBandwidth, eqOffset, bulkDoFs, _globalJac, matOffset);
-
-	/* Handle particle liquid and solid phase equations entries */
-	// Read particle Jacobian entries from dedicated AD directions
-	int offsetParticleTypeDirs = adDirOffset + _convDispOp.requiredADdirs();
-
-	for (unsigned int type = 0; type < _disc.nParType; type++)
-	{
-		for (unsigned int par = 0; par < _disc.nPoints; par++)
-		{
-			const int eqOffset_res = idxr.offsetCp(ParticleTypeIndex{ type }, ParticleIndex{ par });
-			const int eqOffset_mat = idxr.offsetCp(ParticleTypeIndex{ type }, ParticleIndex{ par });
-			for (unsigned int phase = 0; phase < idxr.strideParBlock(type); phase++)
-			{
-				for (unsigned int phaseTo = 0; phaseTo < idxr.strideParBlock(type); phaseTo++)
-				{
-					_globalJac.coeffRef(eqOffset_mat + phase, eqOffset_mat + phaseTo) = adRes[eqOffset_res + phase].getADValue(offsetParticleTypeDirs + phaseTo);
-				}
-			}
-		}
-		offsetParticleTypeDirs += idxr.strideParBlock(type);
-	}
-
-	/* Add analytically derived flux entries (only those that are part of the outlier bands) */
-	// todo extract these entries instead of analytical calculation?
-	calcFluxJacobians(_disc.curSection, true);
+	// Extract all entries of the pattern, including film diffusion entries. For AD Jacobians, the pattern
+	// contains the dense particle blocks (see setJacobianPattern_GRM()), so no entries are inserted here.
+	ad::extractColoredEigenJacobianFromAd(adRes + offset, adDirOffset, _jacColors.data(), offset, numDofs() - offset, _globalJac);
 }
 
 #ifdef CADET_CHECK_ANALYTIC_JACOBIAN
@@ -26,6 +26,7 @@
 #include "AutoDiff.hpp"
 #include "linalg/BandedEigenSparseRowIterator.hpp"
 #include "linalg/EigenSolverWrapper.hpp"
+#include "linalg/Gmres.hpp"
 #include "Memory.hpp"
 #include "model/ModelUtils.hpp"
 #include "ParameterMultiplexing.hpp"
@@ -238,6 +239,13 @@ protected:
 
 	void assembleDiscretizedGlobalJacobian(double alpha, Indexer idxr);
 
+	void analyzeDiscretizedJacobianPattern();
+	bool factorizeDiscretizedJacobian();
+	bool solveDiscretizedJacobian(double* const rhs, double const* const weight, double tolerance);
+	bool solveDiscretizedJacobian(double* const rhs);
+	void solveDiagonalBlocks(double* const x);
+	int preconditionedMatrixVector(double const* x, double* z);
+
 	void setEquidistantRadialDisc(unsigned int parType);
 	void setEquivolumeRadialDisc(unsigned int parType);
 	void setUserdefinedRadialDisc(unsigned int parType);
@@ -246,6 +254,7 @@ protected:
 	void addTimeDerivativeToJacobianParticleShell(linalg::BandedEigenSparseRowIterator& jac, const Indexer& idxr, double alpha, unsigned int parType);
 
 	unsigned int numAdDirsForJacobian() const CADET_NOEXCEPT;
+	void computeJacobianColoring();
 
 	int multiplexInitialConditions(const cadet::ParameterId& pId, unsigned int adDirection, double adValue);
 	int multiplexInitialConditions(const cadet::ParameterId& pId, double val, bool checkSens);
@@ -552,6 +561,14 @@ protected:
 
 	cadet::linalg::EigenSolverBase* _linearSolver; //!< Linear solver
 
+	bool _iterativeLinearSolver; //!< Determines whether the linear system is solved by preconditioned GMRES instead of _linearSolver
+	std::vector<cadet::linalg::EigenSolverBase*> _precondSolvers; //!< Solvers for the diagonal blocks (bulk block, particle blocks) of the block-Jacobi preconditioner
+	std::vector<int> _precondBlockOffset; //!< Offsets of the diagonal blocks of the preconditioner in the state vector (last entry is numDofs())
+	linalg::Gmres _gmres; //!< GMRES algorithm for the iterative solution of the linear system in linearSolve()
+	double _schurSafety; //!< Safety factor for the tolerance of the GMRES algorithm
+	std::vector<double> _gmresRhs; //!< Right hand side of the preconditioned linear system
+	std::vector<double> _gmresWeight; //!< Unit error weights used for linear systems without weights
+
 	Eigen::SparseMatrix<double, RowMajor> _globalJac; //!< static part of global Jacobian
 	Eigen::SparseMatrix<double, RowMajor> _globalJacDisc; //!< global Jacobian with time derivative from BDF method
 	//MatrixXd FDJac; // test purpose FD Jacobian
@@ -586,6 +603,7 @@ protected:
 	bool _axiallyConstantParTypeVolFrac; //!< Determines whether particle type volume fraction is homogeneous across axial coordinate
 	bool _analyticJac; //!< Determines whether AD or analytic Jacobians are used
 	unsigned int _jacobianAdDirs; //!< Number of AD seed vectors required for Jacobian computation
+	std::vector<int> _jacColors; //!< AD direction (column color) of each pure DOF used for compressed Jacobian seeding, empty if not computed
 
 	std::vector<active> _parCellSize; //!< Particle shell size
 	std::vector<active> _parCenterRadius; //!< Particle node-centered position for each particle node
@@ -614,6 +632,9 @@ protected:
 	BENCH_TIMER(_timerMatVec)
 	BENCH_TIMER(_timerGmres)
 
+	// Wrapper for calling the corresponding function in GeneralRateModelDG class
+	friend int preconditionedMultiplierGRMDG(void* userData, double const* x, double* z);
+
 	class Indexer
 	{
 	public:
@@ -2364,7 +2385,14 @@ protected:
 
 		int fluxEntries = 4 * _disc.nParType * _disc.nPoints * _disc.nComp;
 
-		tripletList.reserve(fluxEntries + bulkEntries + particleEntries);
+		// AD Jacobians treat the particle blocks as dense (see computeJacobianColoring())
+		int denseParticleEntries = 0;
+		if (!_analyticJac) {
+			for (int type = 0; type < _disc.nParType; type++)
+				denseParticleEntries += _disc.nPoints * idxr.strideParBlock(type) * idxr.strideParBlock(type);
+		}
+
+		tripletList.reserve(fluxEntries + bulkEntries + particleEntries + denseParticleEntries);
 
 		// NOTE: inlet and jacF flux jacobian are set in calc jacobian function (identity matrices)
 		// Note: flux jacobian (identity matrix) is handled in calc jacobian function
@@ -2391,6 +2419,19 @@ protected:
 			}
 		}
 
+		// dense particle blocks for AD Jacobians, so that all extracted entries are part of the pattern (duplicates are summed up)
+		if (!_analyticJac) {
+			for (unsigned int type = 0; type < _disc.nParType; type++) {
+				for (unsigned int colNode = 0; colNode < _disc.nPoints; colNode++) {
+					const int parOffset = idxr.offsetCp(ParticleTypeIndex{ type }, ParticleIndex{ colNode });
+					for (int row = 0; row < idxr.strideParBlock(type); row++) {
+						for (int col = 0; col < idxr.strideParBlock(type); col++)
+							tripletList.push_back(T(parOffset + row, parOffset + col, 0.0));
+					}
+				}
+			}
+		}
+
 		// flux jacobians
 		for (unsigned int type = 0; type < _disc.nParType; type++) {
 			for (unsigned int colNode = 0; colNode < _disc.nPoints; colNode++) {
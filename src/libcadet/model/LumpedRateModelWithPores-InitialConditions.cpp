@@ -19,6 +19,7 @@
 #include "model/parts/BindingCellKernel.hpp"
 #include "SimulationTypes.hpp"
 #include "SensParamUtil.hpp"
+#include "model/ConsistentInitBatching.hpp"
 #include "linalg/Subset.hpp"
 
 #include <algorithm>
@@ -306,6 +307,7 @@ void LumpedRateModelWithPores<ConvDispOperator>::consistentInitialState(const Si
 	BENCH_SCOPE(_timerConsistentInit);
 
 	Indexer idxr(_disc);
+	ConsistentInitStatistics stats;
 
 	// Step 1: Solve algebraic equations
 
@@ -341,14 +343,22 @@ void LumpedRateModelWithPores<ConvDispOperator>::consistentInitialState(const Si
 		const linalg::ConstMaskArray mask{qsMask.data(), static_cast<int>(_disc.nComp + _disc.strideBound[type])};
 		const int probSize = linalg::numMaskActive(mask);
 
+		// Cells with identical state have the same solution unless parameters depend on time and position
+		const bool reuseSolution = !_binding[type]->dependsOnTime() && !(_dynReaction[type] && _dynReaction[type]->dependsOnTime());
+
+		// Group consecutive particles with identical state and only solve the first particle of each group
+		const std::vector<unsigned int> groupStart = groupIdenticalBlocks(vecStateY + idxr.offsetCp(ParticleTypeIndex{type}),
+			_disc.nCol, idxr.strideParBlock(type), idxr.strideParBlock(type), reuseSolution);
+
 		//Problem capturing variables here
 #ifdef CADET_PARALLELIZE
 		BENCH_SCOPE(_timerConsistentInitPar);
-		tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCol), [&](std::size_t pblk)
+		tbb::parallel_for(std::size_t(0), groupStart.size() - 1, [&](std::size_t grp)
 #else
-		for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+		for (std::size_t grp = 0; grp < groupStart.size() - 1; ++grp)
 #endif
 		{
+			const unsigned int pblk = groupStart[grp];
 			LinearBufferAllocator tlmAlloc = threadLocalMem.get();
 
 			// Reuse memory of band matrix for dense matrix
@@ -399,9 +409,22 @@ void LumpedRateModelWithPores<ConvDispOperator>::consistentInitialState(const Si
 
 			const ColumnPosition colPos{z, 0.0, static_cast<double>(_parRadius[type]) * 0.5};
 
+			// Copies the solution to the remaining particles of the group
+			const auto copyToGroup = [&]()
+			{
+				for (unsigned int i = pblk + 1; i < groupStart[grp + 1]; ++i)
+				{
+					std::copy_n(vecStateY + localOffsetToParticle, idxr.strideParBlock(type), vecStateY + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{i}));
+					stats.addReused();
+				}
+			};
+
 			// Determine whether nonlinear solver is required
 			if (!_binding[type]->preConsistentInitialState(simTime.t, simTime.secIdx, colPos, qShell, qShell - idxr.strideParLiquid(), tlmAlloc))
+			{
+				copyToGroup();
 				CADET_PAR_CONTINUE;
+			}
 
 			// Extract initial values from current state
 			linalg::selectVectorSubset(qShell - _disc.nComp, mask, solution);
@@ -415,6 +438,8 @@ void LumpedRateModelWithPores<ConvDispOperator>::consistentInitialState(const Si
 			{
 				jacFunc = [&](double const* const x, linalg::detail::DenseMatrixBase& mat)
 				{
+					stats.addJacobianEvaluation();
+
 					// Copy over state vector to AD state vector (without changing directional values to keep seed vectors)
 					// and initialize residuals with zero (also resetting directional values)
 					ad::copyToAd(qShell - _disc.nComp, localAdY, mask.len);
@@ -491,6 +516,8 @@ void LumpedRateModelWithPores<ConvDispOperator>::consistentInitialState(const Si
 			{
 				jacFunc = [&](double const* const x, linalg::detail::DenseMatrixBase& mat)
 				{
+					stats.addJacobianEvaluation();
+
 					// Prepare input vector by overwriting masked items
 					std::copy_n(qShell - _disc.nComp, mask.len, fullX);
 					linalg::applyVectorSubset(x, mask, fullX);
@@ -537,9 +564,13 @@ void LumpedRateModelWithPores<ConvDispOperator>::consistentInitialState(const Si
 			}
 
 			// Apply nonlinear solver
-			_nonlinearSolver->solve(
+			// In contrast to the GRM, which restarts a failed shell from the solution of a neighboring shell of the same particle,
+			// there is no warm start here: neighboring particles are solved in different (parallel) tasks in nondeterministic order
+			const bool converged = _nonlinearSolver->solve(
 				[&](double const* const x, double* const r)
 				{
+					stats.addResidualEvaluation();
+
 					// Prepare input vector by overwriting masked items
 					std::copy_n(qShell - _disc.nComp, mask.len, fullX);
 					linalg::applyVectorSubset(x, mask, fullX);
@@ -583,12 +614,16 @@ void LumpedRateModelWithPores<ConvDispOperator>::consistentInitialState(const Si
 				},
 				jacFunc, errorTol, solution, nonlinMem, jacobianMatrix, probSize);
 
+			stats.addSolve(false, converged);
+
 			// Apply solution
 			linalg::applyVectorSubset(solution, mask, qShell - idxr.strideParLiquid());
 
 			// Refine / correct solution
 			_binding[type]->postConsistentInitialState(simTime.t, simTime.secIdx, colPos, qShell, qShell - idxr.strideParLiquid(), tlmAlloc);
 
+			copyToGroup();
+
 		} CADET_PARFOR_END;
 	}
 
@@ -599,6 +634,8 @@ void LumpedRateModelWithPores<ConvDispOperator>::consistentInitialState(const Si
 	std::fill(jf, jf + _disc.nComp * _disc.nCol * _disc.nParType, 0.0);
 
 	solveForFluxes(vecStateY, idxr);
+
+	stats.report(_unitOpIdx, simTime);
 }
 
 /**
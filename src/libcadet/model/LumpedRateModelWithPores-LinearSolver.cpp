@@ -23,6 +23,7 @@
 #include "Logging.hpp"
 
 #include "ParallelSupport.hpp"
+#include "Profiler.hpp"
 
 #ifdef CADET_PARALLELIZE
 	#include <tbb/parallel_for.h>
@@ -131,6 +132,8 @@ int LumpedRateModelWithPores<ConvDispOperator>::linearSolve(double t, double alp
 		node_t A(g, [&](msg_t)
 #endif
 		{
+			CADET_PROFILE_SCOPE_UNIT("factorize bulk", _unitOpIdx);
+
 			// Assemble and factorize discretized bulk Jacobian
 			const bool result = _convDispOp.assembleAndFactorizeDiscretizedJacobian(alpha);
 			if (cadet_unlikely(!result))
@@ -144,6 +147,8 @@ int LumpedRateModelWithPores<ConvDispOperator>::linearSolve(double t, double alp
 		node_t B(g, [&](msg_t)
 #endif
 		{
+			CADET_PROFILE_SCOPE_UNIT("factorize particles", _unitOpIdx);
+
 #ifdef CADET_PARALLELIZE
 			tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nParType), [&](std::size_t type)
 #else
@@ -242,7 +247,10 @@ int LumpedRateModelWithPores<ConvDispOperator>::linearSolve(double t, double alp
 		const double tolerance = std::sqrt(static_cast<double>(numDofs())) * outerTol * _schurSafety;
 
 		BENCH_START(_timerGmres);
-		_gmres.solve(tolerance, weight + idxr.offsetJf(), _tempState + idxr.offsetJf(), rhs + idxr.offsetJf());
+		{
+			CADET_PROFILE_SCOPE_UNIT("unit gmres", _unitOpIdx);
+			_gmres.solve(tolerance, weight + idxr.offsetJf(), _tempState + idxr.offsetJf(), rhs + idxr.offsetJf());
+		}
 		BENCH_STOP(_timerGmres);
 
 		// Remove temporary results that are leftovers from schurComplementMatrixVector()
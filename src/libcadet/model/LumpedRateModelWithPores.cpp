@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <type_traits>
 
 #include "ParallelSupport.hpp"
 #ifdef CADET_PARALLELIZE
@@ -618,6 +619,18 @@ unsigned int LumpedRateModelWithPores<ConvDispOperator>::threadLocalMemorySize()
 	lms.add<double>((maxStrideBound + _disc.nComp) * (maxStrideBound + _disc.nComp));
 
 	lms.commit();
+
+	// Memory for batched binding flux evaluation in residualImpl()
+	for (unsigned int i = 0; i < _disc.nParType; ++i)
+	{
+		if (!_binding[i] || !_binding[i]->supportsFluxBatch())
+			continue;
+
+		lms.add<ColumnPosition>(_disc.nCol);
+		lms.addBlock(parts::cell::bindingFluxBatchMemorySize(*_binding[i], _disc.nComp, _disc.strideBound[i], _disc.nBound + i * _disc.nComp, _disc.nCol));
+		lms.commit();
+	}
+
 	const std::size_t resImplSize = lms.bufferSize();
 
 	// Memory for consistentInitialState()
@@ -675,6 +688,10 @@ void LumpedRateModelWithPores<ConvDispOperator>::useAnalyticJacobian(const bool
 template <typename ConvDispOperator>
 void LumpedRateModelWithPores<ConvDispOperator>::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
 {
+	// Particle radii may have changed since the last simulation
+	if (secIdx == 0)
+		setupBindingExternalFunctionGrid();
+
 	// Setup flux Jacobian blocks at the beginning of the simulation or in case of
 	// section dependent film or particle diffusion coefficients
 	if ((secIdx == 0) || isSectionDependent(_filmDiffusionMode))
@@ -709,6 +726,32 @@ void LumpedRateModelWithPores<ConvDispOperator>::notifyDiscontinuousSectionTrans
 	}
 }
 
+template <typename ConvDispOperator>
+void LumpedRateModelWithPores<ConvDispOperator>::setupBindingExternalFunctionGrid()
+{
+	if (!bindingDependsOnTime())
+	{
+		setBindingExternalFunctionGrid({}, {});
+		return;
+	}
+
+	// Particles of all column cells for each particle type
+	std::vector<ColumnPosition> grid;
+	std::vector<unsigned int> typeOffset(_disc.nParType + 1, 0);
+	grid.reserve(_disc.nCol * _disc.nParType);
+	for (unsigned int type = 0; type < _disc.nParType; ++type)
+	{
+		typeOffset[type] = grid.size();
+
+		const double radius = static_cast<double>(_parRadius[type]);
+		for (unsigned int col = 0; col < _disc.nCol; ++col)
+			grid.push_back(ColumnPosition{ _convDispOp.relativeCoordinate(col), 0.0, radius * 0.5 });
+	}
+	typeOffset[_disc.nParType] = grid.size();
+
+	setBindingExternalFunctionGrid(std::move(grid), std::move(typeOffset));
+}
+
 template <typename ConvDispOperator>
 void LumpedRateModelWithPores<ConvDispOperator>::setFlowRates(active const* in, active const* out) CADET_NOEXCEPT
 {
@@ -964,26 +1007,56 @@ int LumpedRateModelWithPores<ConvDispOperator>::residualImpl(double t, unsigned
 
 	BENCH_START(_timerResidualPar);
 
-#ifdef CADET_PARALLELIZE
-	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCol * _disc.nParType + 1), [&](std::size_t pblk)
-#else
-	for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nParType + 1; ++pblk)
-#endif
+	// Evaluate external functions of the binding models once for all column cells
+	updateBindingExternalFunctionCache(t, secIdx);
+
+	util::ErrorIndicator err;
+
+	// Block 0 is the bulk, block 1 + type * nCol + col is the particle of the given type in the given column cell
+	const auto residualBlocks = [&](std::size_t blkBegin, std::size_t blkEnd)
 	{
-		if (cadet_unlikely(pblk == 0))
-			residualBulk<StateType, ResidualType, ParamType, wantJac, wantRes>(t, secIdx, y, yDot, res, threadLocalMem);
-		else
+		// Evaluate binding fluxes of all column cells in the range at once if the binding model supports it
+		if constexpr (std::is_same_v<StateType, double> && std::is_same_v<ResidualType, double> && !wantJac && wantRes)
 		{
-			const unsigned int type = (pblk - 1) / _disc.nCol;
-			const unsigned int par = (pblk - 1) % _disc.nCol;
-			residualParticle<StateType, ResidualType, ParamType, wantJac, wantRes>(t, type, par, secIdx, y, yDot, res, threadLocalMem);
+			for (std::size_t pblk = std::max(blkBegin, std::size_t(1)); pblk < blkEnd; )
+			{
+				const unsigned int type = (pblk - 1) / _disc.nCol;
+				const unsigned int colBegin = (pblk - 1) % _disc.nCol;
+				const unsigned int colEnd = std::min(static_cast<std::size_t>(_disc.nCol), blkEnd - 1 - type * _disc.nCol);
+
+				if (_binding[type]->supportsFluxBatch())
+					err.update(residualBindingBatch(t, type, secIdx, colBegin, colEnd - colBegin, y, res, threadLocalMem));
+
+				pblk += colEnd - colBegin;
+			}
 		}
-	} CADET_PARFOR_END;
+
+		for (std::size_t pblk = blkBegin; pblk < blkEnd; ++pblk)
+		{
+			if (cadet_unlikely(pblk == 0))
+				err.update(residualBulk<StateType, ResidualType, ParamType, wantJac, wantRes>(t, secIdx, y, yDot, res, threadLocalMem));
+			else
+			{
+				const unsigned int type = (pblk - 1) / _disc.nCol;
+				const unsigned int par = (pblk - 1) % _disc.nCol;
+				err.update(residualParticle<StateType, ResidualType, ParamType, wantJac, wantRes>(t, type, par, secIdx, y, yDot, res, threadLocalMem));
+			}
+		}
+	};
+
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(tbb::blocked_range<std::size_t>(0, _disc.nCol * _disc.nParType + 1), [&](const tbb::blocked_range<std::size_t>& r)
+	{
+		residualBlocks(r.begin(), r.end());
+	});
+#else
+	residualBlocks(0, _disc.nCol * _disc.nParType + 1);
+#endif
 
 	BENCH_STOP(_timerResidualPar);
 
 	if (!wantRes)
-		return 0;
+		return err.code();
 
 	residualFlux<StateType, ResidualType, ParamType>(t, secIdx, y, yDot, res);
 
@@ -993,7 +1066,7 @@ int LumpedRateModelWithPores<ConvDispOperator>::residualImpl(double t, unsigned
 		res[i] = y[i];
 	}
 
-	return 0;
+	return err.code();
 }
 
 template <typename ConvDispOperator>
@@ -1046,6 +1119,7 @@ int LumpedRateModelWithPores<ConvDispOperator>::residualParticle(double t, unsig
 
 	// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
 	const double z = _convDispOp.relativeCoordinate(colCell);
+	const ColumnPosition colPos{ z, 0.0, static_cast<double>(radius) * 0.5, bindingExternalFunctionCacheIdx(parType, colCell) };
 
 	const parts::cell::CellParameters cellResParams
 		{
@@ -1060,21 +1134,60 @@ int LumpedRateModelWithPores<ConvDispOperator>::residualParticle(double t, unsig
 			(_dynReaction[parType] && (_dynReaction[parType]->numReactionsCombined() > 0)) ? _dynReaction[parType] : nullptr
 		};
 
+	// Binding fluxes have already been computed if the binding model supports batch evaluation (see residualImpl())
+	bool bindingDone = false;
+	if constexpr (std::is_same_v<StateType, double> && std::is_same_v<ResidualType, double> && !wantJac && wantRes)
+		bindingDone = _binding[parType]->supportsFluxBatch();
+
 	// Handle time derivatives, binding, dynamic reactions
-	if (wantRes)
+	if (wantRes && bindingDone)
+		parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, true, true, false>(
+			t, secIdx, colPos, y, yDot, res,
+			_jacP[parType].row(colCell * idxr.strideParBlock(parType)), cellResParams, threadLocalMem.get()
+		);
+	else if (wantRes)
 		parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, true>(
-			t, secIdx, ColumnPosition{ z, 0.0, static_cast<double>(radius) * 0.5 }, y, yDot, res,
+			t, secIdx, colPos, y, yDot, res,
 			_jacP[parType].row(colCell * idxr.strideParBlock(parType)), cellResParams, threadLocalMem.get()
 		);
 	else
 		parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, false, false>(
-			t, secIdx, ColumnPosition{ z, 0.0, static_cast<double>(radius) * 0.5 }, y, yDot, res,
+			t, secIdx, colPos, y, yDot, res,
 			_jacP[parType].row(colCell * idxr.strideParBlock(parType)), cellResParams, threadLocalMem.get()
 		);
 
 	return 0;
 }
 
+template <typename ConvDispOperator>
+int LumpedRateModelWithPores<ConvDispOperator>::residualBindingBatch(double t, unsigned int parType, unsigned int secIdx, unsigned int colBegin, unsigned int nCells,
+	double const* yBase, double* resBase, util::ThreadLocalStorage& threadLocalMem)
+{
+	Indexer idxr(_disc);
+
+	const double radius = static_cast<double>(_parRadius[parType]);
+	const parts::cell::CellParameters cellResParams
+		{
+			_disc.nComp,
+			_disc.nBound + _disc.nComp * parType,
+			_disc.boundOffset + _disc.nComp * parType,
+			_disc.strideBound[parType],
+			_binding[parType]->reactionQuasiStationarity(),
+			_parPorosity[parType],
+			_poreAccessFactor.data() + _disc.nComp * parType,
+			_binding[parType],
+			nullptr
+		};
+
+	LinearBufferAllocator batchAlloc = threadLocalMem.get();
+	BufferedArray<ColumnPosition> colPos = batchAlloc.array<ColumnPosition>(nCells);
+	for (unsigned int i = 0; i < nCells; ++i)
+		colPos[i] = ColumnPosition{ _convDispOp.relativeCoordinate(colBegin + i), 0.0, radius * 0.5, bindingExternalFunctionCacheIdx(parType, colBegin + i) };
+
+	return parts::cell::bindingFluxBatch(t, secIdx, static_cast<ColumnPosition*>(colPos), nCells, idxr.strideParBlock(parType),
+		yBase + idxr.offsetCp(ParticleTypeIndex{parType}, ParticleIndex{colBegin}), resBase + idxr.offsetCp(ParticleTypeIndex{parType}, ParticleIndex{colBegin}), cellResParams, batchAlloc);
+}
+
 template <typename ConvDispOperator>
 template <typename StateType, typename ResidualType, typename ParamType>
 int LumpedRateModelWithPores<ConvDispOperator>::residualFlux(double t, unsigned int secIdx, StateType const* yBase, double const* yDotBase, ResidualType* resBase)
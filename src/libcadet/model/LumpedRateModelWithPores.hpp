@@ -227,10 +227,13 @@ protected:
 	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac, bool wantRes = true>
 	int residualParticle(double t, unsigned int parType, unsigned int colCell, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res, util::ThreadLocalStorage& threadLocalMem);
 
+	int residualBindingBatch(double t, unsigned int parType, unsigned int secIdx, unsigned int colBegin, unsigned int nCells, double const* yBase, double* resBase, util::ThreadLocalStorage& threadLocalMem);
+
 	template <typename StateType, typename ResidualType, typename ParamType>
 	int residualFlux(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res);
 
 	void assembleOffdiagJac(double t, unsigned int secIdx);
+	void setupBindingExternalFunctionGrid();
 	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
 
 	int schurComplementMatrixVector(double const* x, double* z) const;
@@ -739,7 +739,7 @@ namespace cadet
 				LOG(Error) << "Factorize() failed";
 			}
 			// Solve
-			yDot.segment(idxr.offsetC(), numPureDofs()) = _linearSolver->solve(yDot.segment(idxr.offsetC(), numPureDofs()));
+			_linearSolver->solve(yDot.segment(idxr.offsetC(), numPureDofs()));
 
 			if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
 			{
@@ -881,15 +881,15 @@ namespace cadet
 			}
 
 			const int bulkRows = idxr.offsetCp() - idxr.offsetC();
-			_linearSolver->analyzePattern(_globalJacDisc.block(0, 0, bulkRows, bulkRows));
-			_linearSolver->factorize(_globalJacDisc.block(0, 0, bulkRows, bulkRows));
+			_linearSolver->analyzePattern(_globalJacDisc, 0, bulkRows);
+			_linearSolver->factorize(_globalJacDisc);
 
 			if (_linearSolver->info() != Success) {
 				LOG(Error) << "factorization failed in sensitivity initialization";
 			}
 
 			Eigen::Map<Eigen::VectorXd> ret_vec(rhs, bulkRows);
-			ret_vec = _linearSolver->solve(ret_vec);
+			_linearSolver->solve(ret_vec);
 
 			// Use the factors to solve the linear system 
 			if (_linearSolver->info() != Success) {
@@ -1140,7 +1140,7 @@ namespace cadet
 					LOG(Error) << "Factorize() failed";
 				}
 				// Solve
-				yDot.segment(0, numPureDofs()) = _linearSolver->solve(yDot.segment(0, numPureDofs()));
+				_linearSolver->solve(yDot.segment(0, numPureDofs()));
 
 				if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
 				{
@@ -139,7 +139,7 @@ int LumpedRateModelWithPoresDG::linearSolve(double t, double alpha, double outer
 	// ==== Step 2: Solve system of pure DOFs
 	// The result is stored in rhs (in-place solution)
 
-	r.segment(idxr.offsetC(), numPureDofs()) = _linearSolver->solve(r.segment(idxr.offsetC(), numPureDofs()));
+	_linearSolver->solve(r.segment(idxr.offsetC(), numPureDofs()));
 
 	if (cadet_unlikely(_linearSolver->info() != Eigen::Success))
 	{
@@ -168,20 +168,25 @@ int LumpedRateModelWithPoresDG::linearSolve(double t, double alpha, double outer
 void LumpedRateModelWithPoresDG::assembleDiscretizedGlobalJacobian(double alpha, Indexer idxr) {
 
 	// set to static (per section) jacobian
-	_globalJacDisc = _globalJac;
+	linalg::assignSparseValues(_globalJacDisc, _globalJac);
 
 	// add time derivative to bulk jacobian
 	_convDispOp.addTimeDerivativeToJacobian(alpha, _globalJacDisc);
 
-	// Add time derivatives to particle shells
-	for (unsigned int parType = 0; parType < _disc.nParType; parType++) {
-		linalg::BandedEigenSparseRowIterator jac(_globalJacDisc, idxr.offsetCp(ParticleTypeIndex{ parType }) - idxr.offsetC());
-		for (unsigned int j = 0; j < _disc.nPoints; ++j)
-		{
-			// Mobile and solid phase (advances jac accordingly)
-			addTimeDerivativeToJacobianParticleBlock(jac, idxr, alpha, parType);
-		}
-	}
+	// Add time derivatives to particle shells, particle blocks write to disjoint rows
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nPoints * _disc.nParType), [&](std::size_t pblk)
+#else
+	for (unsigned int pblk = 0; pblk < _disc.nPoints * _disc.nParType; ++pblk)
+#endif
+	{
+		const unsigned int parType = pblk / _disc.nPoints;
+		const unsigned int point = pblk % _disc.nPoints;
+		linalg::BandedEigenSparseRowIterator jac(_globalJacDisc, idxr.offsetCp(ParticleTypeIndex{ parType }, ParticleIndex{ point }) - idxr.offsetC());
+
+		// Mobile and solid phase
+		addTimeDerivativeToJacobianParticleBlock(jac, idxr, alpha, parType);
+	} CADET_PARFOR_END;
 }
 
 /**
@@ -35,6 +35,7 @@
 #include <functional>
 
 #include "ParallelSupport.hpp"
+#include "Profiler.hpp"
 #ifdef CADET_PARALLELIZE
 	#include <tbb/parallel_for.h>
 #endif
@@ -384,6 +385,10 @@ void LumpedRateModelWithoutPores<ConvDispOperator>::useAnalyticJacobian(const bo
 template <typename ConvDispOperator>
 void LumpedRateModelWithoutPores<ConvDispOperator>::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
 {
+	// External functions may have changed since the last simulation
+	if (secIdx == 0)
+		setupBindingExternalFunctionGrid();
+
 	Indexer idxr(_disc);
 
 	// ConvectionDispersionOperator tells us whether flow direction has changed
@@ -425,6 +430,23 @@ void LumpedRateModelWithoutPores<ConvDispOperator>::notifyDiscontinuousSectionTr
 	prepareADvectors(adJac);
 }
 
+template <typename ConvDispOperator>
+void LumpedRateModelWithoutPores<ConvDispOperator>::setupBindingExternalFunctionGrid()
+{
+	if (!bindingDependsOnTime())
+	{
+		setBindingExternalFunctionGrid({}, {});
+		return;
+	}
+
+	std::vector<ColumnPosition> grid;
+	grid.reserve(_disc.nCol);
+	for (unsigned int col = 0; col < _disc.nCol; ++col)
+		grid.push_back(ColumnPosition{ _convDispOp.relativeCoordinate(col), 0.0, 0.0 });
+
+	setBindingExternalFunctionGrid(std::move(grid), { 0, _disc.nCol });
+}
+
 template <typename ConvDispOperator>
 void LumpedRateModelWithoutPores<ConvDispOperator>::setFlowRates(active const* in, active const* out) CADET_NOEXCEPT
 {
@@ -649,6 +671,9 @@ int LumpedRateModelWithoutPores<ConvDispOperator>::residualImpl(double t, unsign
 	else
 		ConvOpJacobian<ConvDispOperator, StateType, ResidualType>::call(this, _convDispOp, t, secIdx, y, nullptr, nullptr, _jac);
 
+	// Evaluate external functions of the binding model once for all column cells
+	updateBindingExternalFunctionCache(t, secIdx);
+
 	Indexer idxr(_disc);
 
 #ifdef CADET_PARALLELIZE
@@ -676,14 +701,15 @@ int LumpedRateModelWithoutPores<ConvDispOperator>::residualImpl(double t, unsign
 
 		// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
 		const double z = _convDispOp.relativeCoordinate(col);
+		const ColumnPosition colPos{ z, 0.0, 0.0, bindingExternalFunctionCacheIdx(0, col) };
 
 		if (wantRes)
 			parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, false, true>(
-				t, secIdx, ColumnPosition{ z, 0.0, 0.0 }, localY, localYdot, localRes, _jac.row(col * idxr.strideColCell()), cellResParams, threadLocalMem.get()
+				t, secIdx, colPos, localY, localYdot, localRes, _jac.row(col * idxr.strideColCell()), cellResParams, threadLocalMem.get()
 			);
 		else
 			parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, false, false>(
-				t, secIdx, ColumnPosition{ z, 0.0, 0.0 }, localY, localYdot, localRes, _jac.row(col * idxr.strideColCell()), cellResParams, threadLocalMem.get()
+				t, secIdx, colPos, localY, localYdot, localRes, _jac.row(col * idxr.strideColCell()), cellResParams, threadLocalMem.get()
 			);
 
 	} CADET_PARFOR_END;
@@ -891,6 +917,8 @@ int LumpedRateModelWithoutPores<ConvDispOperator>::linearSolve(double t, double
 	// Factorize Jacobian only if required
 	if (_factorizeJacobian)
 	{
+		CADET_PROFILE_SCOPE_UNIT("factorize", _unitOpIdx);
+
 		// Assemble
 		assembleDiscretizedJacobian(alpha, idxr);
 
@@ -204,6 +204,7 @@ protected:
 	int residualImpl(double t, unsigned int secIdx, StateType const* const y, double const* const yDot, ResidualType* const res, util::ThreadLocalStorage& threadLocalMem);
 
 	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
+	void setupBindingExternalFunctionGrid();
 
 	void assembleDiscretizedJacobian(double alpha, const Indexer& idxr);
 	void addTimeDerivativeToJacobianCell(linalg::FactorizableBandMatrix::RowIterator& jac, const Indexer& idxr, double alpha, double invBetaP) const;
@@ -875,7 +875,7 @@ namespace cadet
 			}
 
 			// Use the factors to solve the linear system 
-			r.segment(idxr.offsetC(), numPureDofs()) = _linearSolver->solve(r.segment(idxr.offsetC(), numPureDofs()));
+			_linearSolver->solve(r.segment(idxr.offsetC(), numPureDofs()));
 
 			if (_linearSolver->info() != Success) {
 				LOG(Error) << "solve() failed";
@@ -914,18 +914,22 @@ namespace cadet
 		void LumpedRateModelWithoutPoresDG::assembleDiscretizedJacobian(double alpha, const Indexer& idxr)
 		{
 			// set to static jacobian entries
-			_jacDisc = _jac;
+			linalg::assignSparseValues(_jacDisc, _jac);
 
 			// add time derivative jacobian entries (dc_b / dt terms)
 			_convDispOp.addTimeDerivativeToJacobian(alpha, _jacDisc);
 
-			// add time derivative jacobian entries (dc_s / dt terms)
+			// add time derivative jacobian entries (dc_s / dt terms), nodes write to disjoint rows
 			const double invBeta = 1.0 / static_cast<double>(_totalPorosity) - 1.0;
-			linalg::BandedEigenSparseRowIterator jac(_jacDisc, 0);
+#ifdef CADET_PARALLELIZE
+			tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nPoints), [&](std::size_t j)
+#else
 			for (unsigned int j = 0; j < _disc.nPoints; ++j)
+#endif
 			{
+				linalg::BandedEigenSparseRowIterator jac(_jacDisc, j * idxr.strideColNode());
 				addTimeDerivativeToJacobianNode(jac, idxr, alpha, invBeta);
-			}
+			} CADET_PARFOR_END;
 		}
 		/**
 		 * @brief Adds Jacobian @f$ \frac{\partial F}{\partial \dot{y}} @f$ to cell of system Jacobian
@@ -1391,7 +1395,7 @@ namespace cadet
 
 			Eigen::Map<VectorXd> yp(vecStateYdot + idxr.offsetC(), numPureDofs());
 
-			yp = _linearSolver->solve(yp);
+			_linearSolver->solve(yp);
 
 			if (_linearSolver->info() != Success) {
 				LOG(Error) << "Solve failed in consistent initialization";
@@ -1689,7 +1693,7 @@ namespace cadet
 				}
 
 				Map<VectorXd> sensYdot_vec(sensYdot + idxr.offsetC(), numPureDofs());
-				sensYdot_vec = _linearSolver->solve(sensYdot_vec);
+				_linearSolver->solve(sensYdot_vec);
 
 				// Use the factors to solve the linear system 
 				if (_linearSolver->info() != Success) {
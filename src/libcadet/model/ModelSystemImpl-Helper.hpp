@@ -15,8 +15,40 @@
  * Defines helper functions used by all ModelSystemImpl-xyz.cpp files.
  */
 
+#include <vector>
+
+#ifdef CADET_PARALLELIZE
+	#include <tbb/parallel_for.h>
+	#include <tbb/blocked_range.h>
+	#include <tbb/partitioner.h>
+#endif
+
 namespace
 {
+	/**
+	 * @brief Calls a function for each unit operation in a schedule
+	 * @details If parallelization is enabled, each unit operation is run as a separate task. The
+	 *          schedule should list the most expensive unit operations first, such that they are
+	 *          started early and the work-stealing scheduler can fill idle threads with the small
+	 *          unit operations and the nested parallel loops inside the unit operations.
+	 * @param [in] schedule Indices of the unit operations in order of their execution
+	 * @param [in] f Function that is called with the index of a unit operation
+	 */
+	template <typename func_t>
+	inline void forEachUnitOperation(const std::vector<unsigned int>& schedule, const func_t& f)
+	{
+#ifdef CADET_PARALLELIZE
+		tbb::parallel_for(tbb::blocked_range<std::size_t>(0, schedule.size(), 1), [&](const tbb::blocked_range<std::size_t>& r)
+		{
+			for (std::size_t idx = r.begin(); idx != r.end(); ++idx)
+				f(schedule[idx]);
+		}, tbb::simple_partitioner());
+#else
+		for (unsigned int idx : schedule)
+			f(idx);
+#endif
+	}
+
 	/**
 	 * @brief Computes a total return code from a list of separate return codes
 	 * @details A negative return code indicates a non-recoverable error. Positive
@@ -20,6 +20,7 @@
 
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
+#include "Profiler.hpp"
 
 #include "ParallelSupport.hpp"
 #ifdef CADET_PARALLELIZE
@@ -52,7 +53,7 @@ namespace
 		static inline int residualWithJacobian(cadet::model::ModelSystem& ms, const cadet::SimulationTime& simTime, const cadet::ConstSimulationState& simState, double* const res, double* const temp,
 			const cadet::AdJacobianParams& adJac)
 		{
-			return ms.residualWithJacobian(simTime, simState, res, adJac);
+			return ms.residualWithUnitJacobians(simTime, simState, res, adJac);
 		}
 
 		static inline void parameterSensitivity(cadet::IUnitOperation* model, const cadet::SimulationTime& simTime, const cadet::ConstSimulationState& simState,
@@ -78,7 +79,7 @@ namespace
 		static inline int residualWithJacobian(cadet::model::ModelSystem& ms, const cadet::SimulationTime& simTime, const cadet::ConstSimulationState& simState, double* const res, double* const temp,
 			const cadet::AdJacobianParams& adJac)
 		{
-			return ms.residualWithJacobian(simTime, simState, temp, adJac);
+			return ms.residualWithUnitJacobians(simTime, simState, temp, adJac);
 		}
 
 		static inline void parameterSensitivity(cadet::IUnitOperation* model, const cadet::SimulationTime& simTime, const cadet::ConstSimulationState& simState,
@@ -173,7 +174,8 @@ void ModelSystem::readInitialCondition(IParameterProvider& paramProvider)
 
 void ModelSystem::initializeSensitivityStates(const std::vector<double*>& vecSensY) const
 {
-	std::vector<double*> vecSensYlocal(vecSensY.size(), nullptr);
+	// This should be a noop except for the first time
+	_sensYlocal.resize(vecSensY.size(), nullptr);
 	for (std::size_t i = 0; i < _models.size(); ++i)
 	{
 		IUnitOperation* const m = _models[i];
@@ -181,9 +183,9 @@ void ModelSystem::initializeSensitivityStates(const std::vector<double*>& vecSen
 
 		// Use correct offset in sensitivity state vectors
 		for (std::size_t j = 0; j < vecSensY.size(); ++j)
-			vecSensYlocal[j] = vecSensY[j] + offset;
+			_sensYlocal[j] = vecSensY[j] + offset;
 
-		m->initializeSensitivityStates(vecSensYlocal);
+		m->initializeSensitivityStates(_sensYlocal);
 	}
 }
 
@@ -459,6 +461,7 @@ void ModelSystem::consistentInitialConditionAlgorithm(const SimulationTime& simT
 	const AdJacobianParams& adJac, double errorTol)
 {
 	BENCH_SCOPE(_timerConsistentInit);
+	CADET_PROFILE_SCOPE("consistent init");
 
 	// Phase 1: Compute algebraic state variables
 
@@ -473,6 +476,7 @@ void ModelSystem::consistentInitialConditionAlgorithm(const SimulationTime& simT
 		const unsigned int offset = _dofOffset[i];
 		if (!m->hasInlet())
 		{
+			CADET_PROFILE_SCOPE_UNIT("unit consistent init", m->unitOperationId());
 			ConsistentInit<tag_t>::state(m, simTime, simState.vecStateY + offset, applyOffset(adJac, offset), errorTol, _threadLocalStorage);
 		}
 	} CADET_PARFOR_END;
@@ -499,6 +503,7 @@ void ModelSystem::consistentInitialConditionAlgorithm(const SimulationTime& simT
 		const unsigned int offset = _dofOffset[i];
 		if (m->hasInlet())
 		{
+			CADET_PROFILE_SCOPE_UNIT("unit consistent init", m->unitOperationId());
 			ConsistentInit<tag_t>::state(m, simTime, simState.vecStateY + offset, applyOffset(adJac, offset), errorTol, _threadLocalStorage);
 		}
 	} CADET_PARFOR_END;
@@ -523,6 +528,7 @@ void ModelSystem::consistentInitialConditionAlgorithm(const SimulationTime& simT
 	{
 		IUnitOperation* const m = _models[i];
 		const unsigned int offset = _dofOffset[i];
+		CADET_PROFILE_SCOPE_UNIT("unit consistent init time derivative", m->unitOperationId());
 		ConsistentInit<tag_t>::timeDerivative(m, simTime, simState.vecStateY + offset, simState.vecStateYdot + offset, _tempState + offset, _threadLocalStorage);
 	} CADET_PARFOR_END;
 
@@ -562,12 +568,16 @@ void ModelSystem::consistentInitialSensitivityAlgorithm(const SimulationTime& si
 	std::vector<double*>& vecSensYdot, active* const adRes, active* const adY)
 {
 	BENCH_SCOPE(_timerConsistentInit);
+	CADET_PROFILE_SCOPE("consistent init sensitivity");
 
 	// Compute parameter sensitivities and update the Jacobian
 	dResDpFwdWithJacobian(simTime, simState, AdJacobianParams{adRes, adY, static_cast<unsigned int>(vecSensY.size())});
 
-	std::vector<double*> vecSensYlocal(vecSensY.size(), nullptr);
-	std::vector<double*> vecSensYdotLocal(vecSensYdot.size(), nullptr);
+	// This should be a noop except for the first time
+	_sensYlocal.resize(vecSensY.size(), nullptr);
+	_sensYdotLocal.resize(vecSensYdot.size(), nullptr);
+	std::vector<double*>& vecSensYlocal = _sensYlocal;
+	std::vector<double*>& vecSensYdotLocal = _sensYdotLocal;
 	for (std::size_t i = 0; i < _models.size(); ++i)
 	{
 		IUnitOperation* const m = _models[i];
@@ -16,6 +16,10 @@
 
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
+#include "Profiler.hpp"
+
+#include <cmath>
+#include <limits>
 
 #include "ParallelSupport.hpp"
 #ifdef CADET_PARALLELIZE
@@ -33,6 +37,9 @@ namespace model
 int ModelSystem::linearSolve(double t, double alpha, double outerTol, double* const rhs, double const* const weight,
 	const ConstSimulationState& simState)
 {
+	if (_jacobianFree)
+		return linearSolveJacobianFree(t, alpha, outerTol, rhs, weight, simState);
+
 	if (_linearModelOrdering.sliceSize(_curSwitchIndex) == 0)
 	{
 		// Parallel
@@ -51,6 +58,7 @@ int ModelSystem::linearSolveSequential(double t, double alpha, double outerTol,
 	// TODO: Add early out error checks
 
 	BENCH_SCOPE(_timerLinearSolve);
+	CADET_PROFILE_SCOPE("linear solve");
 
 	// Topological sort needs to be iterated backwards (each item depends on all items behind it)
 	int const* order = _linearModelOrdering[_curSwitchIndex] + _models.size() - 1;
@@ -91,6 +99,7 @@ int ModelSystem::linearSolveSequential(double t, double alpha, double outerTol,
 		}
 
 		// Solve unit operation itself
+		CADET_PROFILE_SCOPE_UNIT("unit linear solve", m->unitOperationId());
 		_errorIndicator[idxUnit] = m->linearSolve(t, alpha, outerTol, rhs + offset, weight + offset, applyOffset(simState, offset));
 	}
 
@@ -103,19 +112,19 @@ int ModelSystem::linearSolveParallel(double t, double alpha, double outerTol, do
 	// TODO: Add early out error checks
 
 	BENCH_SCOPE(_timerLinearSolve);
+	CADET_PROFILE_SCOPE("linear solve");
 
 	const unsigned int finalOffset = _dofOffset[_models.size()];
 
-#ifdef CADET_PARALLELIZE
-	tbb::parallel_for(std::size_t(0), _models.size(), [=](std::size_t i)
-#else
-	for (std::size_t i = 0; i < _models.size(); ++i)
-#endif
+	forEachUnitOperation(_unitSchedule, [&](unsigned int i)
 	{
+		BENCH_SCOPE_IDX(_timerUnitLinearSolve, i);
+		CADET_PROFILE_SCOPE_UNIT("unit linear solve", _models[i]->unitOperationId());
+
 		IUnitOperation* const m = _models[i];
 		const unsigned int offset = _dofOffset[i];
 		_errorIndicator[i] = m->linearSolve(t, alpha, outerTol, rhs + offset, weight + offset, applyOffset(simState, offset));
-	} CADET_PARFOR_END;
+	});
 
 	// Solve last row of L with backwards substitution: y_f = b_f - \sum_{i=0}^{N_z} J_{f,i} y_i
 	// Note that we cannot easily parallelize this loop since the results of the sparse
@@ -158,7 +167,11 @@ int ModelSystem::linearSolveParallel(double t, double alpha, double outerTol, do
 	const int curError = totalErrorIndicatorFromLocal(_errorIndicator);
 	std::fill(_errorIndicator.begin(), _errorIndicator.end(), 0);
 
-	const int gmresResult = _gmres.solve(tolerance, weight + finalOffset, _tempState + finalOffset, rhs + finalOffset);
+	int gmresResult = 0;
+	{
+		CADET_PROFILE_SCOPE("gmres");
+		gmresResult = _gmres.solve(tolerance, weight + finalOffset, _tempState + finalOffset, rhs + finalOffset);
+	}
 
 	// Set last cumulative error to all elements to restore state (in the end only total error matters)
 	std::fill(_errorIndicator.begin(), _errorIndicator.end(), updateErrorIndicator(curError, gmresResult));
@@ -170,12 +183,11 @@ int ModelSystem::linearSolveParallel(double t, double alpha, double outerTol, do
 
 	// ==== Step 4: Solve U * x = y by backward substitution
 	// The fluxes are already solved and remain unchanged
-#ifdef CADET_PARALLELIZE
-	tbb::parallel_for(std::size_t(0), _models.size(), [=](std::size_t idxModel)
-#else
-	for (std::size_t idxModel = 0; idxModel < _models.size(); ++idxModel)
-#endif
+	forEachUnitOperation(_unitSchedule, [&](unsigned int idxModel)
 	{
+		BENCH_SCOPE_IDX(_timerUnitLinearSolve, idxModel);
+		CADET_PROFILE_SCOPE_UNIT("unit linear solve", _models[idxModel]->unitOperationId());
+
 		IUnitOperation* const m = _models[idxModel];
 		const unsigned int offset = _dofOffset[idxModel];
 
@@ -192,7 +204,7 @@ int ModelSystem::linearSolveParallel(double t, double alpha, double outerTol, do
 		{
 			rhs[i] -= _tempState[i];
 		}
-	} CADET_PARFOR_END;
+	});
 
 	return totalErrorIndicatorFromLocal(_errorIndicator);
 }
@@ -219,19 +231,18 @@ int ModelSystem::schurComplementMatrixVector(double const* x, double* z, double
 	const ConstSimulationState& simState) const
 {
 	BENCH_SCOPE(_timerMatVec);
+	CADET_PROFILE_SCOPE("schur matvec");
 
 	// Copy x over to result z, which corresponds to the application of the identity matrix
 	std::copy(x, x + numCouplingDOF(), z);
 
 	// Inlets and outlets don't participate in the Schur solver since one of NF or FN for them is always 0
 	// As a result we only have to work with items that have both an inlet and an outlet
-#ifdef CADET_PARALLELIZE
-	tbb::parallel_for(std::size_t(0), _inOutModels.size(), [=](std::size_t i)
-#else
-	for (std::size_t i = 0; i < _inOutModels.size(); ++i)
-#endif
+	forEachUnitOperation(_inOutSchedule, [&](unsigned int idxModel)
 	{
-		const unsigned int idxModel = _inOutModels[i];
+		BENCH_SCOPE_IDX(_timerUnitLinearSolve, idxModel);
+		CADET_PROFILE_SCOPE_UNIT("unit schur matvec", _models[idxModel]->unitOperationId());
+
 		IUnitOperation* const m = _models[idxModel];
 		const unsigned int offset = _dofOffset[idxModel];
 
@@ -248,11 +259,132 @@ int ModelSystem::schurComplementMatrixVector(double const* x, double* z, double
 #endif
 			_jacFN[idxModel].multiplySubtract(_tempState + offset, z);
 		}
-	} CADET_PARFOR_END;
+	});
 
 	return totalErrorIndicatorFromLocal(_errorIndicator);
 }
 
+/**
+ * @brief Solves the linear system with the full Jacobian of the entire system without assembling it
+ * @details Solves @f$ \left( \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} \right) x = b @f$
+ *          using GMRES (Jacobian-free Newton-Krylov). The matrix-vector products are approximated by
+ *          directional finite differences of the system residual (see jacobianFreeMatrixVector()).
+ *          If enabled, the usual block solver based on the unit operation Jacobians (which may be
+ *          outdated) is applied as right preconditioner.
+ * @param [in] t Current time point
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] outerTol Error tolerance for the solution of the linear system from outer Newton iteration
+ * @param [in,out] rhs On entry, right hand side of the linear equation system. On exit, solution of the system.
+ * @param [in] weight Vector with error weights
+ * @param [in] simState State of the simulation (state vector and its time derivatives) at which the Jacobian is evaluated
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ */
+int ModelSystem::linearSolveJacobianFree(double t, double alpha, double outerTol, double* const rhs, double const* const weight,
+	const ConstSimulationState& simState)
+{
+	CADET_PROFILE_SCOPE("linear solve");
+
+	const unsigned int n = numDofs();
+	double* const resBase = _jacFreeTemp.data();
+	double* const sol = resBase + n;
+
+	// Residual at the current point is the base of the directional differences
+	const int resResult = residual(SimulationTime{t, _curSecIdx}, simState, resBase);
+	if (resResult != 0)
+		return resResult;
+
+	const double tolerance = std::sqrt(static_cast<double>(n)) * outerTol * _schurSafety;
+
+	auto jacobianFreeMatrixVectorPartial = [&, this](void* userData, double const* x, double* z) -> int
+	{
+		return ModelSystem::jacobianFreeMatrixVector(x, z, t, alpha, outerTol, weight, simState);
+	};
+
+	_gmresJacFree.matrixVectorMultiplier(jacobianFreeMatrixVectorPartial);
+
+	std::fill_n(sol, n, 0.0);
+	int gmresResult = 0;
+	{
+		CADET_PROFILE_SCOPE("gmres");
+		gmresResult = _gmresJacFree.solve(tolerance, weight, rhs, sol);
+	}
+	std::copy_n(sol, n, rhs);
+
+	if (!_jacobianFreePrecond)
+		return gmresResult;
+
+	// Undo right preconditioning
+	if (_linearModelOrdering.sliceSize(_curSwitchIndex) == 0)
+		return updateErrorIndicator(gmresResult, linearSolveParallel(t, alpha, outerTol, rhs, weight, simState));
+	else
+		return updateErrorIndicator(gmresResult, linearSolveSequential(t, alpha, outerTol, rhs, weight, simState));
+}
+
+/**
+ * @brief Performs the matrix-vector product @f$ z = J P^{-1} x @f$ with the system Jacobian @f$ J @f$ and the preconditioner @f$ P @f$
+ * @details The Jacobian @f$ J = \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} @f$ is
+ *          applied to a vector @f$ v @f$ by directional finite differences
+ *          @f[ Jv \approx \frac{F\left(t, y + \sigma v, \dot{y} + \alpha \sigma v\right) - F\left(t, y, \dot{y}\right)}{\sigma}, @f]
+ *          where @f$ \sigma = 1 / \lVert v \rVert_{\text{WRMS}} @f$ as in IDAS. Since the weights are the inverse
+ *          error tolerances, the perturbation is of the size of the tolerances. The residual
+ *          @f$ F(t, y, \dot{y}) @f$ is expected at the beginning of the temporary storage.
+ *          If the preconditioner is disabled, @f$ P = I @f$ holds.
+ * @param [in] x Vector @f$ x @f$ the matrix is multiplied with
+ * @param [out] z Result of the matrix-vector multiplication
+ * @return @c 0 if successful, any other value in case of failure
+ */
+int ModelSystem::jacobianFreeMatrixVector(double const* x, double* z, double t, double alpha, double outerTol, double const* const weight,
+	const ConstSimulationState& simState)
+{
+	const unsigned int n = numDofs();
+	double const* const resBase = _jacFreeTemp.data();
+	double* const dir = _jacFreeTemp.data() + 2 * n;
+	double* const yPert = dir + n;
+	double* const yDotPert = yPert + n;
+
+	// Apply preconditioner
+	int result = 0;
+	std::copy_n(x, n, dir);
+	if (_jacobianFreePrecond)
+	{
+		if (_linearModelOrdering.sliceSize(_curSwitchIndex) == 0)
+			result = linearSolveParallel(t, alpha, outerTol, dir, weight, simState);
+		else
+			result = linearSolveSequential(t, alpha, outerTol, dir, weight, simState);
+
+		if (result < 0)
+			return result;
+	}
+
+	BENCH_SCOPE(_timerMatVec);
+
+	double normDir = 0.0;
+	for (unsigned int i = 0; i < n; ++i)
+		normDir += (dir[i] * weight[i]) * (dir[i] * weight[i]);
+	normDir = std::sqrt(normDir / static_cast<double>(n));
+
+	if (normDir == 0.0)
+	{
+		std::fill_n(z, n, 0.0);
+		return result;
+	}
+
+	const double sigma = 1.0 / normDir;
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		yPert[i] = simState.vecStateY[i] + sigma * dir[i];
+		yDotPert[i] = simState.vecStateYdot[i] + alpha * sigma * dir[i];
+	}
+
+	const int resResult = residual(SimulationTime{t, _curSecIdx}, ConstSimulationState{yPert, yDotPert}, z);
+
+	const double invSigma = 1.0 / sigma;
+	for (unsigned int i = 0; i < n; ++i)
+		z[i] = (z[i] - resBase[i]) * invSigma;
+
+	return updateErrorIndicator(result, resResult);
+}
+
 /**
  * @brief Multiplies a vector with the full Jacobian of the entire system (i.e., @f$ \frac{\partial F}{\partial y}\left(t, y, \dot{y}\right) @f$)
  * @details Actually, the operation @f$ z = \alpha \frac{\partial F}{\partial y} x + \beta z @f$ is performed.
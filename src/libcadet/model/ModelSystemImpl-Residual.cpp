@@ -18,6 +18,7 @@
 
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
+#include "Profiler.hpp"
 
 #include "ParallelSupport.hpp"
 #ifdef CADET_PARALLELIZE
@@ -89,6 +90,9 @@ namespace model
 
 int ModelSystem::jacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, const AdJacobianParams& adJac)
 {
+	// Jacobian-free mode without preconditioner does not use any Jacobian
+	if (!requiresUnitJacobians())
+		return 0;
 
 #ifdef CADET_PARALLELIZE
 	tbb::parallel_for(std::size_t(0), _models.size(), [&](std::size_t i)
@@ -118,6 +122,8 @@ int ModelSystem::jacobian(const SimulationTime& simTime, const ConstSimulationSt
 
 void ModelSystem::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
 {
+	_curSecIdx = secIdx;
+
 	// Check if simulation is (re-)starting from the very beginning
 	if (secIdx == 0)
 		_curSwitchIndex = 0;
@@ -515,13 +521,13 @@ double ModelSystem::residualNorm(const SimulationTime& simTime, const ConstSimul
 int ModelSystem::residual(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res)
 {
 	BENCH_START(_timerResidual);
+	CADET_PROFILE_SCOPE("residual");
 
-#ifdef CADET_PARALLELIZE
-	tbb::parallel_for(std::size_t(0), _models.size(), [&](std::size_t i)
-#else
-	for (std::size_t i = 0; i < _models.size(); ++i)
-#endif
+	forEachUnitOperation(_unitSchedule, [&](unsigned int i)
 	{
+		BENCH_SCOPE_IDX(_timerUnitResidual, i);
+		CADET_PROFILE_SCOPE_UNIT("unit residual", _models[i]->unitOperationId());
+
 		IUnitOperation* const m = _models[i];
 		const unsigned int offset = _dofOffset[i];
 
@@ -532,7 +538,7 @@ int ModelSystem::residual(const SimulationTime& simTime, const ConstSimulationSt
 		}
 
 		_errorIndicator[i] = m->residual(simTime, applyOffset(simState, offset), res + offset, _threadLocalStorage);
-	} CADET_PARFOR_END;
+	});
 
 	// Handle connections
 	if (cadet_unlikely(_hasDynamicFlowRates))
@@ -546,15 +552,25 @@ int ModelSystem::residual(const SimulationTime& simTime, const ConstSimulationSt
 
 int ModelSystem::residualWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState,
 	double* const res, const AdJacobianParams& adJac)
+{
+	// Jacobian-free mode without preconditioner does not use any Jacobian
+	if (!requiresUnitJacobians())
+		return residual(simTime, simState, res);
+
+	return residualWithUnitJacobians(simTime, simState, res, adJac);
+}
+
+int ModelSystem::residualWithUnitJacobians(const SimulationTime& simTime, const ConstSimulationState& simState,
+	double* const res, const AdJacobianParams& adJac)
 {
 	BENCH_START(_timerResidual);
+	CADET_PROFILE_SCOPE("residual with Jacobian");
 
-#ifdef CADET_PARALLELIZE
-	tbb::parallel_for(std::size_t(0), _models.size(), [&](std::size_t i)
-#else
-	for (std::size_t i = 0; i < _models.size(); ++i)
-#endif
+	forEachUnitOperation(_unitSchedule, [&](unsigned int i)
 	{
+		BENCH_SCOPE_IDX(_timerUnitResidual, i);
+		CADET_PROFILE_SCOPE_UNIT("unit residual with Jacobian", _models[i]->unitOperationId());
+
 		IUnitOperation* const m = _models[i];
 		const unsigned int offset = _dofOffset[i];
 
@@ -566,8 +582,7 @@ int ModelSystem::residualWithJacobian(const SimulationTime& simTime, const Const
 
 		_errorIndicator[i] = m->residualWithJacobian(simTime, applyOffset(simState, offset),
 			res + offset, applyOffset(adJac, offset), _threadLocalStorage);
-
-	} CADET_PARFOR_END;
+	});
 
 	// Handle connections
 	if (cadet_unlikely(_hasDynamicFlowRates))
@@ -662,26 +677,20 @@ void ModelSystem::residualSensFwdNorm(unsigned int nSens, const SimulationTime&
 {
 	const unsigned int nDOFs = numDofs();
 
-	// Reserve memory for nSens residual vectors
-	util::SlicedVector<double> tempRes;
-	tempRes.reserve(nSens * nDOFs, nSens);
-
-	std::vector<double*> resPtr(nSens, nullptr);
-	for (std::size_t i = 0; i < resPtr.size(); ++i)
-	{
-		tempRes.pushBackSlice(nDOFs);
-		resPtr[i] = tempRes[i];
-	}
+	// Memory for nSens residual vectors and two temporary vectors (this should be a noop except for the first time)
+	_sensNormTemp.resize((nSens + 2) * nDOFs);
+	_sensNormResPtr.resize(nSens, nullptr);
+	for (unsigned int i = 0; i < nSens; ++i)
+		_sensNormResPtr[i] = _sensNormTemp.data() + i * nDOFs;
 
-	// Reserve some more temporary memory
-	std::vector<double> tempMem(nDOFs * 2, 0.0);
+	double* const tempMem = _sensNormTemp.data() + nSens * nDOFs;
 
 	// Evaluate all the sensitivity system residuals at once
-	residualSensFwd(nSens, simTime, simState, nullptr, yS, ySdot, resPtr, adRes, tmp, tempMem.data(), tempMem.data() + nDOFs);
+	residualSensFwd(nSens, simTime, simState, nullptr, yS, ySdot, _sensNormResPtr, adRes, tmp, tempMem, tempMem + nDOFs);
 
 	// Calculate norms
 	for (unsigned int i = 0; i < nSens; ++i)
-		norms[i] = linalg::linfNorm(tempRes[i], nDOFs);
+		norms[i] = linalg::linfNorm(_sensNormResPtr[i], nDOFs);
 }
 
 int ModelSystem::residualSensFwdWithJacobian(unsigned int nSens, const SimulationTime& simTime,
@@ -692,6 +701,60 @@ int ModelSystem::residualSensFwdWithJacobian(unsigned int nSens, const Simulatio
 	return residualSensFwdWithJacobianAlgorithm<true>(nSens, simTime, simState, res, yS, ySdot, resS, adJac, tmp1, tmp2, tmp3);
 }
 
+/**
+ * @brief Computes the forward sensitivity residuals of all unit operations with one task per sensitive parameter
+ * @details Assembles @f$ \frac{\partial F}{\partial y} s + \frac{\partial F}{\partial \dot{y}} \dot{s} + \frac{\partial F}{\partial p} @f$
+ *          for the unit operation blocks of the system. In contrast to calling IUnitOperation::residualSensFwdCombine()
+ *          for each unit operation (which loops over all parameters), the parameters are distributed over the threads
+ *          and each task applies the (already assembled) Jacobians of all unit operations to its sensitivity direction.
+ *          Each parameter direction uses its own temporary storage, so the tasks are independent.
+ *
+ *          The coupling DOFs are not touched by this function.
+ * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+ * @param [in] simState State of the simulation (state vector and its time derivative)
+ * @param [in] yS Pointers to global sensitivity state vectors
+ * @param [in] ySdot Pointers to global sensitivity time derivative state vectors
+ * @param [out] resS Pointers to global sensitivity residuals
+ * @param [in] adRes Pointer to global residual vector of AD datatypes with parameter sensitivities
+ */
+void ModelSystem::residualSensFwdCombinePerParameter(const SimulationTime& simTime, const ConstSimulationState& simState,
+	const std::vector<const double*>& yS, const std::vector<const double*>& ySdot, const std::vector<double*>& resS, active const* adRes)
+{
+	const unsigned int nDOFs = numDofs();
+
+	// Each parameter requires two vectors for (dF / dy) * s and (dF / dyDot) * sDot (this should be a noop except for the first time)
+	_sensDirTemp.resize(2 * nDOFs * yS.size());
+
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(std::size_t(0), yS.size(), [&](std::size_t param)
+#else
+	for (std::size_t param = 0; param < yS.size(); ++param)
+#endif
+	{
+		double* const jacS = _sensDirTemp.data() + 2 * nDOFs * param;
+		double* const jacSdot = jacS + nDOFs;
+
+		for (std::size_t i = 0; i < _models.size(); ++i)
+		{
+			IUnitOperation* const m = _models[i];
+			const unsigned int offset = _dofOffset[i];
+			const ConstSimulationState localState = applyOffset(simState, offset);
+
+			// Directional derivative (dF / dy) * s
+			m->multiplyWithJacobian(simTime, localState, yS[param] + offset, 1.0, 0.0, jacS + offset);
+
+			// Directional derivative (dF / dyDot) * sDot
+			m->multiplyWithDerivativeJacobian(simTime, localState, ySdot[param] + offset, jacSdot + offset);
+
+			// Complete sens residual is the sum
+			double* const ptrResS = resS[param] + offset;
+			active const* const localAdRes = adRes + offset;
+			for (unsigned int j = 0; j < m->numDofs(); ++j)
+				ptrResS[j] = jacS[offset + j] + jacSdot[offset + j] + localAdRes[j].getADValue(param);
+		}
+	} CADET_PARFOR_END;
+}
+
 template <bool evalJacobian>
 int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const SimulationTime& simTime,
 	const ConstSimulationState& simState, double const* const res,
@@ -699,6 +762,7 @@ int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const
 	const AdJacobianParams& adJac, double* const tmp1, double* const tmp2, double* const tmp3)
 {
 	BENCH_START(_timerResidualSens);
+	CADET_PROFILE_SCOPE("sensitivity residual");
 
 	const unsigned int nModels = _models.size();
 
@@ -716,12 +780,11 @@ int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const
 
 	// Step 1: Calculate sensitivities using AD in vector mode
 
-#ifdef CADET_PARALLELIZE
-	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(nModels), [&](std::size_t i)
-#else
-	for (unsigned int i = 0; i < nModels; ++i)
-#endif
+	forEachUnitOperation(_unitSchedule, [&](unsigned int i)
 	{
+		BENCH_SCOPE_IDX(_timerUnitResidual, i);
+		CADET_PROFILE_SCOPE_UNIT("unit sensitivity residual", _models[i]->unitOperationId());
+
 		IUnitOperation* const m = _models[i];
 		const unsigned int offset = _dofOffset[i];
 
@@ -732,7 +795,7 @@ int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const
 		}
 
 		_errorIndicator[i] = ResidualSensCaller<evalJacobian>::call(m, simTime, applyOffset(simState, offset), applyOffset(adJac, offset), _threadLocalStorage);
-	} CADET_PARFOR_END;
+	});
 
 	// Connect units
 	if (cadet_unlikely(_hasDynamicFlowRates))
@@ -740,28 +803,36 @@ int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const
 
 	residualConnectUnitOps<double, active, active>(simTime.secIdx, simState.vecStateY, simState.vecStateYdot, adJac.adRes);
 
+	if (_parallelSensResidual)
+	{
+		// Step 2: Compute forward sensitivity residuals in one task per parameter
+		residualSensFwdCombinePerParameter(simTime, simState, yS, ySdot, resS, adJac.adRes);
+	}
+	else
+	{
 #ifdef CADET_PARALLELIZE
-	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(nModels), [&](std::size_t i)
+		tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(nModels), [&](std::size_t i)
 #else
-	for (unsigned int i = 0; i < nModels; ++i)
+		for (unsigned int i = 0; i < nModels; ++i)
 #endif
-	{
-		// Step 2: Compute forward sensitivity residuals by multiplying with system Jacobians
-		IUnitOperation* const m = _models[i];
-		const unsigned int offset = _dofOffset[i];
-
-		// Move this outside the loop, these are memory addresses and should never change
-		// Use correct offset in sensitivity state vectors
-		for (std::size_t j = 0; j < yS.size(); ++j)
 		{
-			_yStemp[i][j] = yS[j] + offset;
-			_yStempDot[i][j] = ySdot[j] + offset;
-			_resSTemp[i][j] = resS[j] + offset;
-		}
+			// Step 2: Compute forward sensitivity residuals by multiplying with system Jacobians
+			IUnitOperation* const m = _models[i];
+			const unsigned int offset = _dofOffset[i];
 
-		const int intermediateRes = m->residualSensFwdCombine(simTime, applyOffset(simState, offset), _yStemp[i], _yStempDot[i], _resSTemp[i], adJac.adRes + offset, tmp1 + offset, tmp2 + offset, tmp3 + offset);
-		_errorIndicator[i] = updateErrorIndicator(_errorIndicator[i], intermediateRes);
-	} CADET_PARFOR_END;
+			// Move this outside the loop, these are memory addresses and should never change
+			// Use correct offset in sensitivity state vectors
+			for (std::size_t j = 0; j < yS.size(); ++j)
+			{
+				_yStemp[i][j] = yS[j] + offset;
+				_yStempDot[i][j] = ySdot[j] + offset;
+				_resSTemp[i][j] = resS[j] + offset;
+			}
+
+			const int intermediateRes = m->residualSensFwdCombine(simTime, applyOffset(simState, offset), _yStemp[i], _yStempDot[i], _resSTemp[i], adJac.adRes + offset, tmp1 + offset, tmp2 + offset, tmp3 + offset);
+			_errorIndicator[i] = updateErrorIndicator(_errorIndicator[i], intermediateRes);
+		} CADET_PARFOR_END;
+	}
 
 	// tmp1 stores result of (dF / dy) * s
 	// tmp2 stores result of (dF / dyDot) * sDot
@@ -23,6 +23,7 @@
 #include <sstream>
 #include <iomanip>
 #include <iterator>
+#include <algorithm>
 
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
@@ -95,7 +96,7 @@ namespace cadet
 namespace model
 {
 
-ModelSystem::ModelSystem() : _jacNF(nullptr), _jacFN(nullptr), _jacActiveFN(nullptr), _curSwitchIndex(0), _tempState(nullptr), _initState(0, 0.0), _initStateDot(0, 0.0)
+ModelSystem::ModelSystem() : _jacNF(nullptr), _jacFN(nullptr), _jacActiveFN(nullptr), _curSwitchIndex(0), _jacobianFree(false), _jacobianFreePrecond(true), _curSecIdx(0), _parallelSensResidual(false), _tempState(nullptr), _initState(0, 0.0), _initStateDot(0, 0.0)
 {
 }
 
@@ -368,6 +369,37 @@ void ModelSystem::rebuildInternalDataStructures()
 	// Allocate error indicator vector
 	_errorIndicator.resize(_models.size(), 0);
 
+	// Schedule expensive unit operations first to reduce idle time at the end of parallel loops
+	_unitSchedule.resize(_models.size());
+	for (unsigned int i = 0; i < _models.size(); ++i)
+		_unitSchedule[i] = i;
+
+	const auto byDecreasingDofs = [this](unsigned int a, unsigned int b) { return _dofs[a] > _dofs[b]; };
+	std::stable_sort(_unitSchedule.begin(), _unitSchedule.end(), byDecreasingDofs);
+
+	_inOutSchedule = _inOutModels;
+	std::stable_sort(_inOutSchedule.begin(), _inOutSchedule.end(), byDecreasingDofs);
+
+#ifdef CADET_BENCHMARK_MODE
+	_timerUnitResidual.clear();
+	_timerUnitResidual.resize(_models.size());
+	_timerUnitLinearSolve.clear();
+	_timerUnitLinearSolve.resize(_models.size());
+
+	_benchUnitDesc.clear();
+	_benchUnitDesc.reserve(2 * _models.size());
+	for (IUnitOperation const* m : _models)
+	{
+		const std::string unitName = "Unit" + std::to_string(static_cast<int>(m->unitOperationId()));
+		_benchUnitDesc.push_back(unitName + "Residual");
+		_benchUnitDesc.push_back(unitName + "LinearSolve");
+	}
+
+	_benchDesc = { "DOFs", "Residual", "ResidualSens", "ConsistentInit", "LinearAssemble", "LinearSolve", "MatVec", "NumGMRESIter", "NumJacFreeGMRESIter" };
+	for (const std::string& desc : _benchUnitDesc)
+		_benchDesc.push_back(desc.c_str());
+#endif
+
 	LOG(Debug) << "DOF offsets: " << _dofOffset;
 }
 
@@ -528,11 +560,24 @@ bool ModelSystem::configureModelDiscretization(IParameterProvider& paramProvider
 	const int gsType = paramProvider.getInt("GS_TYPE");
 	const int maxRestarts = paramProvider.getInt("MAX_RESTARTS");
 	_schurSafety = paramProvider.getDouble("SCHUR_SAFETY");
+
+	_jacobianFree = paramProvider.exists("JACOBIAN_FREE") ? paramProvider.getBool("JACOBIAN_FREE") : false;
+	_jacobianFreePrecond = paramProvider.exists("JFNK_PRECONDITIONER") ? (paramProvider.getInt("JFNK_PRECONDITIONER") != 0) : true;
+	const int maxKrylovJacFree = paramProvider.exists("JFNK_MAX_KRYLOV") ? paramProvider.getInt("JFNK_MAX_KRYLOV") : 30;
 	paramProvider.popScope();
 
 	// Initialize and configure GMRES for solving the Schur-complement
     _gmres.initialize(numCouplingDOF(), maxKrylov, linalg::toOrthogonalization(gsType), maxRestarts);
 
+	// The full system is only solved by GMRES in Jacobian-free mode
+	if (_jacobianFree)
+	{
+		_gmresJacFree.initialize(numDofs(), maxKrylovJacFree, linalg::toOrthogonalization(gsType), maxRestarts);
+		_jacFreeTemp.resize(5 * numDofs());
+	}
+	else
+		_jacFreeTemp.clear();
+
 	// Allocate tempState vector
 	delete[] _tempState;
 	_tempState = new double[numDofs()];
@@ -628,6 +673,8 @@ bool ModelSystem::configure(IParameterProvider& paramProvider)
 
 	_gmres.orthoMethod(linalg::toOrthogonalization(gsType));
 	_gmres.maxRestarts(maxRestarts);
+	_gmresJacFree.orthoMethod(linalg::toOrthogonalization(gsType));
+	_gmresJacFree.maxRestarts(maxRestarts);
 
 	// Reconfigure switches
 	configureSwitches(paramProvider);
@@ -925,6 +972,12 @@ void ModelSystem::readLinearSolutionMode(IParameterProvider& paramProvider)
 	// Override default by user option
 	if (paramProvider.exists("LINEAR_SOLUTION_MODE"))
 		_linearSolutionMode = paramProvider.getInt("LINEAR_SOLUTION_MODE");
+
+	// Default: Loop over unit operations, each unit operation loops over all parameters
+	_parallelSensResidual = false;
+
+	if (paramProvider.exists("PARALLEL_SENS_RESIDUAL"))
+		_parallelSensResidual = paramProvider.getBool("PARALLEL_SENS_RESIDUAL");
 }
 
 /**
@@ -25,6 +25,7 @@
 #include "ParamIdUtil.hpp"
 
 #include <vector>
+#include <string>
 #include <tuple>
 #include <map>
 #include <unordered_map>
@@ -108,6 +109,13 @@ public:
 	virtual int jacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, const AdJacobianParams& adJac);
 
 	virtual int residualWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, const AdJacobianParams& adJac);
+
+	/**
+	 * @brief Computes the residual and assembles the unit operation Jacobians regardless of the linear solver mode
+	 * @details Consistent initialization relies on the unit operation Jacobians even if the time
+	 *          integrator does not (Jacobian-free mode without preconditioner).
+	 */
+	int residualWithUnitJacobians(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, const AdJacobianParams& adJac);
 	virtual double residualNorm(const SimulationTime& simTime, const ConstSimulationState& simState);
 
 	virtual int residualSensFwd(unsigned int nSens, const SimulationTime& simTime,
@@ -153,7 +161,7 @@ public:
 #ifdef CADET_BENCHMARK_MODE
 	virtual std::vector<double> benchmarkTimings() const
 	{
-		return std::vector<double>({
+		std::vector<double> timings({
 			static_cast<double>(numDofs()),
 			_timerResidual.totalElapsedTime(),
 			_timerResidualSens.totalElapsedTime(),
@@ -161,23 +169,23 @@ public:
 			_timerLinearAssemble.totalElapsedTime(),
 			_timerLinearSolve.totalElapsedTime(),
 			_timerMatVec.totalElapsedTime(),
-			static_cast<double>(_gmres.numIterations())
+			static_cast<double>(_gmres.numIterations()),
+			static_cast<double>(_gmresJacFree.numIterations())
 		});
+
+		// Append timings of the unit operations
+		for (std::size_t i = 0; i < _timerUnitResidual.size(); ++i)
+		{
+			timings.push_back(_timerUnitResidual[i].totalElapsedTime());
+			timings.push_back(_timerUnitLinearSolve[i].totalElapsedTime());
+		}
+
+		return timings;
 	}
 
 	virtual char const* const* benchmarkDescriptions() const
 	{
-		static const char* const desc[] = {
-			"DOFs",
-			"Residual",
-			"ResidualSens",
-			"ConsistentInit",
-			"LinearAssemble",
-			"LinearSolve",
-			"MatVec",
-			"NumGMRESIter"
-		};
-		return desc;
+		return _benchDesc.data();
 	}
 #endif
 
@@ -204,6 +212,20 @@ protected:
 	int schurComplementMatrixVector(double const* x, double* z, double t, double alpha, double outerTol, double const* const weight,
 		const ConstSimulationState& simState) const;
 
+	int linearSolveJacobianFree(double t, double alpha, double tol, double* const rhs, double const* const weight,
+		const ConstSimulationState& simState);
+
+	int jacobianFreeMatrixVector(double const* x, double* z, double t, double alpha, double outerTol, double const* const weight,
+		const ConstSimulationState& simState);
+
+	/**
+	 * @brief Determines whether the Jacobians of the unit operations have to be assembled
+	 * @details In Jacobian-free mode without preconditioner, the unit operation Jacobians are only
+	 *          required for computing forward sensitivities.
+	 * @return @c true if unit operation Jacobians are required, otherwise @c false
+	 */
+	inline bool requiresUnitJacobians() const CADET_NOEXCEPT { return !_jacobianFree || _jacobianFreePrecond || !_sensParams.empty(); }
+
 	void configureSwitches(IParameterProvider& paramProvider);
 
 	template <typename StateType, typename ResidualType, typename ParamType>
@@ -244,6 +266,9 @@ protected:
 	template <typename tag_t>
 	void consistentInitialSensitivityAlgorithm(const SimulationTime& simTime, const ConstSimulationState& simState,
 		std::vector<double*>& vecSensY, std::vector<double*>& vecSensYdot, active* const adRes, active* const adY);
+	void residualSensFwdCombinePerParameter(const SimulationTime& simTime, const ConstSimulationState& simState,
+		const std::vector<const double*>& yS, const std::vector<const double*>& ySdot, const std::vector<double*>& resS, active const* adRes);
+
 	template <bool evalJacobian>
 	int residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const SimulationTime& simTime,
 		const ConstSimulationState& simState, double const* const res,
@@ -274,6 +299,10 @@ protected:
 	unsigned int _curSwitchIndex; //!< Current index in _switchSectionIndex list 
 	util::SlicedVector<int> _linearModelOrdering; //!< Dependency-consistent ordering of unit operation models for linear execution (for each switch)
 	int _linearSolutionMode; //!< Linear solution mode (0: automatic, 1: parallel, 2: sequential)
+	bool _jacobianFree; //!< Determines whether linear systems are solved by Jacobian-free Newton-Krylov (JFNK)
+	bool _jacobianFreePrecond; //!< Determines whether the unit operation block solver is used as JFNK preconditioner
+	unsigned int _curSecIdx; //!< Index of the current section
+	bool _parallelSensResidual; //!< Determines whether the forward sensitivity residuals are assembled in one task per parameter
 
 	mutable std::vector<int> _errorIndicator; //!< Storage for return value of unit operation function calls
 
@@ -294,6 +323,11 @@ protected:
 	std::vector<std::vector<const double*>> _yStemp; //!< Needed to store offsets for unit operations
 	std::vector<std::vector<const double*>> _yStempDot;  //!< Needed to store offsets for unit operations
 	std::vector<std::vector<double*>> _resSTemp;  //!< Needed to store offsets for unit operations
+	std::vector<double> _sensDirTemp; //!< Temporary storage for Jacobian-vector products of each sensitivity direction
+	mutable std::vector<double*> _sensYlocal; //!< Sensitivity state pointers with unit operation offset applied
+	mutable std::vector<double*> _sensYdotLocal; //!< Sensitivity state time derivative pointers with unit operation offset applied
+	std::vector<double> _sensNormTemp; //!< Temporary storage for sensitivity residuals and directional derivatives in residualSensFwdNorm()
+	std::vector<double*> _sensNormResPtr; //!< Pointers to sensitivity residuals in _sensNormTemp
 
 	std::map<std::tuple<unsigned int, unsigned int, unsigned int>, unsigned int> _couplingIdxMap; //!< Maps (UnitOpIdx, PortIdx, CompIdx) to local coupling DOF index
 
@@ -302,8 +336,12 @@ protected:
 
 	linalg::Gmres _gmres; //!< GMRES algorithm for the Schur-complement in linearSolve()
 	double _schurSafety; //!< Safety factor for Schur-complement solution
+	linalg::Gmres _gmresJacFree; //!< GMRES algorithm for the full system in Jacobian-free mode
+	std::vector<double> _jacFreeTemp; //!< Temporary storage for Jacobian-free matrix-vector products
 
 	std::vector<unsigned int> _inOutModels; //!< Indices of unit operation models in _models that have inlet and outlet
+	std::vector<unsigned int> _unitSchedule; //!< Indices of unit operation models ordered by decreasing work estimate (number of DOFs)
+	std::vector<unsigned int> _inOutSchedule; //!< Indices of unit operation models with inlet and outlet ordered by decreasing work estimate
 
 	std::vector<double> _initState; //!< Initial state vector
 	std::vector<double> _initStateDot; //!< Initial time derivative state vector
@@ -321,6 +359,13 @@ protected:
 	BENCH_TIMER(_timerLinearAssemble)
 	BENCH_TIMER(_timerLinearSolve)
 	BENCH_TIMER(_timerMatVec)
+
+#ifdef CADET_BENCHMARK_MODE
+	mutable std::vector<::cadet::Timer> _timerUnitResidual; //!< Residual evaluation time of each unit operation
+	mutable std::vector<::cadet::Timer> _timerUnitLinearSolve; //!< Linear solve time of each unit operation (including Schur-complement iterations)
+	std::vector<std::string> _benchUnitDesc; //!< Descriptions of the unit operation timings
+	std::vector<char const*> _benchDesc; //!< Descriptions of all benchmark timings returned by benchmarkTimings()
+#endif
 };
 
 } // namespace model
@@ -59,6 +59,53 @@ unsigned int UnitOperationBase::maxBindingAdDirs() const CADET_NOEXCEPT
 	return dirs;
 }
 
+bool UnitOperationBase::bindingDependsOnTime() const CADET_NOEXCEPT
+{
+	for (IBindingModel* bm : _binding)
+	{
+		if (bm && bm->dependsOnTime())
+			return true;
+	}
+	return false;
+}
+
+void UnitOperationBase::setBindingExternalFunctionGrid(std::vector<ColumnPosition>&& grid, std::vector<unsigned int>&& typeOffset)
+{
+	_extFunGrid = std::move(grid);
+	_extFunGridTypeOffset = std::move(typeOffset);
+
+	for (unsigned int type = 0; type + 1 < _extFunGridTypeOffset.size(); ++type)
+	{
+		for (unsigned int i = _extFunGridTypeOffset[type]; i < _extFunGridTypeOffset[type + 1]; ++i)
+			_extFunGrid[i].cacheIdx = bindingExternalFunctionCacheIdx(type, i - _extFunGridTypeOffset[type]);
+	}
+
+	for (IBindingModel* bm : _binding)
+	{
+		if (bm)
+			bm->invalidateExternalFunctionCache();
+	}
+}
+
+void UnitOperationBase::updateBindingExternalFunctionCache(double t, unsigned int secIdx)
+{
+	if (_extFunGrid.empty())
+		return;
+
+	if (_singleBinding)
+	{
+		if (!_binding.empty() && _binding[0] && _binding[0]->dependsOnTime())
+			_binding[0]->updateExternalFunctionCache(t, secIdx, _extFunGrid.data(), _extFunGrid.size());
+		return;
+	}
+
+	for (unsigned int type = 0; (type < _binding.size()) && (type + 1 < _extFunGridTypeOffset.size()); ++type)
+	{
+		if (_binding[type] && _binding[type]->dependsOnTime())
+			_binding[type]->updateExternalFunctionCache(t, secIdx, _extFunGrid.data() + _extFunGridTypeOffset[type], _extFunGridTypeOffset[type + 1] - _extFunGridTypeOffset[type]);
+	}
+}
+
 void UnitOperationBase::clearBindingModels() CADET_NOEXCEPT
 {
 	if (_singleBinding)
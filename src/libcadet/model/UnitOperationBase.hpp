@@ -22,6 +22,7 @@
 #include "AutoDiff.hpp"
 #include "ParamIdUtil.hpp"
 #include "nonlin/Solver.hpp"
+#include "SimulationTypes.hpp"
 
 #include <unordered_map>
 #include <unordered_set>
@@ -76,6 +77,40 @@ protected:
 
 	unsigned int maxBindingAdDirs() const CADET_NOEXCEPT;
 
+	bool bindingDependsOnTime() const CADET_NOEXCEPT;
+
+	/**
+	 * @brief Sets the grid of positions for the external function cache of the binding models
+	 * @details The grid consists of one block of consecutive positions per particle type. A single
+	 *          binding model caches the whole grid, otherwise each binding model caches the block of
+	 *          its particle type. The ColumnPosition::cacheIdx of the grid positions is set accordingly
+	 *          and all caches are invalidated. An empty grid disables the cache.
+	 * @param [in] grid Grid positions
+	 * @param [in] typeOffset Offset of the block of each particle type in @p grid (number of particle types + 1 elements)
+	 */
+	void setBindingExternalFunctionGrid(std::vector<ColumnPosition>&& grid, std::vector<unsigned int>&& typeOffset);
+
+	/**
+	 * @brief Fills the external function caches of all binding models for the given time and section
+	 * @details Has to be called before evaluating the binding models in parallel.
+	 * @param [in] t Current time
+	 * @param [in] secIdx Index of the current section
+	 */
+	void updateBindingExternalFunctionCache(double t, unsigned int secIdx);
+
+	/**
+	 * @brief Returns the external function cache index of a grid position
+	 * @param [in] parType Particle type index
+	 * @param [in] idx Index of the position in the block of the particle type
+	 * @return Index to be used in ColumnPosition::cacheIdx, or @c -1 if the cache is disabled
+	 */
+	inline int bindingExternalFunctionCacheIdx(unsigned int parType, unsigned int idx) const CADET_NOEXCEPT
+	{
+		if (_extFunGrid.empty())
+			return -1;
+		return static_cast<int>(_singleBinding ? _extFunGridTypeOffset[parType] + idx : idx);
+	}
+
 	UnitOpIdx _unitOpIdx; //!< Unit operation index
 	std::vector<IBindingModel*> _binding; //!< Binding model
 	bool _singleBinding; //!< Determines whether only a single binding model is present
@@ -87,6 +122,9 @@ protected:
 	std::unordered_set<active*> _sensParams; //!< Holds all parameters with activated AD directions
 
 	nonlin::Solver* _nonlinearSolver; //!< Solver for nonlinear equations (consistent initialization)
+
+	std::vector<ColumnPosition> _extFunGrid; //!< Grid positions of the external function cache of the binding models
+	std::vector<unsigned int> _extFunGridTypeOffset; //!< Offset of each particle type in the grid of the external function cache
 };
 
 } // namespace model
@@ -22,6 +22,7 @@
 #include <vector>
 #include <unordered_map>
 #include <functional>
+#include <algorithm>
 
 /*<codegen>
 {
@@ -205,6 +206,59 @@ public:
 		}
 	}
 
+	virtual bool supportsFluxBatch() const CADET_NOEXCEPT { return true; }
+
+	virtual unsigned int fluxBatchWorkspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates, unsigned int nCells) const CADET_NOEXCEPT
+	{
+		// Parameters kA, kD, qMax of all binding sites (shared by all cells or per cell if externally dependent),
+		// qSum of each cell, and parameter cache
+		const unsigned int nSites = *std::max_element(nBoundStates, nBoundStates + nComp);
+		const unsigned int nParamCells = ParamHandler_t::dependsOnTime() ? nCells : 1;
+		return (3 * nComp * nSites * nParamCells + nCells) * sizeof(double) + 2 * alignof(double) + _paramHandler.cacheSize(nComp, totalNumBoundStates, nBoundStates);
+	}
+
+	virtual int fluxBatch(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nCells, double const* y, double const* yCp, double* res, LinearBufferAllocator workSpace) const
+	{
+		const unsigned int nSites = *std::max_element(_nBoundStates, _nBoundStates + _nComp);
+		const unsigned int nParamCells = ParamHandler_t::dependsOnTime() ? nCells : 1;
+		const unsigned int sliceSize = _nComp * nParamCells;
+		BufferedArray<double> params = workSpace.array<double>(3 * nSites * sliceSize);
+		BufferedArray<double> qSum = workSpace.array<double>(nCells);
+
+		// Parameters are stored in binding site-major ordering, each site is a slice of nComp * nParamCells elements
+		double* const kA = static_cast<double*>(params);
+		double* const kD = kA + nSites * sliceSize;
+		double* const qMax = kD + nSites * sliceSize;
+
+		// Gather parameters in structure-of-arrays layout
+		for (unsigned int k = 0; k < nParamCells; ++k)
+		{
+			LinearBufferAllocator cellWorkSpace = workSpace;
+			typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos[k], _nComp, _nBoundStates, cellWorkSpace);
+
+			for (unsigned int site = 0; site < nSites; ++site)
+			{
+				active const* const localKa = p->kA[site];
+				active const* const localKd = p->kD[site];
+				active const* const localQmax = p->qMax[site];
+
+				for (int i = 0; i < _nComp; ++i)
+				{
+					kA[site * sliceSize + i * nParamCells + k] = static_cast<double>(localKa[i]);
+					kD[site * sliceSize + i * nParamCells + k] = static_cast<double>(localKd[i]);
+					qMax[site * sliceSize + i * nParamCells + k] = static_cast<double>(localQmax[i]);
+				}
+			}
+		}
+
+		if (ParamHandler_t::dependsOnTime())
+			fluxBatchKernel<true>(nCells, nSites, kA, kD, qMax, y, yCp, res, static_cast<double*>(qSum));
+		else
+			fluxBatchKernel<false>(nCells, nSites, kA, kD, qMax, y, yCp, res, static_cast<double*>(qSum));
+
+		return 0;
+	}
+
 	CADET_BINDINGMODELBASE_BOILERPLATE
 
 protected:
@@ -281,6 +335,67 @@ protected:
 		return 0;
 	}
 
+	/**
+	 * @brief Evaluates the fluxes of all cells in structure-of-arrays layout
+	 * @details The innermost loops run over the cells and are free of branches, which allows the compiler to vectorize them.
+	 * @tparam perCellParams Determines whether the parameters are given for each cell (@c true) or shared by all cells (@c false)
+	 */
+	template <bool perCellParams>
+	void fluxBatchKernel(unsigned int nCells, unsigned int nSites, double const* kA, double const* kD, double const* qMax, double const* y, double const* yCp, double* res, double* qSum) const
+	{
+		const unsigned int pStride = perCellParams ? nCells : 1;
+		const unsigned int sliceSize = _nComp * pStride;
+
+		// Loop over all binding site types, the bound state of component bndIdx at site is stored in row bndIdx * nSites + site
+		for (unsigned int site = 0; site < nSites; ++site)
+		{
+			double const* const siteKa = kA + site * sliceSize;
+			double const* const siteKd = kD + site * sliceSize;
+			double const* const siteQmax = qMax + site * sliceSize;
+
+			std::fill_n(qSum, nCells, 1.0);
+
+			unsigned int bndIdx = 0;
+			for (int i = 0; i < _nComp; ++i)
+			{
+				// Skip components without bound states (bound state index bndIdx is not advanced)
+				if (_nBoundStates[i] == 0)
+					continue;
+
+				double const* const q = y + (bndIdx * nSites + site) * nCells;
+				double const* const localQmax = siteQmax + i * pStride;
+				for (unsigned int k = 0; k < nCells; ++k)
+					qSum[k] -= q[k] / localQmax[perCellParams ? k : 0];
+
+				// Next bound component
+				++bndIdx;
+			}
+
+			bndIdx = 0;
+			for (int i = 0; i < _nComp; ++i)
+			{
+				// Skip components without bound states (bound state index bndIdx is not advanced)
+				if (_nBoundStates[i] == 0)
+					continue;
+
+				double const* const q = y + (bndIdx * nSites + site) * nCells;
+				double const* const cp = yCp + i * nCells;
+				double* const localRes = res + (bndIdx * nSites + site) * nCells;
+				double const* const localKa = siteKa + i * pStride;
+				double const* const localKd = siteKd + i * pStride;
+				double const* const localQmax = siteQmax + i * pStride;
+				for (unsigned int k = 0; k < nCells; ++k)
+				{
+					const unsigned int pk = perCellParams ? k : 0;
+					localRes[k] = localKd[pk] * q[k] - localKa[pk] * cp[k] * localQmax[pk] * qSum[k];
+				}
+
+				// Next bound component
+				++bndIdx;
+			}
+		}
+	}
+
 	template <typename RowIterator>
 	void jacobianImpl(double t, unsigned int secIdx, const ColumnPosition& colPos, double const* y, double const* yCp, int offsetCp, RowIterator jac, LinearBufferAllocator workSpace) const
 	{
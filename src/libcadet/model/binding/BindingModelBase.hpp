@@ -82,6 +82,12 @@ public:
 	}
 
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { }
+	virtual void updateExternalFunctionCache(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nPositions) { }
+	virtual void invalidateExternalFunctionCache() { }
+
+	virtual bool supportsFluxBatch() const CADET_NOEXCEPT { return false; }
+	virtual unsigned int fluxBatchWorkspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates, unsigned int nCells) const CADET_NOEXCEPT { return 0; }
+	virtual int fluxBatch(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nCells, double const* y, double const* yCp, double* res, LinearBufferAllocator workSpace) const { return -1; }
 
 	virtual void timeDerivativeQuasiStationaryFluxes(double t, unsigned int secIdx, const ColumnPosition& colPos, double const* yCp, double const* y, double* dResDt, LinearBufferAllocator workSpace) const { }
 
@@ -169,6 +175,8 @@ public:
 
 	virtual const char* name() const CADET_NOEXCEPT { return handler_t::identifier(); }
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _paramHandler.setExternalFunctions(extFuns, size); }
+	virtual void updateExternalFunctionCache(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nPositions) { _paramHandler.updateExternalFunctionCache(t, secIdx, colPos, nPositions); }
+	virtual void invalidateExternalFunctionCache() { _paramHandler.invalidateExternalFunctionCache(); }
 	virtual bool dependsOnTime() const CADET_NOEXCEPT { return handler_t::dependsOnTime(); }
 	virtual bool requiresWorkspace() const CADET_NOEXCEPT { return handler_t::requiresWorkspace() || BindingModelBase::requiresWorkspace(); }
 
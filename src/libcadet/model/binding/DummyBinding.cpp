@@ -121,7 +121,17 @@ public:
 		return 0;
 	}
 
+	virtual bool supportsFluxBatch() const CADET_NOEXCEPT { return false; }
+	virtual unsigned int fluxBatchWorkspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates, unsigned int nCells) const CADET_NOEXCEPT { return 0; }
+
+	virtual int fluxBatch(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nCells, double const* y, double const* yCp, double* res, LinearBufferAllocator workSpace) const
+	{
+		return 0;
+	}
+
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { }
+	virtual void updateExternalFunctionCache(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nPositions) { }
+	virtual void invalidateExternalFunctionCache() { }
 
 	virtual void analyticJacobian(double t, unsigned int secIdx, const ColumnPosition& colPos, double const* y, int offsetCp, linalg::BandMatrix::RowIterator jac, LinearBufferAllocator workSpace) const
 	{
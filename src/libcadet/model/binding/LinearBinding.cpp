@@ -516,6 +516,8 @@ public:
 	}
 
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _paramHandler.setExternalFunctions(extFuns, size); }
+	virtual void updateExternalFunctionCache(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nPositions) { _paramHandler.updateExternalFunctionCache(t, secIdx, colPos, nPositions); }
+	virtual void invalidateExternalFunctionCache() { _paramHandler.invalidateExternalFunctionCache(); }
 
 	// The next three flux() function implementations and two analyticJacobian() function
 	// implementations are usually hidden behind
@@ -546,6 +548,14 @@ public:
 		return fluxImpl<double, double, double>(t, secIdx, colPos, y, yCp, res, workSpace);
 	}
 
+	virtual bool supportsFluxBatch() const CADET_NOEXCEPT { return false; }
+	virtual unsigned int fluxBatchWorkspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates, unsigned int nCells) const CADET_NOEXCEPT { return 0; }
+
+	virtual int fluxBatch(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nCells, double const* y, double const* yCp, double* res, LinearBufferAllocator workSpace) const
+	{
+		return -1;
+	}
+
 	virtual void analyticJacobian(double t, unsigned int secIdx, const ColumnPosition& colPos, double const* y, int offsetCp, linalg::BandMatrix::RowIterator jac, LinearBufferAllocator workSpace) const
 	{
 		jacobianImpl(t, secIdx, colPos, y, offsetCp, jac, workSpace);
@@ -18,6 +18,7 @@
 #include "LocalVector.hpp"
 #include "SimulationTypes.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <unordered_map>
 #include <string>
@@ -119,6 +120,55 @@ public:
 		return res;
 	}
 
+	virtual bool supportsFluxBatch() const CADET_NOEXCEPT { return true; }
+
+	virtual unsigned int fluxBatchWorkspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates, unsigned int nCells) const CADET_NOEXCEPT
+	{
+		// Parameters kA, kD, qMax, gamma, beta, linearThreshold (shared by all cells or per cell if externally dependent),
+		// qSum of each cell, and parameter cache
+		const unsigned int nParamCells = ParamHandler_t::dependsOnTime() ? nCells : 1;
+		return ((5 * nComp + 1) * nParamCells + nCells) * sizeof(double) + 2 * alignof(double) + _paramHandler.cacheSize(nComp, totalNumBoundStates, nBoundStates);
+	}
+
+	virtual int fluxBatch(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nCells, double const* y, double const* yCp, double* res, LinearBufferAllocator workSpace) const
+	{
+		const unsigned int nParamCells = ParamHandler_t::dependsOnTime() ? nCells : 1;
+		BufferedArray<double> params = workSpace.array<double>((5 * _nComp + 1) * nParamCells);
+		BufferedArray<double> qSum = workSpace.array<double>(nCells);
+
+		double* const kA = static_cast<double*>(params);
+		double* const kD = kA + _nComp * nParamCells;
+		double* const qMax = kD + _nComp * nParamCells;
+		double* const gamma = qMax + _nComp * nParamCells;
+		double* const beta = gamma + _nComp * nParamCells;
+		double* const linearThreshold = beta + _nComp * nParamCells;
+
+		// Gather parameters in structure-of-arrays layout
+		for (unsigned int k = 0; k < nParamCells; ++k)
+		{
+			LinearBufferAllocator cellWorkSpace = workSpace;
+			typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos[k], _nComp, _nBoundStates, cellWorkSpace);
+
+			for (int i = 0; i < _nComp; ++i)
+			{
+				kA[i * nParamCells + k] = static_cast<double>(p->kA[i]);
+				kD[i * nParamCells + k] = static_cast<double>(p->kD[i]);
+				qMax[i * nParamCells + k] = static_cast<double>(p->qMax[i]);
+				gamma[i * nParamCells + k] = static_cast<double>(p->gamma[i]);
+				beta[i * nParamCells + k] = static_cast<double>(p->beta[i]);
+			}
+
+			linearThreshold[k] = static_cast<double>(p->linearThreshold);
+		}
+
+		if (ParamHandler_t::dependsOnTime())
+			fluxBatchKernel<true>(nCells, kA, kD, qMax, gamma, beta, linearThreshold, y, yCp, res, static_cast<double*>(qSum));
+		else
+			fluxBatchKernel<false>(nCells, kA, kD, qMax, gamma, beta, linearThreshold, y, yCp, res, static_cast<double*>(qSum));
+
+		return 0;
+	}
+
 	CADET_BINDINGMODELBASE_BOILERPLATE
 
 protected:
@@ -194,6 +244,84 @@ protected:
 		return 0;
 	}
 
+	/**
+	 * @brief Evaluates the fluxes of all cells in structure-of-arrays layout
+	 * @details The innermost loops run over the cells, which allows the compiler to vectorize them.
+	 * @tparam perCellParams Determines whether the parameters are given for each cell (@c true) or shared by all cells (@c false)
+	 */
+	template <bool perCellParams>
+	void fluxBatchKernel(unsigned int nCells, double const* kA, double const* kD, double const* qMax, double const* gamma, double const* beta,
+		double const* linearThreshold, double const* y, double const* yCp, double* res, double* qSum) const
+	{
+		const unsigned int pStride = perCellParams ? nCells : 1;
+		std::fill_n(qSum, nCells, 1.0);
+
+		unsigned int bndIdx = 0;
+		if (_nBoundStates[0] == 1)
+			bndIdx = 1;
+
+		for (int i = 1; i < _nComp; ++i)
+		{
+			// Skip components without bound states (bound state index bndIdx is not advanced)
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			double const* const q = y + bndIdx * nCells;
+			double const* const localQmax = qMax + i * pStride;
+			for (unsigned int k = 0; k < nCells; ++k)
+				qSum[k] -= q[k] / localQmax[perCellParams ? k : 0];
+
+			// Next bound component
+			++bndIdx;
+		}
+
+		// Handle salt flux
+		bndIdx = 0;
+		if (_nBoundStates[0] == 1)
+		{
+			std::fill_n(res, nCells, 0.0);
+			bndIdx = 1;
+		}
+
+		// Handle protein fluxes
+		for (int i = 1; i < _nComp; ++i)
+		{
+			// Skip components without bound states (bound state index bndIdx is not advanced)
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			double const* const q = y + bndIdx * nCells;
+			double const* const cp = yCp + i * nCells;
+			double* const localRes = res + bndIdx * nCells;
+			double const* const localKa = kA + i * pStride;
+			double const* const localKd = kD + i * pStride;
+			double const* const localQmax = qMax + i * pStride;
+			double const* const localGamma = gamma + i * pStride;
+			double const* const localBeta = beta + i * pStride;
+			for (unsigned int k = 0; k < nCells; ++k)
+			{
+				const unsigned int pk = perCellParams ? k : 0;
+				const double cp0 = yCp[k];
+				const double alpha = localKa[pk] * cp[k] * localQmax[pk] * qSum[k];
+
+				if (cp0 <= linearThreshold[pk])
+				{
+					// Linearize
+					const double thr = linearThreshold[pk];
+					const double fThreshold = localKd[pk] * pow(thr, localBeta[pk]) * q[k] - alpha * exp(thr * localGamma[pk]);
+					const double fdThreshold = localKd[pk] * pow(thr, localBeta[pk] - 1) * localBeta[pk] * q[k] - alpha * exp(thr * localGamma[pk]) * localGamma[pk];
+
+					localRes[k] = fThreshold + fdThreshold * (cp0 - thr);
+				}
+				else
+					localRes[k] = localKd[pk] * pow(cp0, localBeta[pk]) * q[k] - alpha * exp(cp0 * localGamma[pk]);
+			}
+
+			// Next bound component
+			++bndIdx;
+		}
+	}
+
 	template <typename RowIterator>
 	void jacobianImpl(double t, unsigned int secIdx, const ColumnPosition& colPos, double const* y, double const* yCp, int offsetCp, RowIterator jac, LinearBufferAllocator workSpace) const
 	{
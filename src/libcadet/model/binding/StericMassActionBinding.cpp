@@ -20,6 +20,7 @@
 #include "LocalVector.hpp"
 #include "SimulationTypes.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <unordered_map>
 #include <string>
@@ -163,6 +164,56 @@ public:
 		preConsistentInitialState(t, secIdx, colPos, y, yCp, workSpace);
 	}
 
+	virtual bool supportsFluxBatch() const CADET_NOEXCEPT { return true; }
+
+	virtual unsigned int fluxBatchWorkspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates, unsigned int nCells) const CADET_NOEXCEPT
+	{
+		// Parameters kA, kD, nu, sigma, lambda, refC0, refQ (shared by all cells or per cell if externally dependent),
+		// \bar{q}_0 and c_{p,0} / refC0 of each cell, and parameter cache
+		const unsigned int nParamCells = ParamHandler_t::dependsOnTime() ? nCells : 1;
+		return ((4 * nComp + 3) * nParamCells + 2 * nCells) * sizeof(double) + 2 * alignof(double) + _paramHandler.cacheSize(nComp, totalNumBoundStates, nBoundStates);
+	}
+
+	virtual int fluxBatch(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nCells, double const* y, double const* yCp, double* res, LinearBufferAllocator workSpace) const
+	{
+		const unsigned int nParamCells = ParamHandler_t::dependsOnTime() ? nCells : 1;
+		BufferedArray<double> params = workSpace.array<double>((4 * _nComp + 3) * nParamCells);
+		BufferedArray<double> temp = workSpace.array<double>(2 * nCells);
+
+		double* const kA = static_cast<double*>(params);
+		double* const kD = kA + _nComp * nParamCells;
+		double* const nu = kD + _nComp * nParamCells;
+		double* const sigma = nu + _nComp * nParamCells;
+		double* const lambda = sigma + _nComp * nParamCells;
+		double* const refC0 = lambda + nParamCells;
+		double* const refQ = refC0 + nParamCells;
+
+		// Gather parameters in structure-of-arrays layout
+		for (unsigned int k = 0; k < nParamCells; ++k)
+		{
+			LinearBufferAllocator cellWorkSpace = workSpace;
+			typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos[k], _nComp, _nBoundStates, cellWorkSpace);
+
+			for (int i = 0; i < _nComp; ++i)
+			{
+				kA[i * nParamCells + k] = static_cast<double>(p->kA[i]);
+				kD[i * nParamCells + k] = static_cast<double>(p->kD[i]);
+				nu[i * nParamCells + k] = static_cast<double>(p->nu[i]);
+				sigma[i * nParamCells + k] = static_cast<double>(p->sigma[i]);
+			}
+
+			lambda[k] = static_cast<double>(p->lambda);
+			refC0[k] = static_cast<double>(p->refC0);
+			refQ[k] = static_cast<double>(p->refQ);
+		}
+
+		if (ParamHandler_t::dependsOnTime())
+			fluxBatchKernel<true>(nCells, kA, kD, nu, sigma, lambda, refC0, refQ, y, yCp, res, static_cast<double*>(temp));
+		else
+			fluxBatchKernel<false>(nCells, kA, kD, nu, sigma, lambda, refC0, refQ, y, yCp, res, static_cast<double*>(temp));
+
+		return 0;
+	}
 
 	CADET_BINDINGMODELBASE_BOILERPLATE
 
@@ -230,6 +281,79 @@ protected:
 		return 0;
 	}
 
+	/**
+	 * @brief Evaluates the fluxes of all cells in structure-of-arrays layout
+	 * @details The innermost loops run over the cells and are free of branches, which allows the compiler to vectorize them.
+	 * @tparam perCellParams Determines whether the parameters are given for each cell (@c true) or shared by all cells (@c false)
+	 */
+	template <bool perCellParams>
+	void fluxBatchKernel(unsigned int nCells, double const* kA, double const* kD, double const* nu, double const* sigma, double const* lambda,
+		double const* refC0, double const* refQ, double const* y, double const* yCp, double* res, double* temp) const
+	{
+		const unsigned int pStride = perCellParams ? nCells : 1;
+		double* const q0_bar = temp;
+		double* const yCp0_divRef = temp + nCells;
+
+		// Salt flux: nu_0 * q_0 - Lambda + Sum[nu_j * q_j, j] == 0
+		// Also compute \bar{q}_0 = nu_0 * q_0 - Sum[sigma_j * q_j, j]
+		for (unsigned int k = 0; k < nCells; ++k)
+		{
+			const unsigned int pk = perCellParams ? k : 0;
+			res[k] = nu[pk] * y[k] - lambda[pk];
+			q0_bar[k] = nu[pk] * y[k];
+			yCp0_divRef[k] = yCp[k] / refC0[pk];
+		}
+
+		unsigned int bndIdx = 1;
+		for (int j = 1; j < _nComp; ++j)
+		{
+			// Skip components without bound states (bound state index bndIdx is not advanced)
+			if (_nBoundStates[j] == 0)
+				continue;
+
+			double const* const q = y + bndIdx * nCells;
+			double const* const localNu = nu + j * pStride;
+			double const* const localSigma = sigma + j * pStride;
+			for (unsigned int k = 0; k < nCells; ++k)
+			{
+				const unsigned int pk = perCellParams ? k : 0;
+				res[k] += localNu[pk] * q[k];
+				q0_bar[k] -= localSigma[pk] * q[k];
+			}
+
+			// Next bound component
+			++bndIdx;
+		}
+
+		// Protein fluxes: -k_{a,i} * c_{p,i} * \bar{q}_0^{nu_i / nu_0} + k_{d,i} * q_i * c_{p,0}^{nu_i / nu_0}
+		bndIdx = 1;
+		for (int i = 1; i < _nComp; ++i)
+		{
+			// Skip components without bound states (bound state index bndIdx is not advanced)
+			if (_nBoundStates[i] == 0)
+				continue;
+
+			double const* const q = y + bndIdx * nCells;
+			double const* const cp = yCp + i * nCells;
+			double* const localRes = res + bndIdx * nCells;
+			double const* const localKa = kA + i * pStride;
+			double const* const localKd = kD + i * pStride;
+			double const* const localNu = nu + i * pStride;
+			for (unsigned int k = 0; k < nCells; ++k)
+			{
+				const unsigned int pk = perCellParams ? k : 0;
+				const double nu_over_nu0 = localNu[pk] / nu[pk];
+				const double c0_pow_nu = pow(yCp0_divRef[k], nu_over_nu0);
+				const double q0_bar_pow_nu = pow(q0_bar[k] / refQ[pk], nu_over_nu0);
+
+				localRes[k] = localKd[pk] * q[k] * c0_pow_nu - localKa[pk] * cp[k] * q0_bar_pow_nu;
+			}
+
+			// Next bound component
+			++bndIdx;
+		}
+	}
+
 	template <typename RowIterator>
 	void jacobianImpl(double t, unsigned int secIdx, const ColumnPosition& colPos, double const* y, double const* yCp, int offsetCp, RowIterator jac, LinearBufferAllocator workSpace) const
 	{
@@ -98,9 +98,62 @@ public:
 		// We now have to compute the time point when the column outlet will reach
 		// the requested position subject to the velocity _velocity.
 
-		// Compute transformed time
-		const double transT = (1.0 - z) / _velocity + t;
+		// Interpolate at the transformed time
+		std::size_t idx = 0;
+		return evaluate((1.0 - z) / _velocity + t, idx);
+	}
+
+	virtual double timeDerivative(double t, double z, double rho, double r, unsigned int sec)
+	{
+		std::size_t idx = 0;
+		return evaluateDerivative((1.0 - z) / _velocity + t, idx);
+	}
+
+	virtual void externalProfileBatch(double t, double const* z, double const* rho, double const* r, unsigned int n, unsigned int sec, double* out)
+	{
+		// Neighboring positions are likely located in the same interval
+		std::size_t idx = 0;
+		for (unsigned int i = 0; i < n; ++i)
+			out[i] = evaluate((1.0 - z[i]) / _velocity + t, idx);
+	}
+
+	virtual void timeDerivativeBatch(double t, double const* z, double const* rho, double const* r, unsigned int n, unsigned int sec, double* out)
+	{
+		std::size_t idx = 0;
+		for (unsigned int i = 0; i < n; ++i)
+			out[i] = evaluateDerivative((1.0 - z[i]) / _velocity + t, idx);
+	}
+
+private:
+	double _velocity; //!< Velocity of the movement of the external profile in [1/s] (normalized by column length)
+	std::vector<double> _dataY; //!< External profile data points (function values)
+	std::vector<double> _time; //!< Time point of each measurement in [s]
+
+	/**
+	 * @brief Returns the index of the interval <tt>[_time[idx], _time[idx+1]]</tt> in which @p transT is located
+	 * @details The interval given by @p hint is checked first, which avoids the binary search if
+	 *          consecutive evaluations are close to each other.
+	 * @param [in] transT Transformed time inside the data range
+	 * @param [in] hint Index of a candidate interval
+	 * @return Index of the left data point of the interval
+	 */
+	inline std::size_t findInterval(double transT, std::size_t hint) const
+	{
+		if ((hint + 1 < _time.size()) && (_time[hint] <= transT) && (transT < _time[hint + 1]))
+			return hint;
+
+		const std::vector<double>::const_iterator it = std::lower_bound(_time.begin(), _time.end(), transT);
+		return (it - _time.begin()) - (*it > transT ? 1 : 0);
+	}
 
+	/**
+	 * @brief Evaluates the interpolated profile at the given transformed time
+	 * @param [in] transT Transformed time
+	 * @param [in,out] idx On entry, a candidate interval index, on exit the index of the interval used
+	 * @return Function value
+	 */
+	inline double evaluate(double transT, std::size_t& idx) const
+	{
 		// Use constant extrapolation on both sides of the external profile
 		if (transT <= _time[0])
 			return _dataY.front();
@@ -108,21 +161,21 @@ public:
 			return _dataY.back();
 
 		// In the middle use linear interpolation
-
-		// Find the the interval [_time[idx], _time[idx+1]] in which transT is located
-		const std::vector<double>::iterator it = std::lower_bound(_time.begin(), _time.end(), transT);
-		const std::size_t idx = (it - _time.begin()) - (*it > transT ? 1 : 0);
+		idx = findInterval(transT, idx);
 
 		// Now idx is the index of the left and idx + 1 is the index of the right data point
 		// Perform linear interpolation
 		return _dataY[idx] + (_dataY[idx + 1] - _dataY[idx]) * (transT - _time[idx]) / (_time[idx + 1] - _time[idx]);
 	}
 
-	virtual double timeDerivative(double t, double z, double rho, double r, unsigned int sec)
+	/**
+	 * @brief Evaluates the time derivative of the interpolated profile at the given transformed time
+	 * @param [in] transT Transformed time
+	 * @param [in,out] idx On entry, a candidate interval index, on exit the index of the interval used
+	 * @return Time derivative
+	 */
+	inline double evaluateDerivative(double transT, std::size_t& idx) const
 	{
-		// Compute transformed time
-		const double transT = (1.0 - z) / _velocity + t;
-
 		// Use constant extrapolation on both sides of the external profile => slope is 0.0
 		if (transT <= _time[0])
 			return 0.0;
@@ -130,20 +183,12 @@ public:
 			return 0.0;
 
 		// In the middle use linear interpolation
-
-		// Find the the interval [_time[idx], _time[idx+1]] in which transT is located
-		const std::vector<double>::iterator it = std::lower_bound(_time.begin(), _time.end(), transT);
-		const std::size_t idx = (it - _time.begin()) - (*it > transT ? 1 : 0);
+		idx = findInterval(transT, idx);
 
 		// Now idx is the index of the left and idx + 1 is the index of the right data point
 		// Return slope of linear interpolation
 		return (_dataY[idx + 1] - _dataY[idx]) / (_time[idx + 1] - _time[idx]);
 	}
-
-private:
-	double _velocity; //!< Velocity of the movement of the external profile in [1/s] (normalized by column length)
-	std::vector<double> _dataY; //!< External profile data points (function values)
-	std::vector<double> _time; //!< Time point of each measurement in [s]
 };
 
 namespace extfun
@@ -77,9 +77,68 @@ public:
 
 	virtual double externalProfile(double t, double z, double rho, double r, unsigned int sec)
 	{
-		// Compute transformed time and find index of the section
-		const double transT = (1.0 - z) / _velocity + t;
+		// Compute transformed time and evaluate polynomial of its section
+		std::size_t idx = 0;
+		return evaluate((1.0 - z) / _velocity + t, idx);
+	}
+
+	virtual double timeDerivative(double t, double z, double rho, double r, unsigned int sec)
+	{
+		std::size_t idx = 0;
+		return evaluateDerivative((1.0 - z) / _velocity + t, idx);
+	}
+
+	virtual void externalProfileBatch(double t, double const* z, double const* rho, double const* r, unsigned int n, unsigned int sec, double* out)
+	{
+		// Neighboring positions are likely located in the same section
+		std::size_t idx = 0;
+		for (unsigned int i = 0; i < n; ++i)
+			out[i] = evaluate((1.0 - z[i]) / _velocity + t, idx);
+	}
+
+	virtual void timeDerivativeBatch(double t, double const* z, double const* rho, double const* r, unsigned int n, unsigned int sec, double* out)
+	{
+		std::size_t idx = 0;
+		for (unsigned int i = 0; i < n; ++i)
+			out[i] = evaluateDerivative((1.0 - z[i]) / _velocity + t, idx);
+	}
+
+	virtual void setSectionTimes(double const* secTimes, bool const* secContinuity, unsigned int nSections) CADET_NOEXCEPT { }
+
+private:
+	double _velocity; //!< Velocity of the movement of the external profile in [1/s] (normalized by column length)
+	std::vector<double> _sectionTimes; //!< Section times
+
+	std::vector<double> _const; //!< Constant coefficient of each polynomial piece
+	std::vector<double> _lin; //!< Linear coefficient of each polynomial piece
+	std::vector<double> _quad; //!< Quadratic coefficient of each polynomial piece
+	std::vector<double> _cub; //!< Cubic coefficient of each polynomial piece
+
+	/**
+	 * @brief Returns the index of the section <tt>[_sectionTimes[idx], _sectionTimes[idx+1]]</tt> in which @p transT is located
+	 * @details The section given by @p hint is checked first, which avoids the binary search if
+	 *          consecutive evaluations are close to each other.
+	 * @param [in] transT Transformed time inside the covered time range
+	 * @param [in] hint Index of a candidate section
+	 * @return Index of the section
+	 */
+	inline std::size_t findSection(double transT, std::size_t hint) const
+	{
+		if ((hint + 1 < _sectionTimes.size()) && (_sectionTimes[hint] <= transT) && (transT < _sectionTimes[hint + 1]))
+			return hint;
+
+		const std::vector<double>::const_iterator it = std::lower_bound(_sectionTimes.begin(), _sectionTimes.end(), transT);
+		return (it - _sectionTimes.begin()) - (*it > transT ? 1 : 0);
+	}
 
+	/**
+	 * @brief Evaluates the piecewise polynomial at the given transformed time
+	 * @param [in] transT Transformed time
+	 * @param [in,out] idx On entry, a candidate section index, on exit the index of the section used
+	 * @return Function value
+	 */
+	inline double evaluate(double transT, std::size_t& idx) const
+	{
 		// If we don't have data, perform constant extrapolation
 		if (transT <= _sectionTimes[0])
 			return _const[0];
@@ -91,8 +150,7 @@ public:
 		}
 
 		// Find the the interval [_sectionTimes[idx], _sectionTimes[idx+1]] in which transT is located
-		const std::vector<double>::iterator it = std::lower_bound(_sectionTimes.begin(), _sectionTimes.end(), transT);
-		const std::size_t idx = (it - _sectionTimes.begin()) - (*it > transT ? 1 : 0);
+		idx = findSection(transT, idx);
 
 		// This function evaluates a piecewise cubic polynomial given on some intervals
 		// called sections. On each section a polynomial of degree 3 is evaluated:
@@ -107,11 +165,14 @@ public:
 		return _const[idx] + tShift * (_lin[idx] + tShift * (_quad[idx] + tShift * _cub[idx]));
 	}
 
-	virtual double timeDerivative(double t, double z, double rho, double r, unsigned int sec)
+	/**
+	 * @brief Evaluates the time derivative of the piecewise polynomial at the given transformed time
+	 * @param [in] transT Transformed time
+	 * @param [in,out] idx On entry, a candidate section index, on exit the index of the section used
+	 * @return Time derivative
+	 */
+	inline double evaluateDerivative(double transT, std::size_t& idx) const
 	{
-		// Compute transformed time and find index of the section
-		const double transT = (1.0 - z) / _velocity + t;
-
 		// If we don't have data, perform constant extrapolation
 		if (transT <= _sectionTimes[0])
 			return 0.0;
@@ -119,8 +180,7 @@ public:
 			return 0.0;
 
 		// Find the the interval [_sectionTimes[idx], _sectionTimes[idx+1]] in which transT is located
-		const std::vector<double>::iterator it = std::lower_bound(_sectionTimes.begin(), _sectionTimes.end(), transT);
-		const std::size_t idx = (it - _sectionTimes.begin()) - (*it > transT ? 1 : 0);
+		idx = findSection(transT, idx);
 
 		// This function evaluates a piecewise cubic polynomial given on some intervals
 		// called sections. On each section a polynomial of degree 3 is evaluated:
@@ -135,17 +195,6 @@ public:
 		// Evaluate polynomial using Horner's scheme
 		return _lin[idx] + tShift * (2.0 * _quad[idx] + tShift * 3.0 * _cub[idx]);
 	}
-
-	virtual void setSectionTimes(double const* secTimes, bool const* secContinuity, unsigned int nSections) CADET_NOEXCEPT { }
-
-private:
-	double _velocity; //!< Velocity of the movement of the external profile in [1/s] (normalized by column length)
-	std::vector<double> _sectionTimes; //!< Section times
-
-	std::vector<double> _const; //!< Constant coefficient of each polynomial piece
-	std::vector<double> _lin; //!< Linear coefficient of each polynomial piece
-	std::vector<double> _quad; //!< Quadratic coefficient of each polynomial piece
-	std::vector<double> _cub; //!< Cubic coefficient of each polynomial piece
 };
 
 namespace extfun
@@ -56,6 +56,8 @@ struct AxialFlowParameters
 	unsigned int offsetToBulk; //!< Offset to the first component of the first bulk cell in the local state vector
 	IParameterParameterDependence* parDep;
 	const IModel& model;
+	ArrayPool* wenoBatchMemory = nullptr; //!< Provides memory for reconstructing all faces of a component at once, disables batch reconstruction if @c nullptr
+	double* wenoBatchDerivatives = nullptr; //!< Holds derivatives of the WENO scheme for all cells (batch reconstruction only)
 };
 
 
@@ -80,6 +82,22 @@ namespace impl
 		ResidualType* const resBulk = wantRes ? res + p.offsetToBulk : nullptr;
 		StateType const* const yBulk = y + p.offsetToBulk;
 
+		// Batch reconstruction uses a contiguous copy of the bulk volume averages padded with zeros on both sides
+		const bool batchWeno = (p.wenoBatchMemory != nullptr);
+		const unsigned int wenoPad = Weno::maxOrder() - 1;
+		StateType* batchAvg = nullptr;
+		StateType* batchFaces = nullptr;
+		if (batchWeno)
+		{
+			batchAvg = p.wenoBatchMemory->template create<StateType>(2 * p.nCol + 2 * wenoPad);
+			batchFaces = batchAvg + p.nCol + 2 * wenoPad;
+			for (unsigned int i = 0; i < wenoPad; ++i)
+			{
+				batchAvg[i] = 0.0;
+				batchAvg[p.nCol + wenoPad + i] = 0.0;
+			}
+		}
+
 		for (unsigned int comp = 0; comp < p.nComp; ++comp)
 		{
 			if (wantJac)
@@ -109,9 +127,19 @@ namespace impl
 
 			// Reset WENO output
 			StateType vm(0.0); // reconstructed value
+			double* wenoDerivatives = p.wenoDerivatives;
 			if (wantJac)
 				std::fill(p.wenoDerivatives, p.wenoDerivatives + p.weno->stencilSize(), 0.0);
 
+			// Reconstruct all right faces of this component in one pass
+			if (batchWeno)
+			{
+				for (unsigned int col = 0; col < p.nCol; ++col)
+					batchAvg[wenoPad + col] = yBulkComp[col * p.strideCell];
+
+				p.weno->template reconstructBatch<StateType, wantJac>(p.wenoEpsilon, p.nCol, batchAvg, batchFaces, p.wenoBatchDerivatives);
+			}
+
 			int wenoOrder = 0;
 			const ParamType d_ax = static_cast<ParamType>(p.d_ax[comp]);
 
@@ -166,7 +194,7 @@ namespace impl
 						for (int i = 0; i < 2 * wenoOrder - 1; ++i)
 							// Note that we have an offset of -1 here (compared to the right cell face below), since
 							// the reconstructed value depends on the previous stencil (which has now been moved by one cell)
-							jac[(i - wenoOrder) * p.strideCell] -= static_cast<double>(p.u) / static_cast<double>(p.h) * p.wenoDerivatives[i];
+							jac[(i - wenoOrder) * p.strideCell] -= static_cast<double>(p.u) / static_cast<double>(p.h) * wenoDerivatives[i];
 					}
 				}
 				else if (wantRes)
@@ -176,8 +204,15 @@ namespace impl
 				}
 
 				// Reconstruct concentration on this cell's right face
-				if (wantJac)
-					wenoOrder = p.weno->template reconstruct<StateType, StencilType>(p.wenoEpsilon, col, p.nCol, stencil, vm, p.wenoDerivatives);
+				if (batchWeno)
+				{
+					vm = batchFaces[col];
+					wenoOrder = p.weno->localOrder(col, p.nCol);
+					if (wantJac)
+						wenoDerivatives = p.wenoBatchDerivatives + col * p.weno->stencilSize();
+				}
+				else if (wantJac)
+					wenoOrder = p.weno->template reconstruct<StateType, StencilType>(p.wenoEpsilon, col, p.nCol, stencil, vm, wenoDerivatives);
 				else
 					wenoOrder = p.weno->template reconstruct<StateType, StencilType>(p.wenoEpsilon, col, p.nCol, stencil, vm);
 
@@ -188,7 +223,7 @@ namespace impl
 				if (wantJac)
 				{
 					for (int i = 0; i < 2 * wenoOrder - 1; ++i)
-						jac[(i - wenoOrder + 1) * p.strideCell] += static_cast<double>(p.u) / static_cast<double>(p.h) * p.wenoDerivatives[i];
+						jac[(i - wenoOrder + 1) * p.strideCell] += static_cast<double>(p.u) / static_cast<double>(p.h) * wenoDerivatives[i];
 				}
 
 				// Update stencil
@@ -206,6 +241,9 @@ namespace impl
 			}
 		}
 
+		if (batchWeno)
+			p.wenoBatchMemory->template destroy<StateType>();
+
 		// Film diffusion with flux into beads is added in residualFlux() function
 
 		return 0;
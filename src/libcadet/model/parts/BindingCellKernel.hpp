@@ -78,7 +78,7 @@ struct CellParameters
 	IDynamicReactionModel* dynReaction;
 };
 
-template <typename StateType, typename ResidualType, typename ParamType, typename KernelParamsType, typename RowIteratorType, bool wantJac, bool handleMobilePhaseDerivative, bool wantRes = true>
+template <typename StateType, typename ResidualType, typename ParamType, typename KernelParamsType, typename RowIteratorType, bool wantJac, bool handleMobilePhaseDerivative, bool wantRes = true, bool wantBinding = true>
 void residualKernel(double t, unsigned int secIdx, const ColumnPosition& colPos, StateType const* y,
 	double const* yDot, ResidualType* res, RowIteratorType jacBase, const KernelParamsType& params, LinearBufferAllocator buffer)
 {
@@ -125,8 +125,8 @@ void residualKernel(double t, unsigned int secIdx, const ColumnPosition& colPos,
 
 	// Solid phase
 
-	// Binding
-	if (wantRes)
+	// Binding (skipped if the fluxes have already been computed by bindingFluxBatch())
+	if (wantRes && wantBinding)
 		bindingFlux(t, secIdx, colPos, y, res, params, buffer, typename ParamSens<ParamType>::enabled());
 
 	if (wantJac)
@@ -223,6 +223,68 @@ void residualKernel(double t, unsigned int secIdx, const ColumnPosition& colPos,
 	}
 }
 
+/**
+ * @brief Evaluates the binding fluxes of multiple particle cells using IBindingModel::fluxBatch()
+ * @details The mobile and solid phase states of all cells are gathered into structure-of-arrays layout,
+ *          the fluxes are computed in one call, and the results are written to the solid phase residual
+ *          of each cell. Afterwards, residualKernel() has to be called with @c wantBinding set to @c false.
+ *
+ *          The cells are assumed to be equally spaced in the state and residual vector.
+ * @param [in] t Current time point
+ * @param [in] secIdx Index of the current section
+ * @param [in] colPos Array with positions of the cells
+ * @param [in] nCells Number of cells
+ * @param [in] strideCell Distance between two consecutive cells in @p y and @p res
+ * @param [in] y Pointer to the mobile phase of the first cell
+ * @param [out] res Pointer to the mobile phase residual of the first cell
+ * @param [in] params Cell parameters
+ * @param [in,out] buffer Memory buffer of size bindingFluxBatchMemorySize()
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ */
+template <typename KernelParamsType>
+int bindingFluxBatch(double t, unsigned int secIdx, ColumnPosition const* colPos, unsigned int nCells, int strideCell, double const* y,
+	double* res, const KernelParamsType& params, LinearBufferAllocator buffer)
+{
+	BufferedArray<double> stateBuffer = buffer.template array<double>(nCells * (params.nComp + 2 * params.nTotalBound));
+	double* const yCpBatch = static_cast<double*>(stateBuffer);
+	double* const yBatch = yCpBatch + nCells * params.nComp;
+	double* const resBatch = yBatch + nCells * params.nTotalBound;
+
+	for (unsigned int k = 0; k < nCells; ++k)
+	{
+		double const* const yCell = y + k * strideCell;
+		for (unsigned int i = 0; i < params.nComp; ++i)
+			yCpBatch[i * nCells + k] = yCell[i];
+		for (unsigned int i = 0; i < params.nTotalBound; ++i)
+			yBatch[i * nCells + k] = yCell[params.nComp + i];
+	}
+
+	const int retCode = params.binding->fluxBatch(t, secIdx, colPos, nCells, yBatch, yCpBatch, resBatch, buffer);
+
+	for (unsigned int k = 0; k < nCells; ++k)
+	{
+		double* const resCell = res + k * strideCell + params.nComp;
+		for (unsigned int i = 0; i < params.nTotalBound; ++i)
+			resCell[i] = resBatch[i * nCells + k];
+	}
+
+	return retCode;
+}
+
+/**
+ * @brief Returns the size of the memory buffer required by bindingFluxBatch() in bytes
+ * @param [in] binding Binding model
+ * @param [in] nComp Number of components
+ * @param [in] nTotalBound Total number of bound states
+ * @param [in] nBound Array with number of bound states for each component
+ * @param [in] nCells Maximum number of cells evaluated in one call
+ * @return Size of the memory buffer in bytes
+ */
+inline std::size_t bindingFluxBatchMemorySize(const IBindingModel& binding, unsigned int nComp, unsigned int nTotalBound, unsigned int const* nBound, unsigned int nCells)
+{
+	return nCells * (nComp + 2 * nTotalBound) * sizeof(double) + alignof(double) + binding.fluxBatchWorkspaceSize(nComp, nTotalBound, nBound, nCells);
+}
+
 
 /**
  * @brief Executes multiplication of particle shell Jacobian wrt. to state variable
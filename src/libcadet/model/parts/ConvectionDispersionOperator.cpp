@@ -42,7 +42,7 @@ namespace parts
  * @brief Creates an AxialConvectionDispersionOperatorBase
  */
 AxialConvectionDispersionOperatorBase::AxialConvectionDispersionOperatorBase() : _stencilMemory(sizeof(active) * Weno::maxStencilSize()), 
-	_wenoDerivatives(new double[Weno::maxStencilSize()]), _weno(), _dispersionDep(nullptr)
+	_wenoDerivatives(new double[Weno::maxStencilSize()]), _weno(), _wenoBatch(false), _dispersionDep(nullptr)
 {
 }
 
@@ -87,6 +87,14 @@ bool AxialConvectionDispersionOperatorBase::configureModelDiscretization(IParame
 	_weno.order(paramProvider.getInt("WENO_ORDER"));
 	_weno.boundaryTreatment(paramProvider.getInt("BOUNDARY_MODEL"));
 	_wenoEpsilon = paramProvider.getDouble("WENO_EPS");
+
+	// Reconstruct all faces of a component in one pass (only used for forward flow)
+	_wenoBatch = paramProvider.exists("WENO_BATCH") ? paramProvider.getBool("WENO_BATCH") : false;
+	if (_wenoBatch)
+	{
+		_wenoBatchMemory.resize(sizeof(active) * 2 * (_nCol + Weno::maxOrder() - 1), alignof(active));
+		_wenoBatchDerivatives.resize(_nCol * Weno::maxStencilSize(), 0.0);
+	}
 	paramProvider.popScope();
 
 	paramProvider.popScope();
@@ -338,7 +346,9 @@ int AxialConvectionDispersionOperatorBase::residualImpl(const IModel& model, dou
 		0u,
 		_nComp,
 		_dispersionDep,
-		model
+		model,
+		_wenoBatch ? &_wenoBatchMemory : nullptr,
+		_wenoBatchDerivatives.data()
 	};
 
 	return convdisp::residualKernelAxial<StateType, ResidualType, ParamType, RowIteratorType, wantJac, wantRes>(SimulationTime{t, secIdx}, y, yDot, res, jacBegin, fp);
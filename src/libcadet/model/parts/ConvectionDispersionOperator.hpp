@@ -137,6 +137,9 @@ protected:
 	double* _wenoDerivatives; //!< Holds derivatives of the WENO scheme
 	Weno _weno; //!< The WENO scheme implementation
 	double _wenoEpsilon; //!< The @f$ \varepsilon @f$ of the WENO scheme (prevents division by zero)
+	bool _wenoBatch; //!< Determines whether all cell faces of a component are reconstructed in one pass
+	ArrayPool _wenoBatchMemory; //!< Provides memory for batch WENO reconstruction
+	std::vector<double> _wenoBatchDerivatives; //!< Holds derivatives of the WENO scheme for all cells (batch reconstruction only)
 
 	bool _dispersionCompIndep; //!< Determines whether dispersion is component independent
 
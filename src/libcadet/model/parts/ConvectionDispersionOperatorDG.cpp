@@ -92,16 +92,21 @@ bool AxialConvectionDispersionOperatorBaseDG::configureModelDiscretization(IPara
 	_invMM.resize(_nNodes, _nNodes);
 	_invMM.setZero();
 
-	_auxState = new active[_nPoints];
-	_subsState = new active[_nPoints];
-	for (int i = 0; i < _nPoints; i++) {
+	// Each component has its own workspace so that the components can be processed in parallel
+	_auxState = new active[_nPoints * _nComp];
+	_subsState = new active[_nPoints * _nComp];
+	for (unsigned int i = 0; i < _nPoints * _nComp; i++) {
 		_auxState[i] = 0.0;
 		_subsState[i] = 0.0;
 	}
+	_boundary.resize(4u * _nComp);
 	_boundary.setZero();
-	_surfaceFlux.resize(_nCells + 1u);
+	_surfaceFlux.resize((_nCells + 1u) * _nComp);
 	_surfaceFlux.setZero();
 
+	// Volume integrals of a block of cells should amount to a few thousand operations to be worth a task
+	_cellBlockSize = std::max(1u, 4096u / (_nNodes * _nNodes));
+
 	_newStaticJac = true;
 
 	dgtoolbox::lglNodesWeights(_polyDeg, _nodes, _invWeights, true);
@@ -382,13 +387,18 @@ int AxialConvectionDispersionOperatorBaseDG::residual(const IModel& model, doubl
 template <typename StateType, typename ResidualType, typename ParamType, typename RowIteratorType, bool wantJac>
 int AxialConvectionDispersionOperatorBaseDG::residualImpl(const IModel& model, double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res, RowIteratorType jacBegin)
 {
-	for (unsigned int comp = 0; comp < _nComp; comp++) {
-
+	// Components are decoupled and use separate workspaces
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_nComp), [&](std::size_t comp)
+#else
+	for (unsigned int comp = 0; comp < _nComp; comp++)
+#endif
+	{
 		// create Eigen objects
 		Eigen::Map<const Vector<StateType, Dynamic>, 0, InnerStride<Dynamic>> _C(y + offsetC() + comp, _nPoints, InnerStride<Dynamic>(_strideNode));
 		Eigen::Map<Vector<ResidualType, Dynamic>, 0, InnerStride<Dynamic>> _resC(res + offsetC() + comp, _nPoints, InnerStride<Dynamic>(_strideNode));
-		Eigen::Map<Vector<ResidualType, Dynamic>, 0, InnerStride<>> _h(reinterpret_cast<ResidualType*>(_subsState), _nPoints, InnerStride<>(1));
-		Eigen::Map<Vector<StateType, Dynamic>, 0, InnerStride<>> _g(reinterpret_cast<StateType*>(_auxState), _nPoints, InnerStride<>(1));
+		Eigen::Map<Vector<ResidualType, Dynamic>, 0, InnerStride<>> _h(reinterpret_cast<ResidualType*>(_subsState + comp * _nPoints), _nPoints, InnerStride<>(1));
+		Eigen::Map<Vector<StateType, Dynamic>, 0, InnerStride<>> _g(reinterpret_cast<StateType*>(_auxState + comp * _nPoints), _nPoints, InnerStride<>(1));
 
 		// Add time derivative to bulk residual
 		if (yDot)
@@ -408,7 +418,7 @@ int AxialConvectionDispersionOperatorBaseDG::residualImpl(const IModel& model, d
 
 		_h.setZero();
 		_g.setZero();
-		_boundary[0] = y[comp]; // copy inlet DOFs to ghost node
+		boundaryOfComp(comp)[0] = y[comp]; // copy inlet DOFs to ghost node
 
 		// ======================================//
 		// solve auxiliary system g = d c / d x  //
@@ -418,10 +428,10 @@ int AxialConvectionDispersionOperatorBaseDG::residualImpl(const IModel& model, d
 		volumeIntegral<StateType, StateType>(_C, _g);
 
 		// calculate numerical flux values c*
-		InterfaceFluxAuxiliary<StateType>(y + offsetC() + comp, _strideNode, _strideCell);
+		InterfaceFluxAuxiliary<StateType>(comp, y + offsetC() + comp, _strideNode, _strideCell);
 
 		// DG surface integral in strong form
-		surfaceIntegral<StateType, StateType>(y + offsetC() + comp, &_g[0], _strideNode, _strideCell, 1u, _nNodes);
+		surfaceIntegral<StateType, StateType>(comp, y + offsetC() + comp, &_g[0], _strideNode, _strideCell, 1u, _nNodes);
 
 		// ======================================//
 		// solve main equation RHS  d h / d x    //
@@ -434,15 +444,15 @@ int AxialConvectionDispersionOperatorBaseDG::residualImpl(const IModel& model, d
 		volumeIntegral<ResidualType, ResidualType>(_h, _resC);
 
 		// update boundary values for auxiliary variable g (solid wall)
-		calcBoundaryValues<StateType>();
+		calcBoundaryValues<StateType>(comp);
 
 		// calculate numerical flux values h*
-		InterfaceFlux<StateType, ParamType>(y + offsetC() + comp, d_ax);
+		InterfaceFlux<StateType, ParamType>(comp, y + offsetC() + comp, d_ax);
 
 		// DG surface integral in strong form
-		surfaceIntegral<ResidualType, ResidualType>(&_h[0], res + offsetC() + comp,
+		surfaceIntegral<ResidualType, ResidualType>(comp, &_h[0], res + offsetC() + comp,
 			1u, _nNodes, _strideNode, _strideCell);
-	}
+	} CADET_PARFOR_END;
 
 	return 0;
 }
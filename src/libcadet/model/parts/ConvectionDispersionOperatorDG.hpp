@@ -26,13 +26,19 @@
 #include <ParamReaderHelper.hpp>
 #include "linalg/BandedEigenSparseRowIterator.hpp"
 #include "model/parts/DGToolbox.hpp"
+#include "ParallelSupport.hpp"
 
 #include <unordered_map>
 #include <unordered_set>
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
 #include <vector>
 
+#ifdef CADET_PARALLELIZE
+	#include <tbb/parallel_for.h>
+#endif
+
 using namespace Eigen;
 
 namespace cadet
@@ -69,6 +75,10 @@ namespace cadet
 			 * This class does not store the Jacobian. It only fills existing matrices given to its residual() functions.
 			 * It assumes that there is no offset to the inlet in the local state vector and that the firsts cell is placed
 			 * directly after the inlet DOFs.
+			 *
+			 * The components are decoupled in the convection dispersion operator. Each component owns its own auxiliary
+			 * variable, substitute, and surface flux buffers such that the residual of all components can be evaluated
+			 * concurrently. The volume integrals are additionally split into blocks of elements.
 			 */
 			class AxialConvectionDispersionOperatorBaseDG
 			{
@@ -170,10 +180,12 @@ namespace cadet
 				Eigen::MatrixXd* _DGjacAxDispBlocks; //!< Unique Jacobian blocks for axial dispersion
 				Eigen::MatrixXd _DGjacAxConvBlock; //!< Unique Jacobian blocks for axial convection
 
-				active* _auxState; //!< auxiliary variable
-				active* _subsState; //!< auxiliary substitute
-				Eigen::Vector<active, Eigen::Dynamic> _surfaceFlux; //!< stores the surface flux values
-				Eigen::Vector<active, 4> _boundary; //!< stores the boundary values from Danckwert boundary conditions
+				unsigned int _cellBlockSize; //!< Number of cells processed as one block in the (parallelized) volume integrals
+
+				active* _auxState; //!< auxiliary variable, @c _nPoints entries per component
+				active* _subsState; //!< auxiliary substitute, @c _nPoints entries per component
+				Eigen::Vector<active, Eigen::Dynamic> _surfaceFlux; //!< stores the surface flux values, @c _nCells + 1 entries per component
+				Eigen::Vector<active, Eigen::Dynamic> _boundary; //!< stores the boundary values from Danckwert boundary conditions, 4 entries per component
 
 				// Simulation parameters
 				active _colLength; //!< Column length \f$ L \f$
@@ -394,6 +406,34 @@ namespace cadet
 					return -dispBlock; // *-1 for residual
 				}
 
+				/**
+				 * @brief Applies a function to all cells of a range, processing blocks of cells in parallel
+				 * @details Blocks consist of @c _cellBlockSize cells. The function must only write to the
+				 *          rows of the given cell, i.e., to disjoint memory for different cells.
+				 * @param [in] cellBegin Index of the first cell
+				 * @param [in] cellEnd Index one past the last cell
+				 * @param [in] func Function that is called with the cell index
+				 */
+				template <typename Func>
+				void forEachCellBlocked(unsigned int cellBegin, unsigned int cellEnd, Func func) const {
+
+					if (cellEnd <= cellBegin)
+						return;
+
+					const unsigned int nBlocks = (cellEnd - cellBegin + _cellBlockSize - 1u) / _cellBlockSize;
+
+#ifdef CADET_PARALLELIZE
+					tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(nBlocks), [&](std::size_t blk)
+#else
+					for (unsigned int blk = 0; blk < nBlocks; ++blk)
+#endif
+					{
+						const unsigned int blkBegin = cellBegin + static_cast<unsigned int>(blk) * _cellBlockSize;
+						const unsigned int blkEnd = std::min(blkBegin + _cellBlockSize, cellEnd);
+						for (unsigned int cell = blkBegin; cell < blkEnd; ++cell)
+							func(cell);
+					} CADET_PARFOR_END;
+				}
 				/* ===================================================================================
 				*   Residual functions
 				* =================================================================================== */
@@ -406,22 +446,33 @@ namespace cadet
 				template<typename StateType, typename ResidualType>
 				void volumeIntegral(Eigen::Map<const Vector<StateType, Dynamic>, 0, InnerStride<Dynamic>>& state, Eigen::Map<Vector<ResidualType, Dynamic>, 0, InnerStride<Dynamic>>& stateDer) {
 
-					for (unsigned int Cell = 0; Cell < _nCells; Cell++) {
+					// element volume integrals are independent of each other
+					const unsigned int nBlocks = (_nCells + _cellBlockSize - 1u) / _cellBlockSize;
 
-						// exploit Eigen3 performance if no mixed scalar types
-						if constexpr (std::is_same_v<StateType, double>) {
-							if constexpr (std::is_same_v<ResidualType, double>) {
-								stateDer.segment(Cell * _nNodes, _nNodes) -= _polyDerM * state.segment(Cell * _nNodes, _nNodes);
+#ifdef CADET_PARALLELIZE
+					tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(nBlocks), [&](std::size_t blk)
+#else
+					for (unsigned int blk = 0; blk < nBlocks; ++blk)
+#endif
+					{
+						const unsigned int cellEnd = std::min(static_cast<unsigned int>(blk + 1) * _cellBlockSize, _nCells);
+						for (unsigned int Cell = blk * _cellBlockSize; Cell < cellEnd; Cell++) {
+
+							// exploit Eigen3 performance if no mixed scalar types
+							if constexpr (std::is_same_v<StateType, double>) {
+								if constexpr (std::is_same_v<ResidualType, double>) {
+									stateDer.segment(Cell * _nNodes, _nNodes) -= _polyDerM * state.segment(Cell * _nNodes, _nNodes);
+								}
+								else {
+									stateDer.segment(Cell * _nNodes, _nNodes) -= (_polyDerM * state.segment(Cell * _nNodes, _nNodes)).template cast<ResidualType>();
+								}
 							}
-							else {
-								stateDer.segment(Cell * _nNodes, _nNodes) -= (_polyDerM * state.segment(Cell * _nNodes, _nNodes)).template cast<ResidualType>();
+							else { // both active types
+								// todo use custom (mixed scalar-type) matrix vector multiplication?
+								stateDer.segment(Cell * _nNodes, _nNodes) -= _polyDerM.template cast<active>() * state.segment(Cell * _nNodes, _nNodes);
 							}
 						}
-						else { // both active types
-							// todo use custom (mixed scalar-type) matrix vector multiplication?
-							stateDer.segment(Cell * _nNodes, _nNodes) -= _polyDerM.template cast<active>() * state.segment(Cell * _nNodes, _nNodes);
-						}
-					}
+					} CADET_PARFOR_END;
 				}
 				template<typename StateType, typename ResidualType>
 				void volumeIntegral(Eigen::Map<Vector<StateType, Dynamic>, 0, InnerStride<Dynamic>>& state, Eigen::Map<Vector<ResidualType, Dynamic>, 0, InnerStride<Dynamic>>& stateDer) {
@@ -430,11 +481,16 @@ namespace cadet
 				}
 				/*
 				 * @brief calculates the interface fluxes h* of Convection Dispersion equation
+				 * @param [in] comp component index which determines the workspace
+				 * @param [in] C bulk liquid phase of the component
+				 * @param [in] _dispersion axial dispersion coefficient of the component
 				 */
 				template<typename StateType, typename ParamType>
-				void InterfaceFlux(const StateType* C, ParamType _dispersion) {
+				void InterfaceFlux(unsigned int comp, const StateType* C, ParamType _dispersion) {
 
-					StateType* g = reinterpret_cast<StateType*>(_auxState);
+					StateType* g = reinterpret_cast<StateType*>(_auxState + comp * _nPoints);
+					auto surfaceFlux = surfaceFluxOfComp(comp);
+					auto boundary = boundaryOfComp(comp);
 
 					// component-wise strides
 					unsigned int strideNode = _strideNode;
@@ -448,7 +504,7 @@ namespace cadet
 						// calculate inner interface fluxes
 						for (unsigned int Cell = 1; Cell < _nCells; Cell++) {
 							// h* = h*_conv + h*_disp
-							_surfaceFlux[Cell] // inner interfaces
+							surfaceFlux[Cell] // inner interfaces
 								= _curVelocity * (C[Cell * strideCell - strideNode]) // left cell (i.e. forward flow upwind)
 								- 0.5 * (-2.0 / static_cast<ParamType>(_deltaZ)) * _dispersion *
 								(g[Cell * strideCell_g - strideNode_g] // left cell
@@ -457,21 +513,21 @@ namespace cadet
 
 						// boundary fluxes
 						// inlet (left) boundary interface
-						_surfaceFlux[0]
-							= _curVelocity * _boundary[0];
+						surfaceFlux[0]
+							= _curVelocity * boundary[0];
 
 						// outlet (right) boundary interface
-						_surfaceFlux[_nCells]
+						surfaceFlux[_nCells]
 							= _curVelocity * (C[_nCells * strideCell - strideNode])
 							- 0.5 * (-2.0 / static_cast<ParamType>(_deltaZ)) * _dispersion *
 							(g[_nCells * strideCell_g - strideNode_g] // last cell last node
-								+ _boundary[3]); // right boundary value g
+								+ boundary[3]); // right boundary value g
 					}
 					else { // backward flow (upwind num. flux)
 						// calculate inner interface fluxes
 						for (unsigned int Cell = 1; Cell < _nCells; Cell++) {
 							// h* = h*_conv + h*_disp
-							_surfaceFlux[Cell] // inner interfaces
+							surfaceFlux[Cell] // inner interfaces
 								= _curVelocity * (C[Cell * strideCell]) // right cell (i.e. backward flow upwind)
 								- 0.5 * (-2.0 / static_cast<ParamType>(_deltaZ)) * _dispersion *
 								(g[Cell * strideCell_g - strideNode_g] // left cell
@@ -480,48 +536,52 @@ namespace cadet
 
 						// boundary fluxes
 						// inlet boundary interface
-						_surfaceFlux[_nCells]
-							= _curVelocity * _boundary[0];
+						surfaceFlux[_nCells]
+							= _curVelocity * boundary[0];
 
 						// outlet boundary interface
-						_surfaceFlux[0]
+						surfaceFlux[0]
 							= _curVelocity * (C[0])
 							- 0.5 * (-2.0 / static_cast<ParamType>(_deltaZ)) * _dispersion *
 							(g[0] // first cell first node
-								+ _boundary[2]); // left boundary value g
+								+ boundary[2]); // left boundary value g
 					}
 					// apply inverse mapping jacobian (reference space)
-					_surfaceFlux *= -2.0 / static_cast<ParamType>(_deltaZ);
+					surfaceFlux *= -2.0 / static_cast<ParamType>(_deltaZ);
 				}
 				/**
 				 * @brief calculates and fills the surface flux values for auxiliary equation
+				 * @param [in] comp component index which determines the workspace
 				 * @param [in] C bulk liquid phase
 				 * @param [in] strideNode node stride w.r.t. C
 				 * @param [in] strideCell cell stride w.r.t. C
 				 */
 				template<typename StateType>
-				void InterfaceFluxAuxiliary(const StateType* C, unsigned int strideNode, unsigned int strideCell) {
+				void InterfaceFluxAuxiliary(unsigned int comp, const StateType* C, unsigned int strideNode, unsigned int strideCell) {
+
+					auto surfaceFlux = surfaceFluxOfComp(comp);
 
 					// Auxiliary flux: c* = 0.5 (c_l + c_r)
 
 					// calculate inner interface fluxes
 					for (unsigned int Cell = 1; Cell < _nCells; Cell++) {
-						_surfaceFlux[Cell] // left interfaces
+						surfaceFlux[Cell] // left interfaces
 							= 0.5 * (C[Cell * strideCell - strideNode] + // left node
 								C[Cell * strideCell]); // right node
 					}
 					// calculate boundary interface fluxes
 
-					_surfaceFlux[0] // left boundary interface
+					surfaceFlux[0] // left boundary interface
 						= 0.5 * (C[0] + // boundary value
 							C[0]); // first cell first node
 
-					_surfaceFlux[(_nCells)] // right boundary interface
+					surfaceFlux[(_nCells)] // right boundary interface
 						= 0.5 * (C[_nCells * strideCell - strideNode] + // last cell last node
 							C[_nCells * strideCell - strideNode]);// // boundary value
 				}
 				/**
 				 * @brief calculates the string form surface Integral
+				 * @param [in] comp component index which determines the workspace
 				 * @param [in] state relevant state vector
 				 * @param [in] stateDer state derivative vector the solution is added to
 				 * @param [in] strideNode_state node stride w.r.t. state
@@ -531,17 +591,19 @@ namespace cadet
 				 * @detail calculates stateDer = M^-1 * B * (state - state^*) and exploits LGL sparsity if applied
 				 */
 				template<typename StateType, typename ResidualType>
-				void surfaceIntegral(const StateType* state, ResidualType* stateDer,
+				void surfaceIntegral(unsigned int comp, const StateType* state, ResidualType* stateDer,
 					unsigned int strideNode_state, unsigned int strideCell_state,
 					unsigned int strideNode_stateDer, unsigned int strideCell_stateDer) {
 
+					const auto surfaceFlux = surfaceFluxOfComp(comp);
+
 					if (_exactInt) { // non-collocated integration -> dense mass matrix
 						for (unsigned int Cell = 0; Cell < _nCells; Cell++) {
 							// strong surface integral -> M^-1 B [state - state*]
 							for (unsigned int Node = 0; Node < _nNodes; Node++) {
 								stateDer[Cell * strideCell_stateDer + Node * strideNode_stateDer]
-									-= static_cast<ResidualType>(_invMM(Node, 0) * (state[Cell * strideCell_state] - _surfaceFlux[Cell])
-										- _invMM(Node, _polyDeg) * (state[Cell * strideCell_state + _polyDeg * strideNode_state] - _surfaceFlux[(Cell + 1)]));
+									-= static_cast<ResidualType>(_invMM(Node, 0) * (state[Cell * strideCell_state] - surfaceFlux[Cell])
+										- _invMM(Node, _polyDeg) * (state[Cell * strideCell_state + _polyDeg * strideNode_state] - surfaceFlux[(Cell + 1)]));
 							}
 						}
 					}
@@ -550,25 +612,38 @@ namespace cadet
 							// strong surface integral -> M^-1 B [state - state*]
 							stateDer[Cell * strideCell_stateDer] // first cell, node
 								-= static_cast<ResidualType>(_invWeights[0]
-									* (state[Cell * strideCell_state] - _surfaceFlux(Cell)));
+									* (state[Cell * strideCell_state] - surfaceFlux(Cell)));
 
 							stateDer[Cell * strideCell_stateDer + _polyDeg * strideNode_stateDer] // last cell, node
 								+= static_cast<ResidualType>(_invWeights[_polyDeg]
-									* (state[Cell * strideCell_state + _polyDeg * strideNode_state] - _surfaceFlux(Cell + 1)));
+									* (state[Cell * strideCell_state + _polyDeg * strideNode_state] - surfaceFlux(Cell + 1)));
 						}
 					}
 				}
 				/**
 				 * @brief computes ghost nodes to implement boundary conditions
 				 * @detail to implement Danckwert boundary conditions, we only need to set the solid wall BC values for auxiliary variable
+				 * @param [in] comp component index which determines the workspace
 				 */
 				template<typename StateType>
-				void calcBoundaryValues() {
+				void calcBoundaryValues(unsigned int comp) {
+					StateType const* const g = reinterpret_cast<StateType*>(_auxState + comp * _nPoints);
+					auto boundary = boundaryOfComp(comp);
 					//cache.boundary[0] = c_in -> inlet DOF already set
-					//_boundary[1] = (_velocity >= 0.0) ? C[_nPoints - 1] : C[0]; // c_r outlet not required in Danckwerts BC
-					_boundary[2] = -reinterpret_cast<StateType*>(_auxState)[0]; // g_l left boundary (inlet/outlet for forward/backward flow)
-					_boundary[3] = -reinterpret_cast<StateType*>(_auxState)[_nPoints - 1]; // g_r right boundary (outlet/inlet for forward/backward flow)
+					//boundary[1] = (_velocity >= 0.0) ? C[_nPoints - 1] : C[0]; // c_r outlet not required in Danckwerts BC
+					boundary[2] = -g[0]; // g_l left boundary (inlet/outlet for forward/backward flow)
+					boundary[3] = -g[_nPoints - 1]; // g_r right boundary (outlet/inlet for forward/backward flow)
 				}
+				/**
+				 * @brief returns the surface flux values of the given component
+				 * @param [in] comp component index
+				 */
+				inline auto surfaceFluxOfComp(unsigned int comp) { return _surfaceFlux.segment(comp * (_nCells + 1u), _nCells + 1u); }
+				/**
+				 * @brief returns the boundary values of the given component
+				 * @param [in] comp component index
+				 */
+				inline auto boundaryOfComp(unsigned int comp) { return _boundary.segment<4>(4u * comp); }
 
 				// ==========================================================================================================================================================  //
 				// ========================================						DG Jacobian							=========================================================  //
@@ -891,10 +966,12 @@ namespace cadet
 					/*		Inner cell dispersion blocks		*/
 
 					if (_nCells >= 3u) {
-						MatrixXd dispBlock = _DGjacAxDispBlocks[1];
-						linalg::BandedEigenSparseRowIterator jacIt(jacobian, offC + strideColCell()); // row iterator starting at second cell and component
+						const MatrixXd& dispBlock = _DGjacAxDispBlocks[1];
+
+						// cells write to disjoint rows
+						forEachCellBlocked(1u, _nCells - 1u, [&](unsigned int cell) {
+							linalg::BandedEigenSparseRowIterator jacIt(jacobian, offC + cell * strideColCell()); // row iterator starting at current cell and first component
 
-						for (unsigned int cell = 1; cell < _nCells - 1; cell++) {
 							for (unsigned int i = 0; i < dispBlock.rows(); i++, jacIt += strideColBound) {
 								for (unsigned int comp = 0; comp < _nComp; comp++, ++jacIt) {
 									for (unsigned int j = 0; j < dispBlock.cols(); j++) {
@@ -908,7 +985,7 @@ namespace cadet
 									}
 								}
 							}
-						}
+						});
 					}
 
 					/*				Boundary cell Dispersion blocks			*/
@@ -986,31 +1063,34 @@ namespace cadet
 							}
 						}
 						// remaining cells
-						for (unsigned int cell = 1; cell < _nCells; cell++) {
-							for (unsigned int i = 0; i < convBlock.rows(); i++, jacIt += strideColBound) {
-								for (unsigned int comp = 0; comp < _nComp; comp++, ++jacIt) {
+						forEachCellBlocked(1u, _nCells, [&](unsigned int cell) {
+							linalg::BandedEigenSparseRowIterator jacCell(jacobian, offC + cell * strideColCell());
+							for (unsigned int i = 0; i < convBlock.rows(); i++, jacCell += strideColBound) {
+								for (unsigned int comp = 0; comp < _nComp; comp++, ++jacCell) {
 									for (unsigned int j = 0; j < convBlock.cols(); j++) {
 										// row: iterator is at current cell and component
 										// col: start at previous cells last node and go to node j.
-										jacIt[-strideColNode() + (j - i) * strideColNode()] += static_cast<double>(_curVelocity) * convBlock(i, j);
+										jacCell[-strideColNode() + (j - i) * strideColNode()] += static_cast<double>(_curVelocity) * convBlock(i, j);
 									}
 								}
 							}
-						}
+						});
 					}
 					else { // backward flow upwind convection
 						// non-inlet cells
-						for (unsigned int cell = 0; cell < _nCells - 1u; cell++) {
-							for (unsigned int i = 0; i < convBlock.rows(); i++, jacIt += strideColBound) {
-								for (unsigned int comp = 0; comp < _nComp; comp++, ++jacIt) {
+						forEachCellBlocked(0u, _nCells - 1u, [&](unsigned int cell) {
+							linalg::BandedEigenSparseRowIterator jacCell(jacobian, offC + cell * strideColCell());
+							for (unsigned int i = 0; i < convBlock.rows(); i++, jacCell += strideColBound) {
+								for (unsigned int comp = 0; comp < _nComp; comp++, ++jacCell) {
 									for (unsigned int j = 0; j < convBlock.cols(); j++) {
 										// row: iterator is at current cell and component
 										// col: start at current cells first node and go to node j.
-										jacIt[(j - i) * strideColNode()] += static_cast<double>(_curVelocity) * convBlock(i, j);
+										jacCell[(j - i) * strideColNode()] += static_cast<double>(_curVelocity) * convBlock(i, j);
 									}
 								}
 							}
-						}
+						});
+						jacIt += static_cast<int>(_nCells - 1u) * strideColCell(); // move iterator to last cell
 						// special inlet DOF treatment for last cell (inlet boundary cell)
 						jacInlet(0, 0) = static_cast<double>(_curVelocity) * convBlock(convBlock.rows() - 1, convBlock.cols() - 1); // only last node depends on inlet concentration
 						for (unsigned int i = 0; i < convBlock.rows(); i++, jacIt += strideColBound) {
@@ -1036,17 +1116,20 @@ namespace cadet
 
 					const int strideColBound = strideColNode() - _nComp;
 
-					for (unsigned int cell = 0; cell < nCells; cell++) {
-						for (unsigned int i = 0; i < block.rows(); i++, jac += strideColBound) {
-							for (unsigned int comp = 0; comp < _nComp; comp++, ++jac) {
+					// cells write to disjoint rows
+					forEachCellBlocked(0u, nCells, [&](unsigned int cell) {
+						linalg::BandedEigenSparseRowIterator jacCell = jac + static_cast<int>(cell) * strideColCell();
+						for (unsigned int i = 0; i < block.rows(); i++, jacCell += strideColBound) {
+							for (unsigned int comp = 0; comp < _nComp; comp++, ++jacCell) {
 								for (unsigned int j = 0; j < block.cols(); j++) {
 									// row: at current node component
 									// col: jump to node j
-									jac[(j - i) * strideColNode() + offCol] = block(i, j) * static_cast<double>(Compfactor[comp]);
+									jacCell[(j - i) * strideColNode() + offCol] = block(i, j) * static_cast<double>(Compfactor[comp]);
 								}
 							}
 						}
-					}
+					});
+					jac += static_cast<int>(nCells) * strideColCell();
 				}
 				/**
 				 * @brief adds liquid state blocks for all components to the system jacobian
@@ -1059,17 +1142,20 @@ namespace cadet
 
 					unsigned int strideColBound = strideColNode() - _nComp;
 
-					for (unsigned int cell = 0; cell < nCells; cell++) {
-						for (unsigned int i = 0; i < block.rows(); i++, jac += strideColBound) {
-							for (unsigned int comp = 0; comp < _nComp; comp++, ++jac) {
+					// cells write to disjoint rows
+					forEachCellBlocked(0u, nCells, [&](unsigned int cell) {
+						linalg::BandedEigenSparseRowIterator jacCell = jac + static_cast<int>(cell) * strideColCell();
+						for (unsigned int i = 0; i < block.rows(); i++, jacCell += strideColBound) {
+							for (unsigned int comp = 0; comp < _nComp; comp++, ++jacCell) {
 								for (unsigned int j = 0; j < block.cols(); j++) {
 									// row: at current node component
 									// col: jump to node j
-									jac[(j - i) * strideColNode() + offCol] += block(i, j);
+									jacCell[(j - i) * strideColNode() + offCol] += block(i, j);
 								}
 							}
 						}
-					}
+					});
+					jac += static_cast<int>(nCells) * strideColCell();
 				}
 				/**
 				 * @brief analytically calculates the convection dispersion jacobian for the exact integration (here: modal) DG scheme
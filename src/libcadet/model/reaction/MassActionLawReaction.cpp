@@ -22,7 +22,10 @@
 
 #include <functional>
 #include <algorithm>
+#include <cmath>
+#include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <vector>
 
@@ -155,135 +158,256 @@ namespace
 	}
 
 	/**
-	 * @brief Calculate gradient of reaction rate (flux) in liquid phase
-	 * @param [out] fluxGrad Array that holds the gradient of the reaction rate
-	 * @param [in] r Index of the reaction
-	 * @param [in] nComp Number of components
-	 * @param [in] rate Rate constant
-	 * @param [in] exponents Matrix with exponents in the rate law
-	 * @param [in] y Array of concentrations
+	 * @brief Compressed reaction-major storage of the nonzero entries of stoichiometry or exponent matrices
+	 * @details The entries of reaction @c r are stored in the range [offset[r], offset[r+1]). Each entry holds
+	 *          the index of the state it refers to and a pointer to its value in the dense parameter matrix.
+	 *          Thus, changes of parameter values are picked up without rebuilding the structure as long as
+	 *          no zero entry becomes nonzero.
+	 *
+	 *          Two parameter matrices can be combined in one structure. The rows of the second matrix are
+	 *          then appended to the rows of the first one (e.g., liquid phase followed by solid phase).
 	 */
-	inline void fluxGradLiquid(double* fluxGrad, unsigned int r, unsigned int nComp, double rate, const cadet::linalg::ActiveDenseMatrix& exponents, double const* y)
+	struct CompressedReactionMatrix
 	{
-		for (unsigned int c = 0; c < nComp; ++c)
-		{
-			if (cadet_unlikely(exponents.native(c, r) != 0.0))
-				fluxGrad[c] = rate;
-			else
-				fluxGrad[c] = 0.0;
-		}
-
-		// Calculate gradient
-		for (unsigned int c = 0; c < nComp; ++c)
-		{
-			if (cadet_unlikely(exponents.native(c, r) != 0.0))
+		std::vector<int> offset; //!< Offset of the first entry of each reaction
+		std::vector<int> index; //!< State index of each entry
+		std::vector<active const*> value; //!< Pointer to the value of each entry in the parameter matrix
+
+		/**
+		 * @brief Extracts the sparsity pattern from one or two dense parameter matrices with reactions as columns
+		 * @details Entries that are zero are only included if they are contained in @p pinned.
+		 * @param [in] nReactions Number of reactions
+		 * @param [in] first First parameter matrix
+		 * @param [in] second Second parameter matrix whose rows are appended, or @c nullptr
+		 * @param [in] pinned Set of entries that are always included in the pattern
+		 */
+		void assign(int nReactions, const cadet::linalg::ActiveDenseMatrix& first, const cadet::linalg::ActiveDenseMatrix* second, const std::unordered_set<active const*>& pinned)
+		{
+			offset.clear();
+			index.clear();
+			value.clear();
+
+			offset.reserve(nReactions + 1);
+			offset.push_back(0);
+			for (int r = 0; r < nReactions; ++r)
 			{
-				const double exponentValue = static_cast<double>(exponents.native(c, r));
-				const double v = pow(y[c], exponentValue);
-				for (unsigned int j = 0; j < c; ++j)
-					fluxGrad[j] *= v;
+				appendReaction(first, r, 0, pinned);
+				if (second)
+					appendReaction(*second, r, first.rows(), pinned);
+
+				offset.push_back(static_cast<int>(index.size()));
+			}
+		}
 
-				fluxGrad[c] *= exponentValue * pow(y[c], exponentValue - 1.0);
+	private:
 
-				for (unsigned int j = c + 1; j < nComp; ++j)
-					fluxGrad[j] *= v;
+		inline void appendReaction(const cadet::linalg::ActiveDenseMatrix& mat, int r, int rowOffset, const std::unordered_set<active const*>& pinned)
+		{
+			if (r >= mat.columns())
+				return;
 
+			for (int row = 0; row < mat.rows(); ++row)
+			{
+				active const* const v = &mat.native(row, r);
+				if ((static_cast<double>(*v) != 0.0) || (pinned.count(v) > 0))
+				{
+					index.push_back(row + rowOffset);
+					value.push_back(v);
+				}
 			}
 		}
+	};
+
+	/**
+	 * @brief Raises @p x to a positive integer power by repeated squaring
+	 * @param [in] x Base
+	 * @param [in] n Positive exponent
+	 * @return @f$ x^n @f$
+	 */
+	template <typename T>
+	inline T integerPow(const T& x, unsigned int n)
+	{
+		T result = x;
+		T base = x;
+		for (n = n - 1; n > 0; n >>= 1)
+		{
+			if (n & 1u)
+				result *= base;
+			if (n > 1)
+				base *= base;
+		}
+		return result;
 	}
 
 	/**
-	 * @brief Calculate gradient of reaction rate (flux) in liquid-solid phase cell
-	 * @param [out] fluxGrad Array that holds the gradient of the reaction rate
+	 * @brief Calculates a mass action law rate term @f$ k \prod_i y_i^{e_i} @f$ of one reaction
+	 * @details Integer exponents are handled by repeated multiplication if @p IntegerPowers is @c true.
+	 *          All other exponents are accumulated in the log domain, which requires only one
+	 *          @c exp() call per rate term. The rate term vanishes if a concentration with nonzero
+	 *          exponent is not positive or if the reaction does not have any nonzero exponent.
+	 * @param [in] rate Rate constant @f$ k @f$
+	 * @param [in] exponents Compressed exponent lists (liquid phase followed by solid phase)
 	 * @param [in] r Index of the reaction
+	 * @param [in] yLiquid Array of liquid phase concentrations
+	 * @param [in] ySolid Array of solid phase concentrations
 	 * @param [in] nComp Number of components
-	 * @param [in] nTotalBoundStates Total number of bound states
-	 * @param [in] rate Rate constant
-	 * @param [in] expLiquid Matrix with exponents of the liquid phase concentrations in the rate law
-	 * @param [in] expSolid Matrix with exponents of the solid phase concentrations in the rate law
-	 * @param [in] yLiquid Array of liquid phase concentrations (points to first component of liquid phase concentrations)
-	 * @param [in] ySolid Array of solid phase concentrations (points to first component of solid phase concentrations)
+	 * @tparam IntegerPowers Determines whether integer exponents are evaluated by repeated multiplication
+	 * @return Rate term
 	 */
-	inline void fluxGradCombined(double* fluxGrad, unsigned int r, unsigned int nComp, unsigned int nTotalBoundStates, double rate,
-		const cadet::linalg::ActiveDenseMatrix& expLiquid, const cadet::linalg::ActiveDenseMatrix& expSolid, double const* yLiquid, double const* ySolid)
+	template <bool IntegerPowers, typename param_t, typename StateType>
+	inline param_t massActionRate(const param_t& rate, const CompressedReactionMatrix& exponents, int r, StateType const* yLiquid, StateType const* ySolid, int nComp)
 	{
-		for (unsigned int c = 0; c < nComp; ++c)
-		{
-			if (cadet_unlikely(expLiquid.native(c, r) != 0.0))
-				fluxGrad[c] = rate;
-			else
-				fluxGrad[c] = 0.0;
-		}
+		using std::log;
+		using std::exp;
 
-		for (unsigned int c = 0; c < nTotalBoundStates; ++c)
+		param_t prod = rate;
+		param_t logSum = 0.0;
+		bool hasTerm = false;
+		bool hasLogTerm = false;
+
+		for (int i = exponents.offset[r]; i < exponents.offset[r + 1]; ++i)
 		{
-			if (cadet_unlikely(expSolid.native(c, r) != 0.0))
-				fluxGrad[nComp + c] = rate;
+			const active& e = *exponents.value[i];
+			const double eVal = static_cast<double>(e);
+			if (eVal == 0.0)
+				continue;
+
+			const int idx = exponents.index[i];
+			const StateType& y = (idx < nComp) ? yLiquid[idx] : ySolid[idx - nComp];
+			if (static_cast<double>(y) <= 0.0)
+				return 0.0;
+
+			hasTerm = true;
+			if (IntegerPowers && (eVal >= 1.0) && (eVal <= 64.0) && (eVal == std::floor(eVal)))
+				prod *= integerPow(static_cast<param_t>(y), static_cast<unsigned int>(eVal));
 			else
-				fluxGrad[nComp + c] = 0.0;
+			{
+				logSum += static_cast<param_t>(e) * log(static_cast<param_t>(y));
+				hasLogTerm = true;
+			}
 		}
 
-		// Calculate gradient
-		for (unsigned int c = 0; c < nComp; ++c)
-		{
-			if (cadet_unlikely(expLiquid.native(c, r) != 0.0))
-			{
-				const double exponentValue = static_cast<double>(expLiquid.native(c, r));
-				const double v = pow(yLiquid[c], exponentValue);
-				for (unsigned int j = 0; j < c; ++j)
-					fluxGrad[j] *= v;
+		if (!hasTerm)
+			return 0.0;
 
-				fluxGrad[c] *= exponentValue * pow(yLiquid[c], exponentValue - 1.0);
+		if (hasLogTerm)
+			prod *= exp(logSum);
 
-				for (unsigned int j = c + 1; j < nComp + nTotalBoundStates; ++j)
-					fluxGrad[j] *= v;
+		return prod;
+	}
 
+	/**
+	 * @brief Calculates the gradient of a mass action law rate term of one reaction
+	 * @details The gradient is only computed on the exponent list of the reaction. Entry @c j of @p grad
+	 *          corresponds to entry @c offset[r] + j of @p exponents.
+	 * @param [out] grad Array that holds the gradient of the rate term
+	 * @param [in] rate Rate constant
+	 * @param [in] exponents Compressed exponent lists (liquid phase followed by solid phase)
+	 * @param [in] r Index of the reaction
+	 * @param [in] yLiquid Array of liquid phase concentrations
+	 * @param [in] ySolid Array of solid phase concentrations
+	 * @param [in] nComp Number of components
+	 */
+	inline void massActionRateGradient(double* grad, double rate, const CompressedReactionMatrix& exponents, int r, double const* yLiquid, double const* ySolid, int nComp)
+	{
+		const int begin = exponents.offset[r];
+		const int end = exponents.offset[r + 1];
+
+		bool positive = true;
+		for (int i = begin; i < end; ++i)
+		{
+			const int idx = exponents.index[i];
+			const double y = (idx < nComp) ? yLiquid[idx] : ySolid[idx - nComp];
+			if ((static_cast<double>(*exponents.value[i]) != 0.0) && (y <= 0.0))
+			{
+				positive = false;
+				break;
 			}
 		}
 
-		for (unsigned int c = 0; c < nTotalBoundStates; ++c)
+		if (cadet_likely(positive))
 		{
-			if (cadet_unlikely(expSolid.native(c, r) != 0.0))
+			// Use d/dy_j (k prod_i y_i^e_i) = e_j / y_j * k prod_i y_i^e_i
+			const double flux = massActionRate<true>(rate, exponents, r, yLiquid, ySolid, nComp);
+			for (int i = begin; i < end; ++i)
 			{
-				const double exponentValue = static_cast<double>(expSolid.native(c, r));
-				const double v = pow(ySolid[c], exponentValue);
-				for (unsigned int j = 0; j < nComp + c; ++j)
-					fluxGrad[j] *= v;
-
-				fluxGrad[nComp + c] *= exponentValue * pow(ySolid[c], exponentValue - 1.0);
+				const int idx = exponents.index[i];
+				const double y = (idx < nComp) ? yLiquid[idx] : ySolid[idx - nComp];
+				grad[i - begin] = static_cast<double>(*exponents.value[i]) * flux / y;
+			}
+			return;
+		}
 
-				for (unsigned int j = c + 1; j < nTotalBoundStates; ++j)
-					fluxGrad[nComp + j] *= v;
+		// Some concentrations are not positive, so differentiate the product directly
+		for (int j = begin; j < end; ++j)
+		{
+			const double eJ = static_cast<double>(*exponents.value[j]);
+			if (eJ == 0.0)
+			{
+				grad[j - begin] = 0.0;
+				continue;
+			}
 
+			double g = rate;
+			for (int i = begin; i < end; ++i)
+			{
+				const double eI = static_cast<double>(*exponents.value[i]);
+				if (eI == 0.0)
+					continue;
+
+				const int idx = exponents.index[i];
+				const double y = (idx < nComp) ? yLiquid[idx] : ySolid[idx - nComp];
+				if (i == j)
+					g *= eI * pow(y, eI - 1.0);
+				else
+					g *= pow(y, eI);
 			}
+			grad[j - begin] = g;
 		}
 	}
 
-	template <typename num_t>
-	inline num_t rateConstantOrZero(const num_t& rate, unsigned int idxReaction, const cadet::linalg::ActiveDenseMatrix& exponents, unsigned int nComp)
+	/**
+	 * @brief Adds the reaction terms @f$ \alpha S f @f$ to the residual on the sparsity pattern of @f$ S @f$
+	 * @param [in] stoichiometry Compressed stoichiometry @f$ S @f$
+	 * @param [in] fluxes Array of reaction fluxes @f$ f @f$
+	 * @param [in] factor Factor @f$ \alpha @f$
+	 * @param [in,out] res Residual
+	 */
+	template <typename flux_t, typename FactorType, typename ResidualType>
+	inline void addReactionTerms(const CompressedReactionMatrix& stoichiometry, flux_t const* fluxes, const FactorType& factor, ResidualType* res)
 	{
-		for (unsigned int c = 0; c < nComp; ++c)
+		const int nReactions = static_cast<int>(stoichiometry.offset.size()) - 1;
+		for (int r = 0; r < nReactions; ++r)
 		{
-			if (cadet_unlikely(exponents.native(c, idxReaction) != 0.0))
-				return rate;
+			const typename DoubleActiveDemoter<ResidualType, flux_t>::type flux = static_cast<typename DoubleActiveDemoter<ResidualType, flux_t>::type>(fluxes[r]);
+			for (int i = stoichiometry.offset[r]; i < stoichiometry.offset[r + 1]; ++i)
+				res[stoichiometry.index[i]] += static_cast<typename DoubleActiveDemoter<ResidualType, FactorType>::type>(factor) * static_cast<typename DoubleDemoter<ResidualType>::type>(*stoichiometry.value[i]) * flux;
 		}
-		return 0.0;
 	}
 
-	template <typename num_t>
-	inline num_t rateConstantOrZero(const num_t& rate, unsigned int idxReaction, const cadet::linalg::ActiveDenseMatrix& expLiquid, const cadet::linalg::ActiveDenseMatrix& expSolid, unsigned int nComp, unsigned int nTotalBoundStates)
+	/**
+	 * @brief Adds the gradient of a rate term of one reaction to the Jacobian on the sparsity pattern
+	 * @param [in] jac Row iterator pointing to the first row of the residual block the reaction contributes to
+	 * @param [in] colOffset Offset of the state the row iterator diagonal refers to in the combined state
+	 * @param [in] stoichiometry Compressed stoichiometry
+	 * @param [in] exponents Compressed exponent lists the gradient is based on
+	 * @param [in] r Index of the reaction
+	 * @param [in] grad Gradient of the rate term
+	 * @param [in] factor Factor in front of the reaction term
+	 */
+	template <typename RowIterator>
+	inline void addRateGradient(const RowIterator& jac, int colOffset, const CompressedReactionMatrix& stoichiometry, const CompressedReactionMatrix& exponents, int r, double const* grad, double factor)
 	{
-		for (unsigned int c = 0; c < nComp; ++c)
+		const int begin = exponents.offset[r];
+		const int end = exponents.offset[r + 1];
+		for (int i = stoichiometry.offset[r]; i < stoichiometry.offset[r + 1]; ++i)
 		{
-			if (cadet_unlikely(expLiquid.native(c, idxReaction) != 0.0))
-				return rate;
+			const int row = stoichiometry.index[i];
+			const double colFactor = static_cast<double>(*stoichiometry.value[i]) * factor;
+			RowIterator curJac = jac + row;
+			for (int j = begin; j < end; ++j)
+				curJac[exponents.index[j] - colOffset - row] += colFactor * grad[j - begin];
 		}
-		for (unsigned int c = 0; c < nTotalBoundStates; ++c)
-		{
-			if (cadet_unlikely(expSolid.native(c, idxReaction) != 0.0))
-				return rate;
-		}
-		return 0.0;
 	}
 }
 
@@ -321,6 +445,9 @@ public:
 	{
 		DynamicReactionModelBase::configureModelDiscretization(paramProvider, nComp, nBound, boundOffset);
 
+		// Parameter matrices are reallocated
+		_pinnedEntries.clear();
+
 		if (paramProvider.exists("MAL_STOICHIOMETRY_BULK"))
 		{
 			const std::size_t numElements = paramProvider.numElements("MAL_STOICHIOMETRY_BULK");
@@ -375,6 +502,28 @@ public:
 	virtual unsigned int numReactionsLiquid() const CADET_NOEXCEPT { return _stoichiometryBulk.columns(); }
 	virtual unsigned int numReactionsCombined() const CADET_NOEXCEPT { return _stoichiometryLiquid.columns() + _stoichiometrySolid.columns(); }
 
+	virtual bool setParameter(const ParameterId& pId, double value)
+	{
+		if (!DynamicReactionModelBase::setParameter(pId, value))
+			return false;
+
+		updateSparseNetwork();
+		return true;
+	}
+
+	virtual active* getParameter(const ParameterId& pId)
+	{
+		active* const param = DynamicReactionModelBase::getParameter(pId);
+
+		// The parameter may be changed through the returned pointer, so keep it in the sparsity pattern
+		if (param && _pinnedEntries.insert(param).second)
+			updateSparseNetwork();
+
+		return param;
+	}
+
+	using DynamicReactionModelBase::setParameter;
+
 	CADET_DYNAMICREACTIONMODEL_BOILERPLATE
 
 protected:
@@ -396,6 +545,20 @@ protected:
 	linalg::ActiveDenseMatrix _expSolidFwdLiquid;
 	linalg::ActiveDenseMatrix _expSolidBwdLiquid;
 
+	CompressedReactionMatrix _sparseStoichBulk; //!< Nonzero entries of the bulk stoichiometry
+	CompressedReactionMatrix _sparseExpBulkFwd; //!< Nonzero forward exponents of bulk reactions
+	CompressedReactionMatrix _sparseExpBulkBwd; //!< Nonzero backward exponents of bulk reactions
+
+	CompressedReactionMatrix _sparseStoichLiquid; //!< Nonzero entries of the particle liquid phase stoichiometry
+	CompressedReactionMatrix _sparseExpLiquidFwd; //!< Nonzero forward exponents of particle liquid phase reactions (liquid and solid phase)
+	CompressedReactionMatrix _sparseExpLiquidBwd; //!< Nonzero backward exponents of particle liquid phase reactions (liquid and solid phase)
+
+	CompressedReactionMatrix _sparseStoichSolid; //!< Nonzero entries of the solid phase stoichiometry
+	CompressedReactionMatrix _sparseExpSolidFwd; //!< Nonzero forward exponents of solid phase reactions (liquid and solid phase)
+	CompressedReactionMatrix _sparseExpSolidBwd; //!< Nonzero backward exponents of solid phase reactions (liquid and solid phase)
+
+	std::unordered_set<active const*> _pinnedEntries; //!< Parameters that have been handed out and may be changed through their pointer
+
 	inline int maxNumReactions() const CADET_NOEXCEPT { return std::max(std::max(_stoichiometryBulk.columns(), _stoichiometryLiquid.columns()), _stoichiometrySolid.columns()); }
 
 	virtual bool configureImpl(IParameterProvider& paramProvider, UnitOpIdx unitOpIdx, ParticleTypeIdx parTypeIdx)
@@ -496,7 +659,10 @@ protected:
 		registerCompRowMatrix(_parameters, unitOpIdx, parTypeIdx, "MAL_EXPONENTS_LIQUID_BWD", _expLiquidBwd);
 
 		if (!_nBoundStates || !_boundOffset)
+		{
+			updateSparseNetwork();
 			return true;
+		}
 
 		readAndRegisterExponents(paramProvider, _parameters, unitOpIdx, parTypeIdx, "MAL_EXPONENTS_LIQUID_FWD_MODSOLID", _expLiquidFwdSolid, _nComp, _boundOffset);
 		readAndRegisterExponents(paramProvider, _parameters, unitOpIdx, parTypeIdx, "MAL_EXPONENTS_LIQUID_BWD_MODSOLID", _expLiquidBwdSolid, _nComp, _boundOffset);
@@ -546,6 +712,7 @@ protected:
 		readAndRegisterExponents(paramProvider, _parameters, unitOpIdx, parTypeIdx, "MAL_EXPONENTS_SOLID_FWD_MODLIQUID", _expSolidFwdLiquid, _nComp, nullptr);
 		readAndRegisterExponents(paramProvider, _parameters, unitOpIdx, parTypeIdx, "MAL_EXPONENTS_SOLID_BWD_MODLIQUID", _expSolidBwdLiquid, _nComp, nullptr);
 
+		updateSparseNetwork();
 		return true;
 	}
 
@@ -555,48 +722,22 @@ protected:
 	{
 		typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos, _nComp, _nBoundStates, workSpace);
 
+		// Integer powers by repeated multiplication lose the derivative with respect to the exponent
+		constexpr bool integerPowers = std::is_same<ParamType, double>::value;
+
 		// Calculate fluxes
 		typedef typename DoubleActivePromoter<StateType, ParamType>::type flux_t;
+		typedef typename DoubleActiveDemoter<flux_t, active>::type param_t;
 		BufferedArray<flux_t> fluxes = workSpace.array<flux_t>(maxNumReactions());
 		for (int r = 0; r < _stoichiometryBulk.columns(); ++r)
 		{
-			flux_t fwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdBulk[r]), r, _expBulkFwd, _nComp);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expBulkFwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(y[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(y[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expBulkFwd.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-
-			flux_t bwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdBulk[r]), r, _expBulkBwd, _nComp);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expBulkBwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(y[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(y[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expBulkBwd.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-
+			const flux_t fwd = massActionRate<integerPowers>(static_cast<param_t>(p->kFwdBulk[r]), _sparseExpBulkFwd, r, y, y, _nComp);
+			const flux_t bwd = massActionRate<integerPowers>(static_cast<param_t>(p->kBwdBulk[r]), _sparseExpBulkBwd, r, y, y, _nComp);
 			fluxes[r] = fwd - bwd;
 		}
 
 		// Add reaction terms to residual
-		_stoichiometryBulk.multiplyVector(static_cast<flux_t*>(fluxes), factor, res);
+		addReactionTerms(_sparseStoichBulk, static_cast<flux_t*>(fluxes), factor, res);
 
 		return 0;
 	}
@@ -607,76 +748,22 @@ protected:
 	{
 		typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos, _nComp, _nBoundStates, workSpace);
 
+		// Integer powers by repeated multiplication lose the derivative with respect to the exponent
+		constexpr bool integerPowers = std::is_same<ParamType, double>::value;
+
 		// Calculate fluxes in liquid phase
 		typedef typename DoubleActivePromoter<StateType, ParamType>::type flux_t;
+		typedef typename DoubleActiveDemoter<flux_t, active>::type param_t;
 		BufferedArray<flux_t> fluxes = workSpace.array<flux_t>(maxNumReactions());
 		for (int r = 0; r < _stoichiometryLiquid.columns(); ++r)
 		{
-			flux_t fwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdLiquid[r]), r, _expLiquidFwd, _expLiquidFwdSolid, _nComp, _nTotalBoundStates);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expLiquidFwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(yLiquid[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(yLiquid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expLiquidFwd.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-			for (int c = 0; c < _nTotalBoundStates; ++c)
-			{
-				if (_expLiquidFwdSolid.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(ySolid[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(ySolid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expLiquidFwdSolid.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-
-			flux_t bwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdLiquid[r]), r, _expLiquidBwd, _expLiquidBwdSolid, _nComp, _nTotalBoundStates);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expLiquidBwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(yLiquid[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(yLiquid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expLiquidBwd.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-			for (int c = 0; c < _nTotalBoundStates; ++c)
-			{
-				if (_expLiquidBwdSolid.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(ySolid[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(ySolid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expLiquidBwdSolid.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-
+			const flux_t fwd = massActionRate<integerPowers>(static_cast<param_t>(p->kFwdLiquid[r]), _sparseExpLiquidFwd, r, yLiquid, ySolid, _nComp);
+			const flux_t bwd = massActionRate<integerPowers>(static_cast<param_t>(p->kBwdLiquid[r]), _sparseExpLiquidBwd, r, yLiquid, ySolid, _nComp);
 			fluxes[r] = fwd - bwd;
 		}
 
 		// Add reaction terms to liquid phase residual
-		_stoichiometryLiquid.multiplyVector(static_cast<flux_t*>(fluxes), factor, resLiquid);
+		addReactionTerms(_sparseStoichLiquid, static_cast<flux_t*>(fluxes), factor, resLiquid);
 
 		if (_nTotalBoundStates == 0)
 			return 0;
@@ -684,71 +771,13 @@ protected:
 		// Calculate fluxes in solid phase
 		for (int r = 0; r < _stoichiometrySolid.columns(); ++r)
 		{
-			flux_t fwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdSolid[r]), r, _expSolidFwdLiquid, _expSolidFwd, _nComp, _nTotalBoundStates);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expSolidFwdLiquid.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(yLiquid[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(yLiquid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expSolidFwdLiquid.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-			for (int c = 0; c < _nTotalBoundStates; ++c)
-			{
-				if (_expSolidFwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(ySolid[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(ySolid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expSolidFwd.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-
-			flux_t bwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdSolid[r]), r, _expSolidBwdLiquid, _expSolidBwd, _nComp, _nTotalBoundStates);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expSolidBwdLiquid.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(yLiquid[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(yLiquid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expSolidBwdLiquid.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-			for (int c = 0; c < _nTotalBoundStates; ++c)
-			{
-				if (_expSolidBwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(ySolid[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(ySolid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expSolidBwd.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-
+			const flux_t fwd = massActionRate<integerPowers>(static_cast<param_t>(p->kFwdSolid[r]), _sparseExpSolidFwd, r, yLiquid, ySolid, _nComp);
+			const flux_t bwd = massActionRate<integerPowers>(static_cast<param_t>(p->kBwdSolid[r]), _sparseExpSolidBwd, r, yLiquid, ySolid, _nComp);
 			fluxes[r] = fwd - bwd;
 		}
 
 		// Add reaction terms to solid phase residual
-		_stoichiometrySolid.multiplyVector(static_cast<flux_t*>(fluxes), factor, resSolid);
+		addReactionTerms(_sparseStoichSolid, static_cast<flux_t*>(fluxes), factor, resSolid);
 
 		return 0;
 	}
@@ -764,17 +793,12 @@ protected:
 		for (int r = 0; r < _stoichiometryBulk.columns(); ++r)
 		{
 			// Calculate gradients of forward and backward fluxes
-			fluxGradLiquid(fluxGradFwd, r, _nComp, static_cast<double>(p->kFwdBulk[r]), _expBulkFwd, y);
-			fluxGradLiquid(fluxGradBwd, r, _nComp, static_cast<double>(p->kBwdBulk[r]), _expBulkBwd, y);
+			massActionRateGradient(fluxGradFwd, static_cast<double>(p->kFwdBulk[r]), _sparseExpBulkFwd, r, y, y, _nComp);
+			massActionRateGradient(fluxGradBwd, static_cast<double>(p->kBwdBulk[r]), _sparseExpBulkBwd, r, y, y, _nComp);
 
 			// Add gradients to Jacobian
-			RowIterator curJac = jac;
-			for (int row = 0; row < _nComp; ++row, ++curJac)
-			{
-				const double colFactor = static_cast<double>(_stoichiometryBulk.native(row, r)) * factor;
-				for (int col = 0; col < _nComp; ++col)
-					curJac[col - static_cast<int>(row)] += colFactor * (fluxGradFwd[col] - fluxGradBwd[col]);
-			}
+			addRateGradient(jac, 0, _sparseStoichBulk, _sparseExpBulkFwd, r, fluxGradFwd, factor);
+			addRateGradient(jac, 0, _sparseStoichBulk, _sparseExpBulkBwd, r, fluxGradBwd, -factor);
 		}
 	}
 
@@ -790,17 +814,12 @@ protected:
 		for (int r = 0; r < _stoichiometryLiquid.columns(); ++r)
 		{
 			// Calculate gradients of forward and backward fluxes
-			fluxGradCombined(fluxGradFwd, r, _nComp, _nTotalBoundStates, static_cast<double>(p->kFwdLiquid[r]), _expLiquidFwd, _expLiquidFwdSolid, yLiquid, ySolid);
-			fluxGradCombined(fluxGradBwd, r, _nComp, _nTotalBoundStates, static_cast<double>(p->kBwdLiquid[r]), _expLiquidBwd, _expLiquidBwdSolid, yLiquid, ySolid);
+			massActionRateGradient(fluxGradFwd, static_cast<double>(p->kFwdLiquid[r]), _sparseExpLiquidFwd, r, yLiquid, ySolid, _nComp);
+			massActionRateGradient(fluxGradBwd, static_cast<double>(p->kBwdLiquid[r]), _sparseExpLiquidBwd, r, yLiquid, ySolid, _nComp);
 
 			// Add gradients to Jacobian
-			RowIteratorLiquid curJac = jacLiquid;
-			for (int row = 0; row < _nComp; ++row, ++curJac)
-			{
-				const double colFactor = static_cast<double>(_stoichiometryLiquid.native(row, r)) * factor;
-				for (int col = 0; col < _nComp + _nTotalBoundStates; ++col)
-					curJac[col - static_cast<int>(row)] += colFactor * (fluxGradFwd[col] - fluxGradBwd[col]);
-			}
+			addRateGradient(jacLiquid, 0, _sparseStoichLiquid, _sparseExpLiquidFwd, r, fluxGradFwd, factor);
+			addRateGradient(jacLiquid, 0, _sparseStoichLiquid, _sparseExpLiquidBwd, r, fluxGradBwd, -factor);
 		}
 
 		if (_nTotalBoundStates == 0)
@@ -809,19 +828,34 @@ protected:
 		for (int r = 0; r < _stoichiometrySolid.columns(); ++r)
 		{
 			// Calculate gradients of forward and backward fluxes
-			fluxGradCombined(fluxGradFwd, r, _nComp, _nTotalBoundStates, static_cast<double>(p->kFwdSolid[r]), _expSolidFwdLiquid, _expSolidFwd, yLiquid, ySolid);
-			fluxGradCombined(fluxGradBwd, r, _nComp, _nTotalBoundStates, static_cast<double>(p->kBwdSolid[r]), _expSolidBwdLiquid, _expSolidBwd, yLiquid, ySolid);
+			massActionRateGradient(fluxGradFwd, static_cast<double>(p->kFwdSolid[r]), _sparseExpSolidFwd, r, yLiquid, ySolid, _nComp);
+			massActionRateGradient(fluxGradBwd, static_cast<double>(p->kBwdSolid[r]), _sparseExpSolidBwd, r, yLiquid, ySolid, _nComp);
 
 			// Add gradients to Jacobian
-			RowIteratorSolid curJac = jacSolid;
-			for (int row = 0; row < _nTotalBoundStates; ++row, ++curJac)
-			{
-				const double colFactor = static_cast<double>(_stoichiometrySolid.native(row, r)) * factor;
-				for (int col = 0; col < _nComp + _nTotalBoundStates; ++col)
-					curJac[col - static_cast<int>(_nComp) - static_cast<int>(row)] += colFactor * (fluxGradFwd[col] - fluxGradBwd[col]);
-			}
+			addRateGradient(jacSolid, _nComp, _sparseStoichSolid, _sparseExpSolidFwd, r, fluxGradFwd, factor);
+			addRateGradient(jacSolid, _nComp, _sparseStoichSolid, _sparseExpSolidBwd, r, fluxGradBwd, -factor);
 		}
 	}
+
+	/**
+	 * @brief Rebuilds the compressed reaction network from the dense parameter matrices
+	 * @details Has to be called whenever a zero entry of a stoichiometry or exponent matrix may have
+	 *          become nonzero.
+	 */
+	void updateSparseNetwork()
+	{
+		_sparseStoichBulk.assign(_stoichiometryBulk.columns(), _stoichiometryBulk, nullptr, _pinnedEntries);
+		_sparseExpBulkFwd.assign(_stoichiometryBulk.columns(), _expBulkFwd, nullptr, _pinnedEntries);
+		_sparseExpBulkBwd.assign(_stoichiometryBulk.columns(), _expBulkBwd, nullptr, _pinnedEntries);
+
+		_sparseStoichLiquid.assign(_stoichiometryLiquid.columns(), _stoichiometryLiquid, nullptr, _pinnedEntries);
+		_sparseExpLiquidFwd.assign(_stoichiometryLiquid.columns(), _expLiquidFwd, &_expLiquidFwdSolid, _pinnedEntries);
+		_sparseExpLiquidBwd.assign(_stoichiometryLiquid.columns(), _expLiquidBwd, &_expLiquidBwdSolid, _pinnedEntries);
+
+		_sparseStoichSolid.assign(_stoichiometrySolid.columns(), _stoichiometrySolid, nullptr, _pinnedEntries);
+		_sparseExpSolidFwd.assign(_stoichiometrySolid.columns(), _expSolidFwdLiquid, &_expSolidFwd, _pinnedEntries);
+		_sparseExpSolidBwd.assign(_stoichiometrySolid.columns(), _expSolidBwdLiquid, &_expSolidBwd, _pinnedEntries);
+	}
 };
 
 typedef MassActionLawReactionBase<MassActionLawParamHandler> MassActionLawReaction;
@@ -0,0 +1,151 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "nonlin/AndersonAcceleration.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	/**
+	 * @brief Relative tolerance below which a residual difference is considered linearly dependent
+	 */
+	const double linDepTol = 1e-12;
+
+	inline double dot(double const* a, double const* b, unsigned int n)
+	{
+		double res = 0.0;
+		for (unsigned int i = 0; i < n; ++i)
+			res += a[i] * b[i];
+		return res;
+	}
+}
+
+namespace cadet
+{
+
+namespace nonlin
+{
+
+AndersonAcceleration::AndersonAcceleration() : _size(0), _depth(0), _numStored(0), _next(0), _hasPrevious(false) { }
+
+void AndersonAcceleration::resize(unsigned int size, unsigned int depth)
+{
+	_size = size;
+	_depth = depth;
+
+	_prevF.resize(size);
+	_prevG.resize(size);
+	_f.resize(size);
+	_dF.resize(size * depth);
+	_dG.resize(size * depth);
+	_q.resize(size * depth);
+	_r.resize(depth * depth);
+	_gamma.resize(depth);
+
+	reset();
+}
+
+void AndersonAcceleration::reset()
+{
+	_numStored = 0;
+	_next = 0;
+	_hasPrevious = false;
+}
+
+void AndersonAcceleration::update(double const* g, double* x)
+{
+	for (unsigned int i = 0; i < _size; ++i)
+		_f[i] = g[i] - x[i];
+
+	// Store differences to previous iterate
+	if (_hasPrevious && (_depth > 0))
+	{
+		double* const dF = _dF.data() + _next * _size;
+		double* const dG = _dG.data() + _next * _size;
+		for (unsigned int i = 0; i < _size; ++i)
+		{
+			dF[i] = _f[i] - _prevF[i];
+			dG[i] = g[i] - _prevG[i];
+		}
+
+		_numStored = std::min(_numStored + 1, _depth);
+		_next = (_next + 1) % _depth;
+	}
+
+	std::copy(_f.begin(), _f.end(), _prevF.begin());
+	std::copy(g, g + _size, _prevG.begin());
+	_hasPrevious = true;
+
+	// Start with plain fixed-point step
+	std::copy(g, g + _size, x);
+	if (_numStored == 0)
+		return;
+
+	// QR decomposition of residual differences by modified Gram-Schmidt, dropping dependent columns
+	std::vector<unsigned int> kept;
+	kept.reserve(_numStored);
+	for (unsigned int j = 0; j < _numStored; ++j)
+	{
+		double const* const col = _dF.data() + j * _size;
+		double* const q = _q.data() + kept.size() * _size;
+		std::copy(col, col + _size, q);
+
+		const double colNorm = std::sqrt(dot(col, col, _size));
+		for (unsigned int k = 0; k < kept.size(); ++k)
+		{
+			double const* const qk = _q.data() + k * _size;
+			const double rkj = dot(qk, q, _size);
+			_r[k + kept.size() * _depth] = rkj;
+			for (unsigned int i = 0; i < _size; ++i)
+				q[i] -= rkj * qk[i];
+		}
+
+		const double norm = std::sqrt(dot(q, q, _size));
+		if ((colNorm == 0.0) || (norm <= linDepTol * colNorm))
+			continue;
+
+		for (unsigned int i = 0; i < _size; ++i)
+			q[i] /= norm;
+
+		_r[kept.size() + kept.size() * _depth] = norm;
+		kept.push_back(j);
+	}
+
+	if (kept.empty())
+		return;
+
+	// Solve R * gamma = Q^T * f by back substitution
+	const unsigned int nKept = kept.size();
+	for (unsigned int k = 0; k < nKept; ++k)
+		_gamma[k] = dot(_q.data() + k * _size, _f.data(), _size);
+
+	for (unsigned int k = nKept; k-- > 0; )
+	{
+		for (unsigned int l = k + 1; l < nKept; ++l)
+			_gamma[k] -= _r[k + l * _depth] * _gamma[l];
+		_gamma[k] /= _r[k + k * _depth];
+	}
+
+	// Mix function values
+	for (unsigned int k = 0; k < nKept; ++k)
+	{
+		double const* const dG = _dG.data() + kept[k] * _size;
+		for (unsigned int i = 0; i < _size; ++i)
+			x[i] -= _gamma[k] * dG[i];
+	}
+}
+
+}  // namespace nonlin
+
+}  // namespace cadet
@@ -0,0 +1,92 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides Anderson acceleration for fixed-point iterations
+ */
+
+#ifndef LIBCADET_ANDERSONACCELERATION_HPP_
+#define LIBCADET_ANDERSONACCELERATION_HPP_
+
+#include <vector>
+
+namespace cadet
+{
+
+namespace nonlin
+{
+
+	/**
+	 * @brief Accelerates the fixed-point iteration @f$ x_{k+1} = G(x_k) @f$ by Anderson mixing
+	 * @details Keeps the differences of the last @f$ m @f$ residuals @f$ f_k = G(x_k) - x_k @f$ and
+	 *          function values @f$ g_k = G(x_k) @f$. The next iterate is given by
+	 *          @f[ x_{k+1} = g_k - \Delta G \gamma, \qquad \gamma = \operatorname{argmin}_\gamma \left\lVert f_k - \Delta F \gamma \right\rVert_2, @f]
+	 *          where the columns of @f$ \Delta F @f$ and @f$ \Delta G @f$ are the differences of
+	 *          consecutive residuals and function values, respectively (see Walker and Ni,
+	 *          SIAM J. Numer. Anal. 49(4), 2011). The least squares problem is solved by a QR
+	 *          decomposition using modified Gram-Schmidt orthogonalization. Columns that are
+	 *          (almost) linearly dependent on previous ones are dropped.
+	 *
+	 *          With depth @c 0 the plain fixed-point iteration @f$ x_{k+1} = g_k @f$ is performed.
+	 */
+	class AndersonAcceleration
+	{
+	public:
+		AndersonAcceleration();
+
+		/**
+		 * @brief Sets the problem size and the number of stored differences
+		 * @details Clears the history.
+		 * @param [in] size Number of unknowns
+		 * @param [in] depth Maximum number of stored differences @f$ m @f$
+		 */
+		void resize(unsigned int size, unsigned int depth);
+
+		/**
+		 * @brief Discards all stored differences
+		 * @details The next call to update() performs a plain fixed-point step.
+		 */
+		void reset();
+
+		/**
+		 * @brief Computes the next iterate from the current iterate and its image under the fixed-point map
+		 * @param [in] g Image @f$ g_k = G(x_k) @f$ of the current iterate
+		 * @param [in,out] x On entry the current iterate @f$ x_k @f$, on exit the next iterate @f$ x_{k+1} @f$
+		 */
+		void update(double const* g, double* x);
+
+		inline unsigned int depth() const { return _depth; }
+		inline unsigned int numStoredDifferences() const { return _numStored; }
+
+	protected:
+		unsigned int _size; //!< Number of unknowns
+		unsigned int _depth; //!< Maximum number of stored differences
+		unsigned int _numStored; //!< Number of currently stored differences
+		unsigned int _next; //!< Index of the column that is overwritten next (ring buffer)
+		bool _hasPrevious; //!< Determines whether the previous residual and function value are available
+
+		std::vector<double> _prevF; //!< Previous residual
+		std::vector<double> _prevG; //!< Previous function value
+		std::vector<double> _dF; //!< Residual differences (column-major, @c _size rows, @c _depth columns)
+		std::vector<double> _dG; //!< Function value differences (column-major, @c _size rows, @c _depth columns)
+		std::vector<double> _q; //!< Orthonormal basis of the residual differences (column-major)
+		std::vector<double> _r; //!< Upper triangular factor of the residual differences (column-major)
+		std::vector<double> _gamma; //!< Mixing coefficients
+		std::vector<double> _f; //!< Current residual
+	};
+
+} // namespace nonlin
+
+} // namespace cadet
+
+#endif  // LIBCADET_ANDERSONACCELERATION_HPP_
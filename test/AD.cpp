@@ -20,6 +20,7 @@
 
 #include "linalg/DenseMatrix.hpp"
 #include "linalg/BandMatrix.hpp"
+#include "linalg/CompressedSparseMatrix.hpp"
 #include "AdUtils.hpp"
 #include "AutoDiff.hpp"
 
@@ -240,3 +241,119 @@ TEST_CASE("Banded AD Jacobian vs FD", "[AD],[BandMatrix]")
 		y.data(), dir.data(), colA.data(), colB.data(), matSize, matSize, 1e-7, 0.0, 1e-15
 	);
 }
+
+/**
+ * @brief Creates a random sparsity pattern with full diagonal
+ * @param [in] rows Number of rows
+ * @param [in] nnzPerRow Number of random off-diagonal entries per row
+ * @return Sparsity pattern
+ */
+cadet::linalg::SparsityPattern createRandomSparsityPattern(int rows, int nnzPerRow)
+{
+	std::minstd_rand generator(42);
+	std::uniform_int_distribution<int> distribution(0, rows - 1);
+
+	cadet::linalg::SparsityPattern pattern(rows, nnzPerRow + 1);
+	for (int r = 0; r < rows; ++r)
+	{
+		pattern.add(r, r);
+		for (int i = 0; i < nnzPerRow; ++i)
+			pattern.add(r, distribution(generator));
+	}
+	return pattern;
+}
+
+/**
+ * @brief Creates a residual whose Jacobian has the pattern of the given matrix and values @f$ r \cdot n + c + 1 @f$
+ * @param [in] x Residual argument
+ * @param [out] out Vector that holds the residual
+ * @param [in] mat Matrix with pattern of the Jacobian
+ */
+template <typename T>
+void sparseMatrixJacobian(T const* x, T* out, const cadet::linalg::CompressedSparseMatrix& mat)
+{
+	const int n = mat.rows();
+	const std::vector<cadet::linalg::sparse_int_t>& colIdx = mat.columnIndices();
+	const std::vector<cadet::linalg::sparse_int_t>& rowStart = mat.rowStartIndices();
+	for (int r = 0; r < n; ++r)
+	{
+		out[r] = 0.0;
+		for (int k = rowStart[r]; k < rowStart[r + 1]; ++k)
+			out[r] += static_cast<double>(r * n + colIdx[k] + 1) * x[colIdx[k]];
+	}
+}
+
+TEST_CASE("Column coloring of sparse Jacobian", "[AD],[SparseMatrix]")
+{
+	SECTION("Tridiagonal pattern")
+	{
+		const int matSize = 20;
+		cadet::linalg::SparsityPattern pattern(matSize, 3);
+		for (int r = 0; r < matSize; ++r)
+		{
+			for (int c = std::max(r - 1, 0); c <= std::min(r + 1, matSize - 1); ++c)
+				pattern.add(r, c);
+		}
+
+		std::vector<int> colors;
+		CHECK(cadet::ad::computeColumnColoring(pattern, colors) == 3);
+		REQUIRE(colors.size() == matSize);
+	}
+
+	SECTION("Random pattern")
+	{
+		const int matSize = 60;
+		const cadet::linalg::CompressedSparseMatrix mat(createRandomSparsityPattern(matSize, 4));
+
+		std::vector<int> colors;
+		const int numColors = cadet::ad::computeColumnColoring(mat, colors);
+		REQUIRE(colors.size() == matSize);
+		CHECK(numColors < matSize);
+
+		// Columns that share a row must have different colors
+		const std::vector<cadet::linalg::sparse_int_t>& colIdx = mat.columnIndices();
+		const std::vector<cadet::linalg::sparse_int_t>& rowStart = mat.rowStartIndices();
+		for (int r = 0; r < matSize; ++r)
+		{
+			CHECK(rowStart[r + 1] - rowStart[r] <= numColors);
+			for (int k = rowStart[r]; k < rowStart[r + 1]; ++k)
+			{
+				CHECK(colors[colIdx[k]] >= 0);
+				CHECK(colors[colIdx[k]] < numColors);
+				for (int l = k + 1; l < rowStart[r + 1]; ++l)
+					CHECK(colors[colIdx[k]] != colors[colIdx[l]]);
+			}
+		}
+	}
+}
+
+TEST_CASE("Extract sparse Jacobian via colored AD", "[AD],[SparseMatrix]")
+{
+	const int matSize = 60;
+	cadet::linalg::CompressedSparseMatrix mat(createRandomSparsityPattern(matSize, 4));
+
+	std::vector<int> colors;
+	const int numColors = cadet::ad::computeColumnColoring(mat, colors);
+
+	// Initialize AD and allocate AD vectors
+	cadet::ad::setDirections(numColors);
+
+	std::vector<cadet::active> res(matSize);
+	std::vector<cadet::active> x(matSize);
+
+	// Set seed vectors
+	cadet::ad::prepareAdVectorSeedsForColoring(x.data(), 0, matSize, colors.data());
+	cadet::ad::fillAd(x.data(), matSize, 0.0);
+
+	// Compute residual with sparse Jacobian and extract it
+	sparseMatrixJacobian(x.data(), res.data(), mat);
+	cadet::ad::extractJacobianFromColoredAd(res.data(), 0, colors.data(), mat);
+
+	const std::vector<cadet::linalg::sparse_int_t>& colIdx = mat.columnIndices();
+	const std::vector<cadet::linalg::sparse_int_t>& rowStart = mat.rowStartIndices();
+	for (int r = 0; r < matSize; ++r)
+	{
+		for (int k = rowStart[r]; k < rowStart[r + 1]; ++k)
+			CHECK(mat.data()[k] == static_cast<double>(r * matSize + colIdx[k] + 1));
+	}
+}
@@ -23,6 +23,7 @@
 #include "common/JsonParameterProvider.hpp"
 
 #include "BindingModelFactory.hpp"
+#include "ModelBuilderImpl.hpp"
 #include "model/BindingModel.hpp"
 #include "linalg/DenseMatrix.hpp"
 #include "linalg/BandMatrix.hpp"
@@ -31,6 +32,8 @@
 
 #include <cstring>
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace
 {
@@ -472,6 +475,119 @@ void testNonbindingBindingConsistency(const char* modelName, unsigned int nCompB
 	}
 }
 
+void testFluxBatchConsistency(const char* modelName, unsigned int nComp, unsigned int const* nBound, bool isKinetic, const char* config, double const* point, unsigned int nCells)
+{
+	ConfiguredBindingModel cbm = ConfiguredBindingModel::create(modelName, nComp, nBound, isKinetic, config);
+	REQUIRE(cbm.model().supportsFluxBatch());
+
+	const unsigned int nBoundTotal = cbm.numBoundStates();
+	const unsigned int numDofs = cbm.nComp() + nBoundTotal;
+
+	// Create states of all cells in structure-of-arrays layout
+	std::vector<ColumnPosition> colPos(nCells);
+	std::vector<double> yCp(nCells * cbm.nComp(), 0.0);
+	std::vector<double> y(nCells * nBoundTotal, 0.0);
+	for (unsigned int k = 0; k < nCells; ++k)
+	{
+		const double scale = 1.0 + 0.25 * k;
+		colPos[k] = ColumnPosition{static_cast<double>(k) / nCells, 0.0, 0.5};
+
+		for (unsigned int i = 0; i < cbm.nComp(); ++i)
+			yCp[i * nCells + k] = point[i] * scale;
+		for (unsigned int i = 0; i < nBoundTotal; ++i)
+			y[i * nCells + k] = point[cbm.nComp() + i] * scale;
+	}
+
+	// Evaluate batch
+	std::vector<double> resBatch(nCells * nBoundTotal, 0.0);
+	std::vector<double> batchMem(cbm.model().fluxBatchWorkspaceSize(nComp, nBoundTotal, nBound, nCells) / sizeof(double) + 1, 0.0);
+	cadet::LinearBufferAllocator batchBuffer(batchMem.data(), batchMem.data() + batchMem.size());
+	REQUIRE(cbm.model().fluxBatch(1.0, 0u, colPos.data(), nCells, y.data(), yCp.data(), resBatch.data(), batchBuffer) == 0);
+
+	// Compare with single cell evaluation
+	std::vector<double> yState(numDofs, 0.0);
+	std::vector<double> res(nBoundTotal, 0.0);
+	for (unsigned int k = 0; k < nCells; ++k)
+	{
+		for (unsigned int i = 0; i < cbm.nComp(); ++i)
+			yState[i] = yCp[i * nCells + k];
+		for (unsigned int i = 0; i < nBoundTotal; ++i)
+			yState[cbm.nComp() + i] = y[i * nCells + k];
+
+		cbm.model().flux(1.0, 0u, colPos[k], yState.data() + cbm.nComp(), yState.data(), res.data(), cbm.buffer());
+
+		for (unsigned int i = 0; i < nBoundTotal; ++i)
+		{
+			CAPTURE(k);
+			CAPTURE(i);
+			CHECK(resBatch[i * nCells + k] == RelApprox(res[i]));
+		}
+	}
+}
+
+void testExternalFunctionCacheConsistency(const char* modelName, unsigned int nComp, unsigned int const* nBound, bool isKinetic, const char* config, double const* point, unsigned int nCells)
+{
+	ConfiguredBindingModel cbm = ConfiguredBindingModel::create(modelName, nComp, nBound, isKinetic, config);
+	REQUIRE(cbm.model().dependsOnTime());
+
+	// Use an external function that depends on time and axial position
+	cadet::ModelBuilder builder;
+	std::unique_ptr<cadet::IExternalFunction> extFun(builder.createExternalFunction("LINEAR_INTERP_DATA"));
+	REQUIRE(extFun);
+
+	cadet::JsonParameterProvider jpp(R"json({
+		"TIME": [0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0],
+		"DATA": [1.0, 2.0, 1.5, 0.5, 0.75, 1.25, 1.0],
+		"VELOCITY": 0.5
+	})json");
+	REQUIRE(extFun->configure(&jpp));
+
+	std::vector<cadet::IExternalFunction*> extFuns(50, extFun.get());
+	cbm.model().setExternalFunctions(extFuns.data(), extFuns.size());
+
+	std::vector<ColumnPosition> grid(nCells);
+	for (unsigned int k = 0; k < nCells; ++k)
+		grid[k] = ColumnPosition{(0.5 + k) / nCells, 0.0, 0.5, static_cast<int>(k)};
+
+	const unsigned int nBoundTotal = cbm.numBoundStates();
+	std::vector<double> resCached(nBoundTotal, 0.0);
+	std::vector<double> res(nBoundTotal, 0.0);
+
+	const auto compare = [&](double t)
+	{
+		for (unsigned int k = 0; k < nCells; ++k)
+		{
+			const ColumnPosition colPos{grid[k].axial, grid[k].radial, grid[k].particle};
+			cbm.model().flux(t, 0u, grid[k], point + cbm.nComp(), point, resCached.data(), cbm.buffer());
+			cbm.model().flux(t, 0u, colPos, point + cbm.nComp(), point, res.data(), cbm.buffer());
+
+			for (unsigned int i = 0; i < nBoundTotal; ++i)
+			{
+				CAPTURE(t);
+				CAPTURE(k);
+				CAPTURE(i);
+				CHECK(resCached[i] == res[i]);
+			}
+		}
+	};
+
+	// Cached values are used for matching time
+	cbm.model().updateExternalFunctionCache(0.7, 0u, grid.data(), nCells);
+	compare(0.7);
+
+	// Time differs from cache
+	compare(1.3);
+
+	// Cache is refilled for new time
+	cbm.model().updateExternalFunctionCache(1.3, 0u, grid.data(), nCells);
+	compare(1.3);
+	compare(0.7);
+
+	// Invalidated cache is not used
+	cbm.model().invalidateExternalFunctionCache();
+	compare(1.3);
+}
+
 } // namespace binding
 } // namespace test
 } // namespace cadet
@@ -175,6 +175,33 @@ namespace binding
 	 */
 	void testNonbindingBindingConsistency(const char* modelName, unsigned int nCompBnd, unsigned int nCompNonBnd, unsigned int const* nBound, unsigned int const* nBoundNonBnd, bool isKinetic, const char* configBnd, const char* configNonBnd, bool useAD, double const* pointBnd, double const* pointNonBnd);
 
+	/**
+	 * @brief Checks batched flux evaluation of multiple cells against single cell evaluation
+	 * @details Each cell uses a differently scaled version of @p point as state.
+	 * @param [in] modelName Name of the binding model
+	 * @param [in] nComp Number of components
+	 * @param [in] nBound Array with number of bound states for each component
+	 * @param [in] isKinetic Determines whether kinetic or quasi-stationary binding mode is applied
+	 * @param [in] config JSON string with binding model parameters
+	 * @param [in] point Liquid phase and solid phase values of the first cell
+	 * @param [in] nCells Number of cells
+	 */
+	void testFluxBatchConsistency(const char* modelName, unsigned int nComp, unsigned int const* nBound, bool isKinetic, const char* config, double const* point, unsigned int nCells);
+
+	/**
+	 * @brief Checks fluxes evaluated with cached external functions against uncached evaluation
+	 * @details The external functions are replaced by a linear interpolation that depends on time
+	 *          and axial position. The cache is filled on a grid of @p nCells axial positions.
+	 * @param [in] modelName Name of the externally dependent binding model
+	 * @param [in] nComp Number of components
+	 * @param [in] nBound Array with number of bound states for each component
+	 * @param [in] isKinetic Determines whether kinetic or quasi-stationary binding mode is applied
+	 * @param [in] config JSON string with binding model parameters
+	 * @param [in] point Liquid phase and solid phase values
+	 * @param [in] nCells Number of grid positions
+	 */
+	void testExternalFunctionCacheConsistency(const char* modelName, unsigned int nComp, unsigned int const* nBound, bool isKinetic, const char* config, double const* point, unsigned int nCells);
+
 } // namespace binding
 } // namespace test
 } // namespace cadet
@@ -1620,3 +1620,110 @@ CADET_BINDINGTEST("HIC_CONSTANT_WATER_ACTIVITY", "EXT_HIC_CONSTANT_WATER_ACTIVIT
 	)json", \
 	1e-10, 1e-10, CADET_NONBINDING_LIQUIDPHASE_COMP_USED, CADET_COMPARE_BINDING_VS_NONBINDING)
 
+
+TEST_CASE("MULTI_COMPONENT_LANGMUIR batched flux vs single cell flux", "[BindingModel],[FluxBatch]")
+{
+	const unsigned int nBound[] = {1, 1};
+	const double point[] = {1.0, 2.0, 0.5, 1.5};
+	cadet::test::binding::testFluxBatchConsistency("MULTI_COMPONENT_LANGMUIR", 2, nBound, true, R"json({
+		"MCL_KA": [1.14, 2.0],
+		"MCL_KD": [0.004, 0.008],
+		"MCL_QMAX": [4.88, 3.5]
+	})json", point, 5);
+}
+
+TEST_CASE("EXT_MULTI_COMPONENT_LANGMUIR batched flux vs single cell flux", "[BindingModel],[FluxBatch]")
+{
+	const unsigned int nBound[] = {1, 0, 1};
+	const double point[] = {1.0, 3.0, 2.0, 0.5, 1.5};
+	cadet::test::binding::testFluxBatchConsistency("EXT_MULTI_COMPONENT_LANGMUIR", 3, nBound, true, R"json({
+		"EXT_MCL_KA": [0.1, 0.0, 0.2],
+		"EXT_MCL_KA_T": [1.14, 0.0, 2.0],
+		"EXT_MCL_KA_TT": [0.0, 0.0, 0.0],
+		"EXT_MCL_KA_TTT": [0.0, 0.0, 0.0],
+		"EXT_MCL_KD": [0.0, 0.0, 0.0],
+		"EXT_MCL_KD_T": [0.004, 0.0, 0.008],
+		"EXT_MCL_KD_TT": [0.0, 0.0, 0.0],
+		"EXT_MCL_KD_TTT": [0.0, 0.0, 0.0],
+		"EXT_MCL_QMAX": [1.0, 0.0, 1.0],
+		"EXT_MCL_QMAX_T": [4.88, 0.0, 3.5],
+		"EXT_MCL_QMAX_TT": [0.0, 0.0, 0.0],
+		"EXT_MCL_QMAX_TTT": [0.0, 0.0, 0.0]
+	})json", point, 5);
+}
+
+TEST_CASE("STERIC_MASS_ACTION batched flux vs single cell flux", "[BindingModel],[FluxBatch]")
+{
+	const unsigned int nBound[] = {1, 1, 1};
+	const double point[] = {1.2, 2.0, 1.5, 80.0, 3.5, 2.7};
+	cadet::test::binding::testFluxBatchConsistency("STERIC_MASS_ACTION", 3, nBound, true, R"json({
+		"SMA_KA": [0.0, 3.55, 1.59],
+		"SMA_KD": [0.0, 10.0, 10.0],
+		"SMA_NU": [1.5, 2.0, 1.5],
+		"SMA_SIGMA": [0.0, 11.83, 10.6],
+		"SMA_LAMBDA": 100.0,
+		"SMA_REFC0": 2.0,
+		"SMA_REFQ": 1.1
+	})json", point, 5);
+}
+
+TEST_CASE("MOBILE_PHASE_MODULATOR batched flux vs single cell flux", "[BindingModel],[FluxBatch]")
+{
+	const unsigned int nBound[] = {1, 1, 0, 1};
+	const double point[] = {1.2, 1.5, 1.0, 2.0, 0.5, 1.5, 1.8};
+	cadet::test::binding::testFluxBatchConsistency("MOBILE_PHASE_MODULATOR", 4, nBound, true, R"json({
+		"MPM_KA": [0.0, 1.14, 1.0, 2.0],
+		"MPM_KD": [0.0, 0.004, 2.0, 0.008],
+		"MPM_QMAX": [0.0, 4.88, 3.0, 3.5],
+		"MPM_GAMMA": [0.0, 0.5, 0.0, -1.0],
+		"MPM_BETA": [0.0, 1.5, 0.0, 2.0],
+		"MPM_LINEAR_THRESHOLD": 1e-10
+	})json", point, 5);
+}
+
+TEST_CASE("MULTI_COMPONENT_BILANGMUIR batched flux vs single cell flux", "[BindingModel],[FluxBatch]")
+{
+	const unsigned int nBound[] = {2, 2};
+	const double point[] = {1.0, 2.0, 0.1, 0.2, 0.3, 0.4};
+	cadet::test::binding::testFluxBatchConsistency("MULTI_COMPONENT_BILANGMUIR", 2, nBound, true, R"json({
+		"MCBL_KA": [1.14, 2.0, 2.28, 4.0],
+		"MCBL_KD": [0.004, 0.008, 0.002, 0.003],
+		"MCBL_QMAX": [4.88, 3.5, 3.88, 2.5]
+	})json", point, 5);
+}
+
+TEST_CASE("EXT_MULTI_COMPONENT_LANGMUIR cached external functions vs uncached evaluation", "[BindingModel],[ExternalFunction]")
+{
+	const unsigned int nBound[] = {1, 0, 1};
+	const double point[] = {1.0, 3.0, 2.0, 0.5, 1.5};
+	cadet::test::binding::testExternalFunctionCacheConsistency("EXT_MULTI_COMPONENT_LANGMUIR", 3, nBound, true, R"json({
+		"EXT_MCL_KA": [0.1, 0.0, 0.2],
+		"EXT_MCL_KA_T": [1.14, 0.0, 2.0],
+		"EXT_MCL_KA_TT": [0.0, 0.0, 0.0],
+		"EXT_MCL_KA_TTT": [0.0, 0.0, 0.0],
+		"EXT_MCL_KD": [0.0, 0.0, 0.0],
+		"EXT_MCL_KD_T": [0.004, 0.0, 0.008],
+		"EXT_MCL_KD_TT": [0.0, 0.0, 0.0],
+		"EXT_MCL_KD_TTT": [0.0, 0.0, 0.0],
+		"EXT_MCL_QMAX": [1.0, 0.0, 1.0],
+		"EXT_MCL_QMAX_T": [4.88, 0.0, 3.5],
+		"EXT_MCL_QMAX_TT": [0.0, 0.0, 0.0],
+		"EXT_MCL_QMAX_TTT": [0.0, 0.0, 0.0]
+	})json", point, 7);
+}
+
+TEST_CASE("EXT_LINEAR cached external functions vs uncached evaluation", "[BindingModel],[ExternalFunction]")
+{
+	const unsigned int nBound[] = {1, 1};
+	const double point[] = {1.0, 2.0, 0.5, 1.5};
+	cadet::test::binding::testExternalFunctionCacheConsistency("EXT_LINEAR", 2, nBound, true, R"json({
+		"EXT_LIN_KA": [1.0, 2.0],
+		"EXT_LIN_KA_T": [0.5, 0.25],
+		"EXT_LIN_KA_TT": [0.0, 0.1],
+		"EXT_LIN_KA_TTT": [0.0, 0.0],
+		"EXT_LIN_KD": [0.1, 0.2],
+		"EXT_LIN_KD_T": [0.01, 0.02],
+		"EXT_LIN_KD_TT": [0.0, 0.0],
+		"EXT_LIN_KD_TTT": [0.0, 0.0]
+	})json", point, 7);
+}
@@ -1545,6 +1545,80 @@ namespace column
 		destroyModelBuilder(mb);
 	}
 
+	void testConsistentInitializationIdenticalCells(const std::string& uoType, double consTol)
+	{
+		cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+		REQUIRE(nullptr != mb);
+
+		// Two different particle shell states (liquid and solid phase)
+		const unsigned int nShellDofs = 8;
+		const double shellState[2][nShellDofs] = {{1.2, 2.0, 1.0, 1.5, 840.0, 63.0, 3.0, 3.0}, {1.0, 1.8, 1.5, 1.6, 840.0, 63.0, 6.0, 3.0}};
+
+		// Applies consistent initialization to a state with the given particle shells and returns the particle block
+		const auto consistentParticles = [&](unsigned int nCol, unsigned int nPar, const std::function<unsigned int(unsigned int, unsigned int)>& shellType) -> std::vector<double>
+		{
+			cadet::JsonParameterProvider jpp = createColumnWithSMA(uoType, "FV");
+			cadet::test::setBindingMode(jpp, false);
+			FVparams disc(nCol, nPar);
+			cadet::IUnitOperation* const unit = createAndConfigureUnit(*mb, jpp, disc);
+			unit->useAnalyticJacobian(true);
+
+			// Inlet, bulk, particles, and fluxes
+			const unsigned int nComp = unit->numComponents();
+			const unsigned int offsetPar = nComp + nCol * nComp;
+			const unsigned int nParDofs = unit->numDofs() - offsetPar - nCol * nComp;
+			const unsigned int nShells = nParDofs / (nCol * nShellDofs);
+			REQUIRE(nShells * nCol * nShellDofs == nParDofs);
+
+			std::vector<double> y(unit->numDofs(), 0.0);
+			std::vector<double> yDot(unit->numDofs(), 0.0);
+			cadet::test::util::populate(y.data(), [](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, offsetPar);
+			for (unsigned int col = 0; col < nCol; ++col)
+			{
+				for (unsigned int shell = 0; shell < nShells; ++shell)
+					std::copy_n(shellState[shellType(col, shell)], nShellDofs, y.data() + offsetPar + (col * nShells + shell) * nShellDofs);
+			}
+			cadet::test::util::populate(y.data() + offsetPar + nParDofs, [](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, nCol * nComp);
+
+			cadet::util::ThreadLocalStorage tls;
+			tls.resize(unit->threadLocalMemorySize());
+
+			const AdJacobianParams noAd{nullptr, nullptr, 0u};
+			unit->notifyDiscontinuousSectionTransition(0.0, 0u, {y.data(), yDot.data()}, noAd);
+			unit->consistentInitialState(SimulationTime{0.0, 0u}, y.data(), noAd, consTol, tls);
+
+			mb->destroyUnitOperation(unit);
+			return std::vector<double>(y.begin() + offsetPar, y.begin() + offsetPar + nParDofs);
+		};
+
+		// Reference solutions of a single particle shell without any grouping or reuse
+		const std::vector<double> ref[2] = {
+			consistentParticles(1, 1, [](unsigned int, unsigned int) { return 0u; }),
+			consistentParticles(1, 1, [](unsigned int, unsigned int) { return 1u; })
+		};
+		REQUIRE(ref[0].size() == nShellDofs);
+
+		// Groups of identical cells and, in case of the GRM, identical neighboring shells
+		const unsigned int nCol = 8;
+		const auto cellType = [](unsigned int col, unsigned int shell) { return (col / 3u + shell / 2u) % 2u; };
+		const std::vector<double> grouped = consistentParticles(nCol, 4, cellType);
+
+		const unsigned int nShells = grouped.size() / (nCol * nShellDofs);
+		for (unsigned int col = 0; col < nCol; ++col)
+		{
+			for (unsigned int shell = 0; shell < nShells; ++shell)
+			{
+				CAPTURE(col);
+				CAPTURE(shell);
+				const std::vector<double>& expected = ref[cellType(col, shell)];
+				for (unsigned int i = 0; i < nShellDofs; ++i)
+					CHECK(grouped[(col * nShells + shell) * nShellDofs + i] == expected[i]);
+			}
+		}
+
+		destroyModelBuilder(mb);
+	}
+
 	void testConsistentInitializationSensitivity(const std::string& uoType, const std::string& spatialMethod, double const* const y, double const* const yDot, bool linearBinding, double absTol, const int reqBnd, const int useAD)
 	{
 		cadet::IModelBuilder* const mb = cadet::createModelBuilder();
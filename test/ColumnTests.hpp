@@ -333,6 +333,17 @@ namespace column
 	 */
 	void testConsistentInitializationSMABinding(const std::string& uoType, const std::string& spatialMethod, double const* const initState, double consTol, double absTol, const int reqBnd = -1, const int useAD = -1);
 
+	/**
+	 * @brief Checks that consistent initialization of identical cells matches independent solves
+	 * @details Consecutive column cells (and particle shells) with identical state are grouped and
+	 *          solved only once in consistent initialization. The result of a column with groups
+	 *          of identical cells and SMA binding is compared to the consistent initialization of a
+	 *          single cell, which is solved without any grouping or reuse.
+	 * @param [in] uoType Unit operation type
+	 * @param [in] consTol Error tolerance for consistent initialization solver
+	 */
+	void testConsistentInitializationIdenticalCells(const std::string& uoType, double consTol);
+
 	/**
 	 * @brief Checks consistent initialization of sensitivities in a column-like model
 	 * @details Assumes column-like unit models and checks the residual of the sensitivity equations after
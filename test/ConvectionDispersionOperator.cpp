@@ -639,6 +639,77 @@ void testBulkJacobianSparseBandedWeno(int wenoOrder, bool forwardFlow)
 	}
 }
 
+void testAxialBatchWenoVsStencil(int wenoOrder, cadet::Weno::BoundaryTreatment bndTreatment)
+{
+	SECTION("WENO=" + std::to_string(wenoOrder) + " BOUNDARY_MODEL=" + std::to_string(static_cast<int>(bndTreatment)))
+	{
+		int nComp = 3;
+		int nCol = 20;
+
+		const double u = 1e-3;
+		const std::vector<cadet::active> d_c(nComp, 1e-6);
+		const double h = 1e-3 / nCol;
+		const int strideCell = nComp;
+
+		cadet::ArrayPool stencilMemory(sizeof(double) * cadet::Weno::maxStencilSize());
+		std::vector<double> wenoDerivatives(cadet::Weno::maxStencilSize(), 0.0);
+		cadet::ArrayPool batchMemory(sizeof(double) * 2 * (nCol + cadet::Weno::maxOrder() - 1));
+		std::vector<double> batchDerivatives(nCol * cadet::Weno::maxStencilSize(), 0.0);
+
+		cadet::Weno weno;
+		weno.order(wenoOrder);
+		weno.boundaryTreatment(bndTreatment);
+
+		AxialFlow ft;
+		AxialFlow::Params fpStencil = ft.makeParams(u, d_c.data(), h, wenoDerivatives.data(), &weno, &stencilMemory, strideCell, nComp, nCol);
+		AxialFlow::Params fpBatch = ft.makeParams(u, d_c.data(), h, wenoDerivatives.data(), &weno, &stencilMemory, strideCell, nComp, nCol);
+		fpBatch.wenoBatchMemory = &batchMemory;
+		fpBatch.wenoBatchDerivatives = batchDerivatives.data();
+
+		// Obtain memory for state and residuals
+		const int nDof = nComp + nComp * nCol;
+		std::vector<double> y(nDof, 0.0);
+		std::vector<double> resStencil(nDof, 0.0);
+		std::vector<double> resBatch(nDof, 0.0);
+
+		// Fill state vector with some values
+		cadet::test::util::populate(y.data(), [](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, nDof);
+
+		// Compare residuals
+		AxialFlow::residual(y.data(), nullptr, resStencil.data(), fpStencil);
+		AxialFlow::residual(y.data(), nullptr, resBatch.data(), fpBatch);
+
+		for (int i = nComp; i < nDof; ++i)
+		{
+			CAPTURE(i);
+			CHECK(resStencil[i] == resBatch[i]);
+		}
+
+		// Compare Jacobians
+		const unsigned int lowerBandwidth = std::max(weno.lowerBandwidth() + 1u, 1u) * strideCell;
+		const unsigned int upperBandwidth = std::max(weno.upperBandwidth(), 1u) * strideCell;
+		cadet::linalg::BandMatrix jacStencil;
+		cadet::linalg::BandMatrix jacBatch;
+		jacStencil.resize(nComp * nCol, lowerBandwidth, upperBandwidth);
+		jacBatch.resize(nComp * nCol, lowerBandwidth, upperBandwidth);
+		jacStencil.setAll(0.0);
+		jacBatch.setAll(0.0);
+
+		AxialFlow::residualWithJacobian<cadet::linalg::BandMatrix::RowIterator>(y.data(), nullptr, resStencil.data(), jacStencil.row(0), fpStencil);
+		AxialFlow::residualWithJacobian<cadet::linalg::BandMatrix::RowIterator>(y.data(), nullptr, resBatch.data(), jacBatch.row(0), fpBatch);
+
+		for (int row = 0; row < jacStencil.rows(); ++row)
+		{
+			for (int diag = -static_cast<int>(lowerBandwidth); diag <= static_cast<int>(upperBandwidth); ++diag)
+			{
+				CAPTURE(row);
+				CAPTURE(diag);
+				CHECK(jacStencil(row, diag) == jacBatch(row, diag));
+			}
+		}
+	}
+}
+
 TEST_CASE("AxialConvectionDispersionOperator residual forward vs backward flow", "[Operator],[AxialFlow],[Residual]")
 {
 	// Test all WENO orders
@@ -691,6 +762,17 @@ TEST_CASE("AxialConvectionDispersionKernel Jacobian sparse vs banded", "[Operato
 }
 
 
+TEST_CASE("AxialConvectionDispersionKernel batch WENO reconstruction vs stencil", "[Operator],[AxialFlow],[Residual],[Jacobian],[Weno]")
+{
+	for (int bnd = 0; bnd <= 2; ++bnd)
+	{
+		// Test all WENO orders
+		for (unsigned int i = 1; i <= cadet::Weno::maxOrder(); ++i)
+			testAxialBatchWenoVsStencil(i, static_cast<cadet::Weno::BoundaryTreatment>(bnd));
+	}
+}
+
+
 TEST_CASE("RadialConvectionDispersionOperator residual forward vs backward flow", "[Operator],[RadialFlow],[Residual]")
 {
 	// Test all WENO orders
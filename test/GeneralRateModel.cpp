@@ -183,6 +183,11 @@ TEST_CASE("GRM consistent initialization with linear binding", "[GRM],[FV],[Cons
 //	cadet::test::column::testConsistentInitializationSMABinding("GENERAL_RATE_MODEL", y.data(), 1e-14, 1e-5);
 //}
 
+TEST_CASE("GRM consistent initialization of identical cells matches single cell", "[GRM],[FV],[ConsistentInit],[CI]")
+{
+	cadet::test::column::testConsistentInitializationIdenticalCells("GENERAL_RATE_MODEL", 1e-14);
+}
+
 TEST_CASE("GRM consistent sensitivity initialization with linear binding", "[GRM],[FV],[ConsistentInit],[Sensitivity],[CI]")
 {
 	// Fill state vector with given initial values
@@ -128,6 +128,53 @@ TEST_CASE("GRM_DG LWE DGSEM and GSM particle discretization yields similar accur
 	}
 }
 
+TEST_CASE("GRM_DG LWE preconditioned GMRES matches direct linear solver", "[GRM],[DG],[Simulation],[LinearSolver],[CI]")
+{
+	cadet::JsonParameterProvider jpp = createLWE("GENERAL_RATE_MODEL", "DG");
+	cadet::test::column::DGparams disc;
+	disc.setDisc(jpp);
+
+	const double absTol = 1e-8;
+	const double relTol = 1e-5;
+
+	cadet::Driver drvDirect;
+	drvDirect.configure(jpp);
+	drvDirect.run();
+
+	cadet::InternalStorageUnitOpRecorder const* const directData = drvDirect.solution()->unitOperation(0);
+	const unsigned int nComp = directData->numComponents();
+
+	for (const char* precondSolver : { "SparseLU", "IncompleteLUT" })
+	{
+		SECTION(std::string("Preconditioner ") + precondSolver)
+		{
+			jpp.pushScope("model");
+			jpp.pushScope("unit_000");
+			jpp.pushScope("discretization");
+			jpp.set("LINEAR_SOLVER", "GMRES");
+			jpp.set("PRECONDITIONER_SOLVER", precondSolver);
+			jpp.popScope();
+			jpp.popScope();
+			jpp.popScope();
+
+			cadet::Driver drvGmres;
+			drvGmres.configure(jpp);
+			drvGmres.run();
+
+			cadet::InternalStorageUnitOpRecorder const* const gmresData = drvGmres.solution()->unitOperation(0);
+
+			double const* directOutlet = directData->outlet();
+			double const* gmresOutlet = gmresData->outlet();
+
+			for (unsigned int i = 0; i < directData->numDataPoints() * directData->numInletPorts() * nComp; ++i, ++directOutlet, ++gmresOutlet)
+			{
+				CAPTURE(i);
+				CHECK((*gmresOutlet) == cadet::test::makeApprox(*directOutlet, relTol, absTol));
+			}
+		}
+	}
+}
+
 TEST_CASE("GRM_DG time derivative Jacobian vs FD", "[GRM],[DG],[UnitOp],[Residual],[Jacobian],[CI],[FD]")
 {
 	cadet::test::column::testTimeDerivativeJacobianFD("GENERAL_RATE_MODEL", "DG", 1e-6, 0.0, 9e-4);
@@ -0,0 +1,163 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+
+#define CADET_LOGGING_DISABLE
+#include "Logging.hpp"
+
+#include "io/hdf5/HDF5Reader.hpp"
+#include "io/hdf5/HDF5CachedReader.hpp"
+#include "common/ParameterProviderImpl.hpp"
+
+#include <string>
+#include <vector>
+
+const char* getTestDirectory();
+
+namespace
+{
+	/**
+	 * @brief Compares all items of the current group of both readers recursively
+	 * @param [in] ref Reference reader that reads directly from the file
+	 * @param [in] cached Reader that serves requests from its cache
+	 * @param [in,out] numDatasets Number of compared datasets
+	 */
+	void compareGroups(cadet::io::HDF5Reader& ref, cadet::io::HDF5CachedReader& cached, int& numDatasets)
+	{
+		const std::vector<std::string> names = ref.itemNames();
+		REQUIRE(cached.numItems() == ref.numItems());
+		CHECK(cached.itemNames() == names);
+
+		for (std::size_t i = 0; i < names.size(); ++i)
+		{
+			const std::string& name = names[i];
+			CAPTURE(name);
+
+			CHECK(cached.itemName(i) == ref.itemName(i));
+			REQUIRE(cached.exists(name));
+			REQUIRE(cached.isGroup(name) == ref.isGroup(name));
+
+			if (ref.isGroup(name))
+			{
+				CHECK_FALSE(cached.isVector(name));
+
+				ref.pushGroup(name);
+				cached.pushGroup(name);
+				compareGroups(ref, cached, numDatasets);
+				ref.popGroup();
+				cached.popGroup();
+				continue;
+			}
+
+			++numDatasets;
+			CHECK(cached.isVector(name) == ref.isVector(name));
+			CHECK(cached.isString(name) == ref.isString(name));
+			CHECK(cached.isInt(name) == ref.isInt(name));
+			CHECK(cached.isDouble(name) == ref.isDouble(name));
+			CHECK(cached.arraySize(name) == ref.arraySize(name));
+			CHECK(cached.tensorDimensions(name) == ref.tensorDimensions(name));
+
+			if (ref.isString(name))
+			{
+				CHECK(cached.vector<std::string>(name) == ref.vector<std::string>(name));
+				CHECK(cached.scalar<std::string>(name) == ref.scalar<std::string>(name));
+			}
+			else if (ref.arraySize(name) > 0)
+			{
+				CHECK(cached.vector<double>(name) == ref.vector<double>(name));
+				CHECK(cached.scalar<double>(name) == ref.scalar<double>(name));
+				if (ref.isInt(name))
+				{
+					CHECK(cached.vector<int>(name) == ref.vector<int>(name));
+					CHECK(cached.vector<uint64_t>(name) == ref.vector<uint64_t>(name));
+					CHECK(cached.scalar<int>(name, ref.arraySize(name) - 1) == ref.scalar<int>(name, ref.arraySize(name) - 1));
+				}
+			}
+		}
+	}
+
+	void compareReaders(const std::string& fileName)
+	{
+		const std::string file = std::string(getTestDirectory()) + fileName;
+
+		cadet::io::HDF5Reader ref;
+		ref.openFile(file, "r");
+
+		cadet::io::HDF5CachedReader cached;
+		cached.openFile(file, "r");
+
+		REQUIRE(cached.exists("input"));
+		CHECK_FALSE(cached.exists("doesNotExist"));
+		CHECK_FALSE(cached.isVector("doesNotExist"));
+		CHECK_THROWS_AS(cached.scalar<double>("doesNotExist"), cadet::io::IOException);
+
+		ref.setGroup("input");
+		cached.setGroup("input");
+
+		int numDatasets = 0;
+		compareGroups(ref, cached, numDatasets);
+		CHECK(numDatasets > 0);
+
+		// Element names may span multiple groups
+		CHECK(cached.scalar<int>("model/NUNITS") == ref.scalar<int>("model/NUNITS"));
+		CHECK(cached.exists("model/solver"));
+		CHECK_FALSE(cached.exists("model/NUNITS/foo"));
+
+		// Scopes of the parameter provider are relative to the current group
+		cadet::ParameterProviderImpl<cadet::io::HDF5Reader> ppRef(ref);
+		cadet::ParameterProviderImpl<cadet::io::HDF5CachedReader> ppCached(cached);
+		ppRef.pushScope("solver");
+		ppCached.pushScope("solver");
+		CHECK(ppCached.getDoubleArray("USER_SOLUTION_TIMES") == ppRef.getDoubleArray("USER_SOLUTION_TIMES"));
+		CHECK(ppCached.numElements("USER_SOLUTION_TIMES") == ppRef.numElements("USER_SOLUTION_TIMES"));
+		ppRef.popScope();
+		ppCached.popScope();
+
+		ref.closeFile();
+		cached.closeFile();
+	}
+}
+
+TEST_CASE("Cached HDF5 reader matches direct reader", "[HDF5],[IO]")
+{
+	SECTION("LRMP")
+	{
+		compareReaders("/data/ref_LRMP_dynLin_1comp_sensbenchmark1_FV_Z32.h5");
+	}
+	SECTION("GRM")
+	{
+		compareReaders("/data/ref_GRM_reqSMA_4comp_sensbenchmark1_FV_Z16parZ2.h5");
+	}
+}
+
+TEST_CASE("Cached HDF5 reader navigates from root group", "[HDF5],[IO]")
+{
+	const std::string file = std::string(getTestDirectory()) + "/data/ref_LRMP_dynLin_1comp_sensbenchmark1_FV_Z32.h5";
+
+	cadet::io::HDF5Reader ref;
+	ref.openFile(file, "r");
+
+	cadet::io::HDF5CachedReader cached;
+	cached.openFile(file, "r");
+
+	CHECK(cached.itemNames() == ref.itemNames());
+	CHECK(cached.isGroup("input"));
+	CHECK(cached.isGroup("/input/model"));
+
+	cached.setGroup("input/solver");
+	ref.setGroup("input/solver");
+	CHECK(cached.vector<double>("USER_SOLUTION_TIMES") == ref.vector<double>("USER_SOLUTION_TIMES"));
+
+	ref.closeFile();
+	cached.closeFile();
+}
@@ -0,0 +1,207 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+
+#define CADET_LOGGING_DISABLE
+#include "Logging.hpp"
+
+#include "io/hdf5/HDF5Reader.hpp"
+#include "io/hdf5/HDF5Writer.hpp"
+#include "common/Driver.hpp"
+#include "common/JsonParameterProvider.hpp"
+
+#include "JsonTestModels.hpp"
+#include "SimHelper.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+	/**
+	 * @brief Compares all datasets of the current group of both readers recursively
+	 * @param [in] ref Reader of the reference file
+	 * @param [in] streamed Reader of the file that has been written in append mode
+	 * @param [in,out] numDatasets Number of compared datasets
+	 */
+	void compareGroups(cadet::io::HDF5Reader& ref, cadet::io::HDF5Reader& streamed, int& numDatasets)
+	{
+		const std::vector<std::string> names = ref.itemNames();
+		REQUIRE(streamed.itemNames() == names);
+
+		for (const std::string& name : names)
+		{
+			CAPTURE(name);
+			REQUIRE(streamed.isGroup(name) == ref.isGroup(name));
+
+			if (ref.isGroup(name))
+			{
+				ref.pushGroup(name);
+				streamed.pushGroup(name);
+				compareGroups(ref, streamed, numDatasets);
+				ref.popGroup();
+				streamed.popGroup();
+				continue;
+			}
+
+			++numDatasets;
+			REQUIRE(streamed.tensorDimensions(name) == ref.tensorDimensions(name));
+			if (ref.isString(name))
+				CHECK(streamed.vector<std::string>(name) == ref.vector<std::string>(name));
+			else
+				CHECK(streamed.vector<double>(name) == ref.vector<double>(name));
+		}
+	}
+
+	int compareFiles(const std::string& refFile, const std::string& streamedFile, const std::string& group)
+	{
+		cadet::io::HDF5Reader ref;
+		ref.openFile(refFile, "r");
+
+		cadet::io::HDF5Reader streamed;
+		streamed.openFile(streamedFile, "r");
+
+		ref.setGroup(group);
+		streamed.setGroup(group);
+
+		int numDatasets = 0;
+		compareGroups(ref, streamed, numDatasets);
+
+		ref.closeFile();
+		streamed.closeFile();
+		return numDatasets;
+	}
+}
+
+TEST_CASE("HDF5 writer appends blocks like a single write", "[HDF5],[IO]")
+{
+	const char refFile[] = "hdf5WriterRef.h5";
+	const char appendFile[] = "hdf5WriterAppend.h5";
+
+	// Each row of the strided buffer holds 3 used and 2 unused elements
+	const std::size_t nRows = 11;
+	const std::size_t nCols = 3;
+	const std::size_t stride = 5;
+	std::vector<double> data(nRows * nCols);
+	std::vector<double> strided(nRows * stride, -1.0);
+	for (std::size_t i = 0; i < nRows; ++i)
+	{
+		for (std::size_t j = 0; j < nCols; ++j)
+		{
+			data[i * nCols + j] = 0.25 + static_cast<double>(i * nCols + j);
+			strided[i * stride + j] = -data[i * nCols + j];
+		}
+	}
+
+	{
+		cadet::io::HDF5Writer writer;
+		writer.openFile(refFile, "co");
+		writer.compressFields(true);
+		writer.extendibleFields(false);
+		writer.pushGroup("output");
+		writer.matrix("FIELD", nRows, nCols, data.data());
+
+		std::vector<double> negData(data.size());
+		for (std::size_t i = 0; i < data.size(); ++i)
+			negData[i] = -data[i];
+		writer.matrix("STRIDED", nRows, nCols, negData.data());
+		writer.closeFile();
+	}
+
+	{
+		cadet::io::HDF5Writer writer;
+		writer.openFile(appendFile, "co");
+		writer.compressFields(true);
+		writer.appendFields(true);
+		writer.pushGroup("output");
+
+		// The first block determines the chunk size (4 rows), later blocks do not align with chunks
+		const std::size_t blocks[] = {4, 1, 5, 1};
+		std::size_t row = 0;
+		for (std::size_t b : blocks)
+		{
+			writer.matrix("FIELD", b, nCols, data.data() + row * nCols);
+			writer.matrix("STRIDED", b, nCols, strided.data() + row * stride, stride, nCols);
+			row += b;
+
+			// Flush with a partially filled chunk
+			writer.flush();
+		}
+		REQUIRE(row == nRows);
+
+		writer.appendFields(false);
+		writer.closeFile();
+	}
+
+	CHECK(compareFiles(refFile, appendFile, "output") == 2);
+
+	std::remove(refFile);
+	std::remove(appendFile);
+}
+
+TEST_CASE("Streamed simulation results match non-streamed results", "[HDF5],[IO],[Simulation]")
+{
+	const char refFile[] = "streamRef.h5";
+	const char streamFile[] = "streamAppend.h5";
+
+	nlohmann::json config = createLWEJson("LUMPED_RATE_MODEL_WITH_PORES", "FV");
+	config["model"]["unit_000"]["discretization"]["NCOL"] = 8;
+	config["return"]["unit_000"]["WRITE_SOLUTION_BULK"] = true;
+	config["return"]["unit_000"]["WRITE_SOLUTION_PARTICLE"] = true;
+	config["return"]["unit_000"]["WRITE_SOLUTION_FLUX"] = true;
+	config["return"]["unit_000"]["WRITE_SENS_OUTLET"] = true;
+
+	cadet::JsonParameterProvider jpp(config);
+	cadet::test::addSensitivity(jpp, "COL_DISPERSION", cadet::makeParamId("COL_DISPERSION", 0, cadet::CompIndep, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep), 1e-6);
+
+	{
+		cadet::Driver drv;
+		drv.configure(jpp);
+		drv.run();
+
+		cadet::io::HDF5Writer writer;
+		writer.openFile(refFile, "co");
+		drv.write(writer);
+		writer.closeFile();
+	}
+
+	{
+		cadet::Driver drv;
+		drv.configure(jpp);
+
+		// The buffer size does not divide the number of time points
+		drv.setStreamSolution(true);
+		drv.setStreamBufferSize(7);
+
+		cadet::io::HDF5Writer writer;
+		writer.openFile(streamFile, "co");
+		drv.run(writer);
+		drv.write(writer);
+		writer.closeFile();
+	}
+
+	CHECK(compareFiles(refFile, streamFile, "output") > 0);
+
+	{
+		cadet::io::HDF5Reader reader;
+		reader.openFile(streamFile, "r");
+		// Components are split by default, which appends strided blocks
+		reader.setGroup("output/sensitivity/param_000/unit_000");
+		CHECK(reader.exists("SENS_OUTLET_COMP_000"));
+		reader.closeFile();
+	}
+
+	std::remove(refFile);
+	std::remove(streamFile);
+}
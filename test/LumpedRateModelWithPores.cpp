@@ -164,6 +164,11 @@ TEST_CASE("LRMP consistent initialization with linear binding", "[LRMP],[FV],[Co
 //	cadet::test::column::testConsistentInitializationSMABinding("LUMPED_RATE_MODEL_WITH_PORES", y.data(), 1e-14, 1e-5);
 //}
 
+TEST_CASE("LRMP consistent initialization of identical cells matches single cell", "[LRMP],[FV],[ConsistentInit],[CI]")
+{
+	cadet::test::column::testConsistentInitializationIdenticalCells("LUMPED_RATE_MODEL_WITH_PORES", 1e-14);
+}
+
 TEST_CASE("LRMP consistent sensitivity initialization with linear binding", "[LRMP],[FV],[ConsistentInit],[Sensitivity],[CI]")
 {
 	// Fill state vector with given initial values
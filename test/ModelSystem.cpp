@@ -26,10 +26,17 @@
 #include "Utils.hpp"
 #include "Dummies.hpp"
 #include "model/UnitOperation.hpp"
+#include "common/Driver.hpp"
+#include "Approx.hpp"
+#include "SimHelper.hpp"
 
 #include <limits>
 #include <vector>
 #include <set>
+#include <fstream>
+#include <cstdio>
+
+#include <json.hpp>
 
 namespace
 {
@@ -861,6 +868,102 @@ TEST_CASE("ModelSystem sensitivity Jacobians", "[ModelSystem],[Sensitivity]")
 	destroyModelBuilder(mb);
 }
 
+TEST_CASE("ModelSystem sensitivity residual per parameter", "[ModelSystem],[Sensitivity]")
+{
+	cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+	REQUIRE(nullptr != mb);
+
+	const unsigned int nSens = 3;
+	std::vector<double> refResS;
+
+	for (int mode = 0; mode < 2; ++mode)
+	{
+		// Use some test case parameters
+		cadet::JsonParameterProvider jpp = createLinearBenchmark(true, false, "GENERAL_RATE_MODEL", "FV");
+
+		// Extract section times
+		jpp.pushScope("solver");
+		jpp.pushScope("sections");
+
+		const std::vector<double> secTimes = jpp.getDoubleArray("SECTION_TIMES");
+		std::vector<bool> secCont(secTimes.size() - 2, false);
+
+		jpp.popScope();
+		jpp.popScope();
+
+		// Create and configure ModelSystem
+		jpp.pushScope("model");
+		jpp.pushScope("solver");
+		jpp.set("PARALLEL_SENS_RESIDUAL", mode == 1);
+		jpp.popScope();
+
+		cadet::test::column::setNumAxialCells(jpp, 10);
+		cadet::IModelSystem* const cadSys = mb->createSystem(jpp);
+		REQUIRE(cadSys);
+		cadet::model::ModelSystem* const sys = reinterpret_cast<cadet::model::ModelSystem*>(cadSys);
+		sys->setupParallelization(cadet::util::getMaxThreads());
+
+		bool* const secContArray = new bool[secCont.size()];
+		std::copy(secCont.begin(), secCont.end(), secContArray);
+		sys->setSectionTimes(secTimes.data(), secContArray, secTimes.size() - 1);
+		delete[] secContArray;
+
+		// Enable AD
+		cadet::ad::setDirections(cadet::ad::getMaxDirections());
+		cadet::active* adRes = new cadet::active[sys->numDofs()];
+		cadet::active* adY = new cadet::active[sys->numDofs()];
+		sys->prepareADvectors(cadet::AdJacobianParams{adRes, adY, nSens});
+
+		// Add sensitivities
+		REQUIRE(sys->setSensitiveParameter(cadet::makeParamId(cadet::hashString("COL_DISPERSION"), 0, cadet::CompIndep, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep), 0, 1.0));
+		REQUIRE(sys->setSensitiveParameter(cadet::makeParamId(cadet::hashString("FILM_DIFFUSION"), 0, 0, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep), 1, 1.0));
+		REQUIRE(sys->setSensitiveParameter(cadet::makeParamId(cadet::hashString("LIN_KA"), 0, 0, cadet::ParTypeIndep, 0, cadet::ReactionIndep, cadet::SectionIndep), 2, 1.0));
+
+		const unsigned int nDof = sys->numDofs();
+		std::vector<double> y(nDof, 0.0);
+		std::vector<double> yDot(nDof, 0.0);
+		std::vector<double> res(nDof, 0.0);
+		std::vector<double> temp(3 * nDof, 0.0);
+		std::vector<double> sensState(2 * nSens * nDof, 0.0);
+		std::vector<double> resSmem(nSens * nDof, 0.0);
+
+		std::vector<const double*> yS(nSens, nullptr);
+		std::vector<const double*> ySdot(nSens, nullptr);
+		std::vector<double*> resS(nSens, nullptr);
+		for (unsigned int i = 0; i < nSens; ++i)
+		{
+			yS[i] = sensState.data() + i * nDof;
+			ySdot[i] = sensState.data() + (nSens + i) * nDof;
+			resS[i] = resSmem.data() + i * nDof;
+		}
+
+		// Fill state vectors with some values
+		cadet::test::util::populate(y.data(), [](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, nDof);
+		cadet::test::util::populate(yDot.data(), [=](unsigned int idx) { return std::abs(std::sin((idx + nDof) * 0.13)) + 1e-4; }, nDof);
+		cadet::test::util::populate(sensState.data(), [](unsigned int idx) { return std::cos(idx * 0.07); }, sensState.size());
+
+		sys->notifyDiscontinuousSectionTransition(0.0, 0u, {y.data(), yDot.data()}, cadet::AdJacobianParams{adRes, adY, nSens});
+		sys->residualSensFwdWithJacobian(nSens, cadet::SimulationTime{0.0, 0u}, cadet::ConstSimulationState{y.data(), yDot.data()}, res.data(), yS, ySdot, resS,
+			cadet::AdJacobianParams{adRes, adY, nSens}, temp.data(), temp.data() + nDof, temp.data() + 2 * nDof);
+
+		if (mode == 0)
+			refResS = resSmem;
+		else
+		{
+			for (std::size_t i = 0; i < resSmem.size(); ++i)
+			{
+				CAPTURE(i);
+				CHECK(resSmem[i] == cadet::test::makeApprox(refResS[i], 1e-12, 1e-12));
+			}
+		}
+
+		delete[] adY;
+		delete[] adRes;
+	}
+
+	destroyModelBuilder(mb);
+}
+
 TEST_CASE("ModelSystem coupling Jacobian linear chain single port (all) comp all", "[ModelSystem],[Jacobian],[Inlet]")
 {
 	const std::vector<unsigned int> sysDescription = {
@@ -1289,3 +1392,305 @@ TEST_CASE("ModelSystem coupling Jacobian component Y", "[ModelSystem],[Jacobian]
 
 	checkCouplingJacobian(sysDescription, connections, inFlow, outFlow);
 }
+
+TEST_CASE("ModelSystem Jacobian-free Newton-Krylov matches block solver", "[ModelSystem],[Simulation],[LinearSolver],[CI]")
+{
+	// Directional finite differences are too inaccurate for the badly scaled SMA binding model of the
+	// load-wash-elution benchmark, hence use linear binding
+	cadet::JsonParameterProvider jpp = createLinearBenchmark(true, false, "LUMPED_RATE_MODEL_WITH_PORES", "FV");
+
+	const double absTol = 1e-6;
+	const double relTol = 5e-4;
+
+	cadet::Driver drvBlock;
+	drvBlock.configure(jpp);
+	drvBlock.run();
+
+	cadet::InternalStorageUnitOpRecorder const* const blockData = drvBlock.solution()->unitOperation(0);
+	const unsigned int nComp = blockData->numComponents();
+
+	for (int precond = 0; precond <= 1; ++precond)
+	{
+		SECTION(precond ? "Block preconditioner" : "No preconditioner")
+		{
+			jpp.pushScope("model");
+			jpp.pushScope("solver");
+			jpp.set("JACOBIAN_FREE", true);
+			jpp.set("JFNK_PRECONDITIONER", precond);
+
+			// Use full Krylov subspace if the system is not preconditioned
+			if (!precond)
+				jpp.set("JFNK_MAX_KRYLOV", 0);
+
+			jpp.popScope();
+			jpp.popScope();
+
+			cadet::Driver drvJacFree;
+			drvJacFree.configure(jpp);
+			drvJacFree.run();
+
+			cadet::InternalStorageUnitOpRecorder const* const jacFreeData = drvJacFree.solution()->unitOperation(0);
+
+			double const* blockOutlet = blockData->outlet();
+			double const* jacFreeOutlet = jacFreeData->outlet();
+
+			for (unsigned int i = 0; i < blockData->numDataPoints() * blockData->numInletPorts() * nComp; ++i, ++blockOutlet, ++jacFreeOutlet)
+			{
+				CAPTURE(i);
+				CHECK((*jacFreeOutlet) == cadet::test::makeApprox(*blockOutlet, relTol, absTol));
+			}
+		}
+	}
+}
+
+TEST_CASE("Simulator resumes time integration from snapshot", "[ModelSystem],[Simulation],[CI]")
+{
+	cadet::JsonParameterProvider jpp = createLWE("LUMPED_RATE_MODEL_WITH_PORES", "FV");
+
+	const double absTol = 1e-6;
+	const double relTol = 5e-4;
+
+	// Reference: Uninterrupted simulation
+	cadet::Driver drvRef;
+	drvRef.configure(jpp);
+	drvRef.run();
+
+	// Interrupted simulation that stops inside the last section
+	const double tSnap = 50.0;
+	std::vector<double> solTimes;
+	for (double t = 0.0; t <= tSnap; t += 1.0)
+		solTimes.push_back(t);
+
+	cadet::JsonParameterProvider jppShort = createLWE("LUMPED_RATE_MODEL_WITH_PORES", "FV");
+	jppShort.pushScope("solver");
+	jppShort.set("USER_SOLUTION_TIMES", solTimes);
+	jppShort.popScope();
+
+	cadet::Driver drvShort;
+	drvShort.configure(jppShort);
+	drvShort.run();
+
+	const cadet::SimulatorSnapshot snap = drvShort.simulator()->snapshot();
+	CHECK(snap.time == tSnap);
+
+	// Resume the full simulation from the snapshot
+	cadet::Driver drvResume;
+	drvResume.configure(jpp);
+	drvResume.simulator()->resume(snap);
+	drvResume.run();
+
+	cadet::InternalStorageUnitOpRecorder const* const refData = drvRef.solution()->unitOperation(0);
+	cadet::InternalStorageUnitOpRecorder const* const resData = drvResume.solution()->unitOperation(0);
+	const unsigned int nComp = refData->numComponents();
+	const unsigned int offset = static_cast<unsigned int>(tSnap) + 1;
+
+	REQUIRE(resData->numDataPoints() + offset == refData->numDataPoints());
+
+	double const* refOutlet = refData->outlet() + offset * refData->numInletPorts() * nComp;
+	double const* resOutlet = resData->outlet();
+	for (unsigned int i = 0; i < resData->numDataPoints() * resData->numInletPorts() * nComp; ++i, ++refOutlet, ++resOutlet)
+	{
+		CAPTURE(i);
+		CHECK((*resOutlet) == cadet::test::makeApprox(*refOutlet, relTol, absTol));
+	}
+}
+
+TEST_CASE("Simulator resumes from snapshot at section start without changing results", "[ModelSystem],[Simulation],[CI]")
+{
+	// Takes a snapshot when entering the given section and aborts the simulation
+	class SnapshotNotifier : public cadet::INotificationCallback
+	{
+	public:
+		SnapshotNotifier(cadet::ISimulator& sim, unsigned int section) : _sim(sim), _section(section) { }
+
+		virtual void timeIntegrationStart() { }
+		virtual void timeIntegrationEnd() { }
+		virtual void timeIntegrationError(char const* message, unsigned int section, double time, double progress) { }
+
+		virtual bool timeIntegrationSection(unsigned int section, double time, double const* state, double const* stateDot, double progress)
+		{
+			if (section != _section)
+				return true;
+
+			snap = _sim.snapshot();
+			return false;
+		}
+
+		virtual bool timeIntegrationStep(unsigned int section, double time, double const* state, double const* stateDot, double progress) { return true; }
+
+		cadet::SimulatorSnapshot snap;
+
+	protected:
+		cadet::ISimulator& _sim;
+		unsigned int _section;
+	};
+
+	cadet::JsonParameterProvider jpp = createLWE("LUMPED_RATE_MODEL_WITH_PORES", "FV");
+
+	const double absTol = 1e-10;
+	const double relTol = 1e-8;
+
+	// Reference: Uninterrupted simulation
+	cadet::Driver drvRef;
+	drvRef.configure(jpp);
+	drvRef.run();
+
+	// Interrupted simulation that stops at the beginning of the last section (t = 90)
+	cadet::Driver drvAbort;
+	drvAbort.configure(jpp);
+
+	SnapshotNotifier notifier(*drvAbort.simulator(), 2);
+	drvAbort.setNotificationCallback(&notifier);
+	drvAbort.run();
+
+	CHECK(notifier.snap.time == 90.0);
+	CHECK(notifier.snap.section == 2);
+	CHECK(drvAbort.solution()->numDataPoints() == 91);
+
+	// Resume the full simulation from the snapshot
+	cadet::Driver drvResume;
+	drvResume.configure(jpp);
+	drvResume.simulator()->resume(notifier.snap);
+	drvResume.run();
+
+	cadet::InternalStorageUnitOpRecorder const* const refData = drvRef.solution()->unitOperation(0);
+	cadet::InternalStorageUnitOpRecorder const* const resData = drvResume.solution()->unitOperation(0);
+	const unsigned int nComp = refData->numComponents();
+	const unsigned int offset = 91;
+
+	REQUIRE(resData->numDataPoints() + offset == refData->numDataPoints());
+
+	double const* refOutlet = refData->outlet() + offset * refData->numInletPorts() * nComp;
+	double const* resOutlet = resData->outlet();
+	for (unsigned int i = 0; i < resData->numDataPoints() * resData->numInletPorts() * nComp; ++i, ++refOutlet, ++resOutlet)
+	{
+		CAPTURE(i);
+		CHECK((*resOutlet) == cadet::test::makeApprox(*refOutlet, relTol, absTol));
+	}
+}
+
+TEST_CASE("Simulator converges to cyclic steady state of periodically fed CSTR", "[ModelSystem],[Simulation],[CI]")
+{
+	// The CSTR (unit volume, unit flow rate) is fed with c = 1 in [0, 1) and c = 0 in [1, 2).
+	// In the cyclic steady state, the cycle starts and ends with c = exp(-1) / (1 + exp(-1)).
+	const double cPeriodic = std::exp(-1.0) / (1.0 + std::exp(-1.0));
+
+	const auto runCycles = [](unsigned int andersonDepth, unsigned int& nCycles) -> std::vector<double>
+	{
+		cadet::JsonParameterProvider jpp = createCSTRBenchmark(2, 2.0, 0.1);
+		cadet::test::setSectionTimes(jpp, {0.0, 1.0, 2.0});
+		cadet::test::setInitialConditions(jpp, {0.0}, {}, 1.0);
+		cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+		cadet::test::setInletProfile(jpp, 1, 0, 0.0, 0.0, 0.0, 0.0);
+		cadet::test::setFlowRates(jpp, 0, 1.0, 1.0, 0.0);
+		cadet::test::setFlowRates(jpp, 1, 1.0, 1.0, 0.0);
+
+		// Accumulating the output interval does not hit the end of the cycle exactly
+		std::vector<double> solTimes(21);
+		for (std::size_t i = 0; i < solTimes.size(); ++i)
+			solTimes[i] = 0.1 * static_cast<double>(i);
+
+		jpp.pushScope("solver");
+		jpp.set("USER_SOLUTION_TIMES", solTimes);
+		jpp.set("CSS_MAX_CYCLES", 50);
+		jpp.set("CSS_RELTOL", 1e-10);
+		jpp.set("CSS_ABSTOL", 1e-12);
+		jpp.set("CSS_ANDERSON_DEPTH", static_cast<int>(andersonDepth));
+		jpp.popScope();
+
+		cadet::Driver drv;
+		drv.configure(jpp);
+		drv.run();
+
+		nCycles = drv.simulator()->lastNumCycles();
+
+		cadet::InternalStorageUnitOpRecorder const* const data = drv.solution()->unitOperation(0);
+		return std::vector<double>(data->outlet(), data->outlet() + data->numDataPoints());
+	};
+
+	unsigned int nCyclesPlain = 0;
+	const std::vector<double> outPlain = runCycles(0, nCyclesPlain);
+
+	unsigned int nCyclesAnderson = 0;
+	const std::vector<double> outAnderson = runCycles(3, nCyclesAnderson);
+
+	// Only the final cycle is recorded
+	REQUIRE(outPlain.size() == 21);
+	REQUIRE(outAnderson.size() == 21);
+
+	CHECK(nCyclesPlain > 2);
+	CHECK(nCyclesPlain < 50);
+	CHECK(nCyclesAnderson < nCyclesPlain);
+
+	CHECK(outPlain.front() == cadet::test::makeApprox(cPeriodic, 1e-8, 1e-10));
+	CHECK(outPlain.back() == cadet::test::makeApprox(cPeriodic, 1e-8, 1e-10));
+	CHECK(outAnderson.front() == cadet::test::makeApprox(cPeriodic, 1e-8, 1e-10));
+	CHECK(outAnderson.back() == cadet::test::makeApprox(cPeriodic, 1e-8, 1e-10));
+}
+
+TEST_CASE("Profiler records nested scopes of simulation", "[ModelSystem],[Simulation],[Profiler],[CI]")
+{
+	const char* const fileName = "profile-test.json";
+
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 10.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 1.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 0.1, 0.1, 0.0);
+
+	cadet::resetProfile();
+	cadet::setProfilingEnabled(true);
+	{
+		cadet::Driver drv;
+		drv.configure(jpp);
+		drv.run();
+	}
+	cadet::setProfilingEnabled(false);
+
+	REQUIRE(cadet::writeProfile(fileName));
+	cadet::resetProfile();
+
+	nlohmann::json profile;
+	{
+		std::ifstream fs(fileName);
+		fs >> profile;
+	}
+	std::remove(fileName);
+
+	REQUIRE((profile.find("traceEvents") != profile.end()));
+	REQUIRE((profile.find("summary") != profile.end()));
+	CHECK(profile["traceEvents"].size() > 1);
+
+	// Collect scopes of the flat summary
+	std::set<std::string> scopes;
+	for (const nlohmann::json& s : profile["summary"]["scopes"])
+	{
+		CHECK(s["calls"].get<int>() > 0);
+		CHECK(s["total_ms"].get<double>() >= s["self_ms"].get<double>());
+		scopes.insert(s["name"].get<std::string>());
+	}
+
+	CHECK(scopes.count("time step") == 1);
+	CHECK(scopes.count("residual") == 1);
+	CHECK(scopes.count("unit residual") == 1);
+	CHECK(scopes.count("linear solve") == 1);
+	CHECK(scopes.count("consistent init") == 1);
+
+	// Residual evaluations are children of time steps (unit scopes may run on other threads)
+	bool foundNested = false;
+	for (const nlohmann::json& t : profile["summary"]["threads"])
+	{
+		for (const nlohmann::json& s : t["scopes"])
+		{
+			if ((s["name"] != "time step") || (s.find("children") == s.end()))
+				continue;
+
+			for (const nlohmann::json& c : s["children"])
+			{
+				if ((c["name"] == "residual") || (c["name"] == "residual with Jacobian"))
+					foundNested = true;
+			}
+		}
+	}
+	CHECK(foundNested);
+}
@@ -15,6 +15,9 @@
 #include "ReactionModelTests.hpp"
 #include "ColumnTests.hpp"
 
+#include <string>
+#include <vector>
+
 TEST_CASE("MassActionLaw kinetic analytic Jacobian vs AD", "[MassActionLaw],[ReactionModel],[Jacobian],[AD]")
 {
 	const unsigned int nBound[] = {1, 2, 1};
@@ -78,6 +81,50 @@ TEST_CASE("MassActionLaw kinetic analytic Jacobian vs AD", "[MassActionLaw],[Rea
 	);
 }
 
+TEST_CASE("MassActionLaw kinetic analytic Jacobian vs AD on sparse network with integer exponents", "[MassActionLaw],[ReactionModel],[Jacobian],[AD]")
+{
+	// Reaction chain 2 A_i <=> A_{i+1} with integer exponents and one non-integer exponent
+	const unsigned int nComp = 12;
+	const unsigned int nReactions = nComp - 1;
+	const std::vector<unsigned int> nBound(nComp, 0);
+
+	std::vector<double> stoich(nComp * nReactions, 0.0);
+	for (unsigned int r = 0; r < nReactions; ++r)
+	{
+		stoich[r * nReactions + r] = -2.0;
+		stoich[(r + 1) * nReactions + r] = 1.0;
+	}
+
+	std::vector<double> expBwd(nComp * nReactions, 0.0);
+	for (unsigned int r = 0; r < nReactions; ++r)
+		expBwd[(r + 1) * nReactions + r] = (r == 3) ? 1.5 : 1.0;
+
+	const auto toJson = [](const std::vector<double>& v) -> std::string
+		{
+			std::string s = "[";
+			for (std::size_t i = 0; i < v.size(); ++i)
+				s += (i > 0 ? ", " : "") + std::to_string(v[i]);
+			return s + "]";
+		};
+
+	std::vector<double> kFwd(nReactions);
+	std::vector<double> kBwd(nReactions);
+	for (unsigned int r = 0; r < nReactions; ++r)
+	{
+		kFwd[r] = 1.0 + 0.1 * r;
+		kBwd[r] = 0.5 + 0.05 * r;
+	}
+
+	const std::string config = "{\"MAL_KFWD_BULK\": " + toJson(kFwd) + ", \"MAL_KBWD_BULK\": " + toJson(kBwd)
+		+ ", \"MAL_STOICHIOMETRY_BULK\": " + toJson(stoich) + ", \"MAL_EXPONENTS_BULK_BWD\": " + toJson(expBwd) + "}";
+
+	std::vector<double> point(nComp);
+	for (unsigned int i = 0; i < nComp; ++i)
+		point[i] = 0.3 + 0.15 * i;
+
+	cadet::test::reaction::testDynamicJacobianAD("MASS_ACTION_LAW", nComp, nBound.data(), config.c_str(), point.data(), 1e-14, 1e-14);
+}
+
 TEST_CASE("MichaelisMenten kinetic and specific mass action law micro-kinetics yield same result", "[MichaelisMenten],[ReactionModel],[Simulation],[CI]")
 {
 	const std::string& configFilePath1 = std::string("/data/configuration_CSTR_MichaelisMenten_benchmark1.json");
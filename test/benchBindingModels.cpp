@@ -0,0 +1,398 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © The CADET Authors
+//            Please see the CONTRIBUTORS.md file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Benchmarks residual and Jacobian evaluation (analytic and AD) of binding models.
+ * Results are written as JSON.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <memory>
+#include <limits>
+
+#include <tclap/CmdLine.h>
+#include "common/TclapUtils.hpp"
+
+#include <json.hpp>
+
+#include "common/JsonParameterProvider.hpp"
+#include "common/Timer.hpp"
+
+#include "BindingModelFactory.hpp"
+#include "model/BindingModel.hpp"
+#include "linalg/BandMatrix.hpp"
+#include "linalg/DenseMatrix.hpp"
+#include "AdUtils.hpp"
+#include "AutoDiff.hpp"
+#include "Memory.hpp"
+
+#ifdef ENABLE_DG
+	#include "linalg/BandedEigenSparseRowIterator.hpp"
+#endif
+
+using json = nlohmann::json;
+
+namespace
+{
+	/**
+	 * @brief Binding model configuration that scales with the number of components
+	 * @details If @c hasSalt is @c true, the first component is a salt (or modifier)
+	 *          component and the remaining components are proteins.
+	 */
+	struct BenchmarkCase
+	{
+		const char* name; //!< Name of the binding model
+		bool hasSalt; //!< Determines whether the first component is a salt component
+		unsigned int nBoundSalt; //!< Number of bound states of the salt component
+		unsigned int nBoundProtein; //!< Number of bound states of each other component
+		unsigned int minComp; //!< Minimum number of components
+		std::function<json(unsigned int)> config; //!< Creates the parameters for a given number of components
+	};
+
+	/**
+	 * @brief Creates a parameter vector with one entry per component (and bound state)
+	 * @details The values of the non-salt components increase linearly with a small
+	 *          relative step in order to avoid identical components.
+	 * @param [in] nComp Number of components
+	 * @param [in] hasSalt Determines whether the first component is a salt component
+	 * @param [in] saltVal Value of the salt component
+	 * @param [in] val Base value of the other components
+	 * @param [in] nStates Number of bound states (the vector is repeated for each state)
+	 * @return Parameter vector
+	 */
+	std::vector<double> compVector(unsigned int nComp, bool hasSalt, double saltVal, double val, unsigned int nStates = 1)
+	{
+		std::vector<double> v;
+		v.reserve(nComp * nStates);
+		for (unsigned int s = 0; s < nStates; ++s)
+		{
+			for (unsigned int i = 0; i < nComp; ++i)
+			{
+				if (hasSalt && (i == 0))
+					v.push_back(saltVal);
+				else
+					v.push_back(val * (1.0 + 0.05 * i + 0.1 * s));
+			}
+		}
+		return v;
+	}
+
+	const std::vector<BenchmarkCase>& benchmarkCases()
+	{
+		static const std::vector<BenchmarkCase> cases = {
+			{"LINEAR", false, 0, 1, 1, [](unsigned int n) {
+				return json{{"LIN_KA", compVector(n, false, 0.0, 1.0)}, {"LIN_KD", compVector(n, false, 0.0, 0.1)}};
+			}},
+			{"FREUNDLICH_LDF", false, 0, 1, 1, [](unsigned int n) {
+				return json{{"FLDF_KKIN", compVector(n, false, 0.0, 1.0)}, {"FLDF_KF", compVector(n, false, 0.0, 0.1)}, {"FLDF_N", compVector(n, false, 0.0, 0.8)}};
+			}},
+			{"MULTI_COMPONENT_LANGMUIR", false, 0, 1, 1, [](unsigned int n) {
+				return json{{"MCL_KA", compVector(n, false, 0.0, 1.14)}, {"MCL_KD", compVector(n, false, 0.0, 0.004)}, {"MCL_QMAX", compVector(n, false, 0.0, 4.88)}};
+			}},
+			{"MULTI_COMPONENT_LANGMUIR_LDF", false, 0, 1, 1, [](unsigned int n) {
+				return json{{"MCLLDF_KEQ", compVector(n, false, 0.0, 1.14)}, {"MCLLDF_KKIN", compVector(n, false, 0.0, 2.0)}, {"MCLLDF_QMAX", compVector(n, false, 0.0, 4.88)}};
+			}},
+			{"MULTI_COMPONENT_LANGMUIR_LDF_LIQUID_PHASE", false, 0, 1, 1, [](unsigned int n) {
+				return json{{"MCLLDFC_KEQ", compVector(n, false, 0.0, 1.14)}, {"MCLLDFC_KKIN", compVector(n, false, 0.0, 2.0)}, {"MCLLDFC_QMAX", compVector(n, false, 0.0, 4.88)}};
+			}},
+			{"MULTI_COMPONENT_ANTILANGMUIR", false, 0, 1, 1, [](unsigned int n) {
+				std::vector<double> anti(n, 1.0);
+				for (unsigned int i = 1; i < n; i += 2)
+					anti[i] = -1.0;
+				return json{{"MCAL_KA", compVector(n, false, 0.0, 1.14)}, {"MCAL_KD", compVector(n, false, 0.0, 0.004)}, {"MCAL_QMAX", compVector(n, false, 0.0, 4.88)}, {"MCAL_ANTILANGMUIR", anti}};
+			}},
+			{"MULTI_COMPONENT_BILANGMUIR", false, 0, 2, 1, [](unsigned int n) {
+				return json{{"MCBL_KA", compVector(n, false, 0.0, 1.14, 2)}, {"MCBL_KD", compVector(n, false, 0.0, 0.004, 2)}, {"MCBL_QMAX", compVector(n, false, 0.0, 4.88, 2)}};
+			}},
+			{"MULTI_COMPONENT_BILANGMUIR_LDF", false, 0, 2, 1, [](unsigned int n) {
+				return json{{"MCBLLDF_KEQ", compVector(n, false, 0.0, 1.14, 2)}, {"MCBLLDF_KKIN", compVector(n, false, 0.0, 2.0, 2)}, {"MCBLLDF_QMAX", compVector(n, false, 0.0, 4.88, 2)}};
+			}},
+			{"MULTI_COMPONENT_SPREADING", false, 0, 2, 1, [](unsigned int n) {
+				return json{{"MCSPR_KA", compVector(n, false, 0.0, 1.14, 2)}, {"MCSPR_KD", compVector(n, false, 0.0, 0.004, 2)}, {"MCSPR_QMAX", compVector(n, false, 0.0, 4.88, 2)},
+					{"MCSPR_K12", compVector(n, false, 0.0, 0.5)}, {"MCSPR_K21", compVector(n, false, 0.0, 0.6)}};
+			}},
+			{"SASKA", false, 0, 1, 1, [](unsigned int n) {
+				return json{{"SASKA_H", compVector(n, false, 0.0, 1.5)}, {"SASKA_K", std::vector<double>(n * n, 0.1)}};
+			}},
+			{"MOBILE_PHASE_MODULATOR", true, 1, 1, 2, [](unsigned int n) {
+				return json{{"MPM_KA", compVector(n, true, 0.0, 1.14)}, {"MPM_KD", compVector(n, true, 0.0, 0.004)}, {"MPM_QMAX", compVector(n, true, 0.0, 4.88)},
+					{"MPM_GAMMA", compVector(n, true, 0.0, 0.5)}, {"MPM_BETA", compVector(n, true, 0.0, 1.5)}, {"MPM_LINEAR_THRESHOLD", 1e-10}};
+			}},
+			{"KUMAR_MULTI_COMPONENT_LANGMUIR", true, 0, 1, 2, [](unsigned int n) {
+				return json{{"KMCL_KA", compVector(n, true, 0.0, 1.14)}, {"KMCL_KD", compVector(n, true, 0.0, 0.004)}, {"KMCL_QMAX", compVector(n, true, 0.0, 4.88)},
+					{"KMCL_TEMP", 0.5}, {"KMCL_NU", compVector(n, true, 0.0, 1.2)}, {"KMCL_KACT", compVector(n, true, 0.0, 1.5)}};
+			}},
+			{"STERIC_MASS_ACTION", true, 1, 1, 2, [](unsigned int n) {
+				return json{{"SMA_KA", compVector(n, true, 0.0, 3.55)}, {"SMA_KD", compVector(n, true, 0.0, 10.0)}, {"SMA_NU", compVector(n, true, 1.0, 2.0)},
+					{"SMA_SIGMA", compVector(n, true, 0.0, 10.0)}, {"SMA_LAMBDA", 1000.0}};
+			}},
+			{"SELF_ASSOCIATION", true, 1, 1, 2, [](unsigned int n) {
+				return json{{"SAI_KA1", compVector(n, true, 0.0, 3.55)}, {"SAI_KA2", compVector(n, true, 0.0, 1.5)}, {"SAI_KD", compVector(n, true, 0.0, 10.0)},
+					{"SAI_NU", compVector(n, true, 1.0, 2.0)}, {"SAI_SIGMA", compVector(n, true, 0.0, 10.0)}, {"SAI_LAMBDA", 1000.0}};
+			}},
+			{"HIC_WATER_ON_HYDROPHOBIC_SURFACES", true, 0, 1, 2, [](unsigned int n) {
+				return json{{"HICWHS_KA", compVector(n, true, 0.0, 0.87)}, {"HICWHS_KD", compVector(n, true, 0.0, 45.0)}, {"HICWHS_BETA0", 0.018}, {"HICWHS_BETA1", 0.0008},
+					{"HICWHS_NU", compVector(n, true, 0.0, 10.0)}, {"HICWHS_QMAX", compVector(n, true, 0.0, 1000.0)}};
+			}},
+			{"HIC_CONSTANT_WATER_ACTIVITY", true, 0, 1, 2, [](unsigned int n) {
+				return json{{"HICCWA_KA", compVector(n, true, 0.0, 0.47)}, {"HICCWA_KD", compVector(n, true, 0.0, 2045.0)}, {"HICCWA_BETA0", 0.33}, {"HICCWA_BETA1", 0.0002},
+					{"HICCWA_NU", compVector(n, true, 0.0, 10.0)}, {"HICCWA_QMAX", compVector(n, true, 0.0, 10.0)}};
+			}},
+		};
+		return cases;
+	}
+
+	/**
+	 * @brief Measures the runtime of a function
+	 * @details The function is called @p nRep times in each of @p nSamples samples.
+	 * @param [in] nSamples Number of samples
+	 * @param [in] nRep Number of calls in each sample
+	 * @param [in] f Function to benchmark
+	 * @return JSON object with minimum and mean runtime per call in nanoseconds
+	 */
+	template <typename Func_t>
+	json timeFunction(unsigned int nSamples, unsigned int nRep, Func_t f)
+	{
+		double minTime = std::numeric_limits<double>::max();
+		cadet::Timer timer;
+		for (unsigned int s = 0; s < nSamples; ++s)
+		{
+			timer.start();
+			for (unsigned int r = 0; r < nRep; ++r)
+				f();
+
+			minTime = std::min(minTime, timer.stop());
+		}
+
+		const double scale = 1e9 / static_cast<double>(nRep);
+		return json{{"min", minTime * scale}, {"mean", timer.totalElapsedTime() * scale / static_cast<double>(nSamples)}};
+	}
+
+	/**
+	 * @brief Benchmarks one binding model with a given number of components
+	 * @param [in] bc Binding model configuration
+	 * @param [in] nComp Number of components
+	 * @param [in] nSamples Number of samples
+	 * @param [in] nRep Number of calls in each sample
+	 * @return JSON object with results
+	 */
+	json benchmarkModel(const BenchmarkCase& bc, unsigned int nComp, unsigned int nSamples, unsigned int nRep)
+	{
+		json result;
+		result["model"] = bc.name;
+		result["nComp"] = nComp;
+
+		cadet::BindingModelFactory bmf;
+		std::unique_ptr<cadet::model::IBindingModel> bm(bmf.create(bc.name));
+		if (!bm)
+		{
+			result["error"] = "Unknown binding model";
+			return result;
+		}
+
+		// Set up bound states
+		std::vector<unsigned int> nBound(nComp, bc.nBoundProtein);
+		if (bc.hasSalt)
+			nBound[0] = bc.nBoundSalt;
+
+		std::vector<unsigned int> boundOffset(nComp, 0);
+		for (unsigned int i = 1; i < nComp; ++i)
+			boundOffset[i] = boundOffset[i-1] + nBound[i-1];
+
+		const unsigned int nBoundStates = boundOffset[nComp - 1] + nBound[nComp - 1];
+		const unsigned int numDofs = nComp + nBoundStates;
+		result["nBoundStates"] = nBoundStates;
+
+		// Configure
+		try
+		{
+			cadet::JsonParameterProvider jpp(bc.config(nComp));
+			jpp.set("IS_KINETIC", true);
+			bm->configureModelDiscretization(jpp, nComp, nBound.data(), boundOffset.data());
+			if (bm->requiresConfiguration())
+				bm->configure(jpp, 0, 0);
+		}
+		catch (const std::exception& e)
+		{
+			result["error"] = e.what();
+			return result;
+		}
+
+		// Allocate workspace (use double to ensure proper alignment)
+		const std::size_t workspaceSize = bm->requiresWorkspace() ? bm->workspaceSize(nComp, nBoundStates, boundOffset.data()) : 0;
+		std::vector<double> bufferMemory((workspaceSize + sizeof(double) - 1) / sizeof(double), 0.0);
+		cadet::LinearBufferAllocator buffer(bufferMemory.data(), bufferMemory.data() + bufferMemory.size());
+
+		// State with liquid phase followed by solid phase
+		std::vector<double> y(numDofs, 0.0);
+		for (unsigned int i = 0; i < nComp; ++i)
+			y[i] = 1.0 + 0.1 * i;
+		for (unsigned int i = 0; i < nBoundStates; ++i)
+			y[nComp + i] = 0.1 + 0.01 * i;
+		if (bc.hasSalt)
+		{
+			y[0] = 50.0;
+			if (bc.nBoundSalt > 0)
+				y[nComp] = 800.0;
+		}
+
+		double const* const yCp = y.data();
+		double const* const yBound = y.data() + nComp;
+		const cadet::ColumnPosition colPos{0.0, 0.0, 0.0};
+		const double t = 1.0;
+
+		json timings;
+
+		// Residual
+		std::vector<double> res(nBoundStates, 0.0);
+		timings["fluxDouble"] = timeFunction(nSamples, nRep, [&]() { bm->flux(t, 0u, colPos, yBound, yCp, res.data(), buffer); });
+
+		// Analytic Jacobian with dense block structure (liquid and solid phase of one cell)
+		cadet::linalg::BandMatrix bandMat;
+		bandMat.resize(numDofs, numDofs - 1, numDofs - 1);
+		timings["analyticJacobianBand"] = timeFunction(nSamples, nRep, [&]() { bm->analyticJacobian(t, 0u, colPos, yBound, nComp, bandMat.row(nComp), buffer); });
+
+#ifdef ENABLE_DG
+		std::vector<Eigen::Triplet<double>> pattern;
+		pattern.reserve(numDofs * numDofs);
+		for (unsigned int r = 0; r < numDofs; ++r)
+		{
+			for (unsigned int c = 0; c < numDofs; ++c)
+				pattern.emplace_back(r, c, 0.0);
+		}
+
+		Eigen::SparseMatrix<double, Eigen::RowMajor> sparseMat(numDofs, numDofs);
+		sparseMat.setFromTriplets(pattern.begin(), pattern.end());
+		sparseMat.makeCompressed();
+		timings["analyticJacobianEigenSparse"] = timeFunction(nSamples, nRep, [&]() { bm->analyticJacobian(t, 0u, colPos, yBound, nComp, cadet::linalg::BandedEigenSparseRowIterator(sparseMat, nComp), buffer); });
+#endif
+
+		// AD uses dense seed vectors, i.e., one direction per state entry
+		result["adDirections"] = numDofs;
+		if (numDofs <= cadet::ad::getMaxDirections())
+		{
+			cadet::ad::setDirections(numDofs);
+
+			std::vector<cadet::active> adY(numDofs);
+			std::vector<cadet::active> adRes(nBoundStates);
+			cadet::ad::prepareAdVectorSeedsForDenseMatrix(adY.data(), 0, numDofs);
+			cadet::ad::copyToAd(y.data(), adY.data(), numDofs);
+
+			timings["fluxActive"] = timeFunction(nSamples, nRep, [&]() { bm->flux(t, 0u, colPos, adY.data() + nComp, adY.data(), adRes.data(), buffer, cadet::WithoutParamSensitivity()); });
+
+			cadet::linalg::DenseMatrix jacAD;
+			jacAD.resize(nBoundStates, numDofs);
+			timings["adJacobian"] = timeFunction(nSamples, nRep, [&]()
+				{
+					cadet::ad::prepareAdVectorSeedsForDenseMatrix(adY.data(), 0, numDofs);
+					cadet::ad::copyToAd(y.data(), adY.data(), numDofs);
+					bm->flux(t, 0u, colPos, adY.data() + nComp, adY.data(), adRes.data(), buffer, cadet::WithoutParamSensitivity());
+					cadet::ad::extractDenseJacobianFromAd(adRes.data(), 0, jacAD);
+				});
+		}
+
+		result["timings"] = timings;
+		return result;
+	}
+
+	std::vector<unsigned int> parseComponentList(const std::string& str)
+	{
+		std::vector<unsigned int> nComps;
+		std::istringstream iss(str);
+		std::string item;
+		while (std::getline(iss, item, ','))
+		{
+			if (!item.empty())
+				nComps.push_back(std::stoul(item));
+		}
+		return nComps;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::string compList;
+	std::string modelName;
+	std::string outFileName;
+	unsigned int nRep = 0;
+	unsigned int nSamples = 0;
+	try
+	{
+		TCLAP::CustomOutputWithoutVersion customOut("benchBindingModels");
+		TCLAP::CmdLine cmd("Benchmarks residual and Jacobian evaluation of binding models", ' ', "1.0");
+		cmd.setOutput(&customOut);
+
+		cmd >> (new TCLAP::ValueArg<std::string>("c", "components", "Comma separated list of component counts (default: 1,2,4,8,16)", false, "1,2,4,8,16", "List"))->storeIn(&compList);
+		cmd >> (new TCLAP::ValueArg<std::string>("m", "model", "Only benchmark the given binding model (default: all)", false, "", "Name"))->storeIn(&modelName);
+		cmd >> (new TCLAP::ValueArg<unsigned int>("r", "repetitions", "Number of calls per sample (default: 10000)", false, 10000, "Num"))->storeIn(&nRep);
+		cmd >> (new TCLAP::ValueArg<unsigned int>("s", "samples", "Number of samples (default: 5)", false, 5, "Num"))->storeIn(&nSamples);
+		cmd >> (new TCLAP::ValueArg<std::string>("o", "output", "Output JSON file (default: stdout)", false, "", "File"))->storeIn(&outFileName);
+
+		cmd.parse(argc, argv);
+	}
+	catch (const TCLAP::ArgException &e)
+	{
+		std::cerr << "ERROR: " << e.error() << " for argument " << e.argId() << std::endl;
+		return 1;
+	}
+
+	std::vector<unsigned int> nComps;
+	try
+	{
+		nComps = parseComponentList(compList);
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "ERROR: Invalid component list " << compList << std::endl;
+		return 1;
+	}
+
+	json results = json::array();
+	for (const BenchmarkCase& bc : benchmarkCases())
+	{
+		if (!modelName.empty() && (modelName != bc.name))
+			continue;
+
+		for (unsigned int nComp : nComps)
+		{
+			if (nComp < bc.minComp)
+				continue;
+
+			std::cerr << "Benchmarking " << bc.name << " with " << nComp << " components" << std::endl;
+			results.push_back(benchmarkModel(bc, nComp, std::max(nSamples, 1u), std::max(nRep, 1u)));
+		}
+	}
+
+	json output;
+	output["repetitions"] = nRep;
+	output["samples"] = nSamples;
+	output["maxAdDirections"] = cadet::ad::getMaxDirections();
+	output["unit"] = "ns";
+	output["results"] = results;
+
+	if (outFileName.empty())
+		std::cout << output.dump(4) << std::endl;
+	else
+	{
+		std::ofstream ofs(outFileName);
+		ofs << output.dump(4) << std::endl;
+	}
+
+	return 0;
+}
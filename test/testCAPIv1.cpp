@@ -15,6 +15,8 @@
 #endif
 
 #include <stdexcept>
+#include <cmath>
+#include <algorithm>
 #include <stdint.h>
 #include <iostream>
 #include <memory>
@@ -835,5 +837,100 @@ int main(int argc, char** argv)
 
 	std::cout << "getSolutionOutlet() = " << resSol << " nTime = " << nTime << " nPort = " << nPort << " nComp = " << nComp << std::endl;
 
+	// Batch simulation with varied column dispersion
+	const cdtParameterId batchParams[] = {{"COL_DISPERSION", 0, -1, -1, -1, -1, -1}};
+	const double batchValues[] = {5.75e-8, 1e-7, 2e-7};
+
+	const cdtResult resBatch = api.runSimulationBatch(drv.get(), &pp, batchParams, 1, batchValues, 3, 0, 0);
+	std::cout << "runSimulationBatch() = " << resBatch << std::endl;
+
+	if (CADET_ERR(resBatch))
+	{
+		std::cout << "Batch simulation failed" << std::endl;
+		return 1;
+	}
+
+	cdtResult const* batchStatus = nullptr;
+	int nVariants = 0;
+	const cdtResult resBatchSol = api.getBatchOutlet(drv.get(), &time, &outlet, &batchStatus, &nVariants, &nTime, &nPort, &nComp);
+
+	std::cout << "getBatchOutlet() = " << resBatchSol << " nVariants = " << nVariants << " nTime = " << nTime << " nPort = " << nPort << " nComp = " << nComp << std::endl;
+
+	if (CADET_ERR(resBatchSol) || (nVariants != 3))
+	{
+		std::cout << "Failed to obtain batch outlet" << std::endl;
+		return 1;
+	}
+
+	const std::size_t sliceSize = static_cast<std::size_t>(nTime) * nPort * nComp;
+	const std::vector<double> batchTime(time, time + nTime);
+	const std::vector<double> batchOutlet(outlet, outlet + sliceSize * nVariants);
+	const std::vector<cdtResult> batchVariantStatus(batchStatus, batchStatus + nVariants);
+
+	// Compare each variant with a serial simulation of the same parameter value
+	for (int v = 0; v < nVariants; ++v)
+	{
+		if (CADET_ERR(batchVariantStatus[v]))
+		{
+			std::cout << "Batch variant " << v << " failed with status " << batchVariantStatus[v] << std::endl;
+			return 1;
+		}
+
+		json varSpec = simSpec;
+		varSpec["model"]["unit_000"]["COL_DISPERSION"] = batchValues[v];
+		JsonNavigator jnVar(varSpec);
+
+		cdtParameterProvider ppVar = pp;
+		ppVar.userData = &jnVar;
+
+		std::unique_ptr<cdtDriver, std::function<void(cdtDriver*)>> drvSerial(api.createDriver(), [&api](cdtDriver* ptr) { api.deleteDriver(ptr); });
+		if (CADET_ERR(api.runSimulation(drvSerial.get(), &ppVar)))
+		{
+			std::cout << "Serial simulation of variant " << v << " failed" << std::endl;
+			return 1;
+		}
+
+		int nTimeSerial = 0;
+		int nPortSerial = 0;
+		int nCompSerial = 0;
+		if (CADET_ERR(api.getSolutionOutlet(drvSerial.get(), 0, &time, &outlet, &nTimeSerial, &nPortSerial, &nCompSerial))
+			|| (nTimeSerial != nTime) || (nPortSerial != nPort) || (nCompSerial != nComp))
+		{
+			std::cout << "Outlet of serial simulation of variant " << v << " does not match batch layout" << std::endl;
+			return 1;
+		}
+
+		double maxOutlet = 0.0;
+		double maxDiff = 0.0;
+		for (std::size_t i = 0; i < sliceSize; ++i)
+		{
+			maxOutlet = std::max(maxOutlet, std::abs(outlet[i]));
+			maxDiff = std::max(maxDiff, std::abs(outlet[i] - batchOutlet[v * sliceSize + i]));
+		}
+
+		std::cout << "Variant " << v << ": max outlet = " << maxOutlet << " max deviation from serial = " << maxDiff << std::endl;
+		if (!(maxDiff <= 1e-8 * maxOutlet))
+		{
+			std::cout << "Batch variant " << v << " deviates from serial simulation" << std::endl;
+			return 1;
+		}
+
+		for (int i = 0; i < nTime; ++i)
+		{
+			if (batchTime[i] != time[i])
+			{
+				std::cout << "Batch time points differ from serial simulation" << std::endl;
+				return 1;
+			}
+		}
+	}
+
+	// Make sure that the varied parameter has been applied
+	if (std::equal(batchOutlet.begin(), batchOutlet.begin() + sliceSize, batchOutlet.begin() + 2 * sliceSize))
+	{
+		std::cout << "Batch variants do not differ" << std::endl;
+		return 1;
+	}
+
 	return 0;
 }